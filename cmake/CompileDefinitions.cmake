@@ -52,6 +52,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_SVG)
     define_if("raylib" SUPPORT_FILEFORMAT_FNT)
     define_if("raylib" SUPPORT_FILEFORMAT_TTF)
+    define_if("raylib" SUPPORT_FONT_GLYPH_CACHE)
     define_if("raylib" SUPPORT_TEXT_MANIPULATION)
     define_if("raylib" SUPPORT_MESH_GENERATION)
     define_if("raylib" SUPPORT_FILEFORMAT_OBJ)
@@ -69,6 +70,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_FLAC)
     define_if("raylib" SUPPORT_STANDARD_FILEIO)
     define_if("raylib" SUPPORT_TRACELOG)
+    define_if("raylib" SUPPORT_THREADED_JOBS)
 
     if (UNIX AND NOT APPLE)
         target_compile_definitions("raylib" PUBLIC "MAX_FILEPATH_LENGTH=4096")
@@ -123,6 +125,7 @@ if (${CUSTOMIZE_BUILD})
     target_compile_definitions("raylib" PUBLIC "DEFAULT_AUDIO_BUFFER_SIZE=4096")
 
     target_compile_definitions("raylib" PUBLIC "MAX_TRACELOG_MSG_LENGTH=128")
+    target_compile_definitions("raylib" PUBLIC "MAX_JOB_WORKER_THREADS=4")
     target_compile_definitions("raylib" PUBLIC "MAX_UWP_MESSAGES=512")
 endif ()
 
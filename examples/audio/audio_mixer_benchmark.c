@@ -0,0 +1,250 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Mixer benchmark, audio callback mixing time for N voices
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Several sound aliases (voices) are kept playing while their volume and pan change,
+*   audio callback mixing time is measured from an audio stream callback (first audio buffer mixed)
+*   to a mixed audio processor (called after all audio buffers have been mixed)
+*
+*   NOTE: Voices are mixed with pitch 1.0 (no sample rate conversion) and with random pitch
+*   (sample rate conversion), mixing load is the share of the audio callback period used for mixing
+*
+*   NOTE: Only up to MAX_AUDIO_VOICES sounds are mixed (real voices), ranked by priority and volume,
+*   other playing sounds are virtual voices, inaudible or lower ranked, they are not mixed
+*
+*   NOTE: Run with --headless argument to run the benchmark on a hidden window,
+*   results are printed to standard output and program exits when finished,
+*   on systems with no audio device, miniaudio null backend is used
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_VOICES             256      // Maximum number of voices (sound aliases) played
+#define BENCHMARK_PHASES         6      // Number of benchmark phases: voices count and pitch
+#define PHASE_TIME             2.0      // Benchmark phase duration (seconds)
+#define REQUESTS_PER_UPDATE     16      // Number of volume and pan changes per update
+
+// Mixing timing stats, accumulated by audio thread
+typedef struct MixerStats {
+    double startTime;                   // Current callback mixing start time
+    double lastEndTime;                 // Previous callback mixing end time
+    int count;                          // Callbacks measured
+    double mixTime;                     // Mixing time accumulated (ms)
+    double periodTime;                  // Callbacks period accumulated (ms)
+} MixerStats;
+
+// Benchmark phase results
+typedef struct PhaseResult {
+    int voices;                         // Voices played
+    bool pitched;                       // Voices played with random pitch
+    int callbacks;                      // Callbacks measured
+    double mixTime;                     // Mixing time mean per callback (ms)
+    double load;                        // Mixing time share of callback period (%)
+    int realVoices;                     // Voices mixed at phase end
+    int virtualVoices;                  // Voices not mixed at phase end
+    int stolenVoices;                   // Real voices turned virtual during phase
+} PhaseResult;
+
+static MixerStats stats = { 0 };
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void MixStartCallback(void *buffer, unsigned int frames);    // Audio stream callback, mixing start (first audio buffer)
+static void MixEndCallback(void *buffer, unsigned int frames);      // Audio mixed processor, mixing end
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - mixer benchmark");
+
+    InitAudioDevice();              // Initialize audio device
+
+    // NOTE: Audio buffers are mixed in loading order, the stream is the first audio buffer mixed
+    AudioStream marker = LoadAudioStream(44100, 32, 1);
+    SetAudioStreamCallback(marker, MixStartCallback);
+    PlayAudioStream(marker);
+
+    Sound sound = LoadSound("resources/sound.wav");
+    Sound voices[MAX_VOICES] = { 0 };
+    for (int i = 0; i < MAX_VOICES; i++) voices[i] = LoadSoundAlias(sound);
+
+    AttachAudioMixedProcessor(MixEndCallback);
+
+    PhaseResult results[BENCHMARK_PHASES] = {
+        { 32, false }, { 32, true }, { 128, false }, { 128, true }, { 256, false }, { 256, true }
+    };
+
+    int phase = 0;
+    int phaseCount = 0;             // Phase callbacks count at start
+    double phaseMixTime = 0.0;      // Phase mixing time at start
+    double phasePeriodTime = 0.0;   // Phase callbacks period time at start
+    int phaseStolenVoices = 0;      // Voices stolen at start
+    double phaseStartTime = GetTime();
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (phase < BENCHMARK_PHASES)
+        {
+            int voiceCount = results[phase].voices;
+
+            // Keep phase voices playing, other voices stopped
+            for (int i = 0; i < MAX_VOICES; i++)
+            {
+                if (i >= voiceCount)
+                {
+                    if (IsSoundPlaying(voices[i])) StopSound(voices[i]);
+                }
+                else if (!IsSoundPlaying(voices[i]))
+                {
+                    SetSoundPitch(voices[i], results[phase].pitched? (float)GetRandomValue(80, 120)/100.0f : 1.0f);
+                    PlaySound(voices[i]);
+                }
+            }
+
+            // Voices volume and pan changes, mixer ramps voices gain
+            for (int i = 0; i < REQUESTS_PER_UPDATE; i++)
+            {
+                Sound voice = voices[GetRandomValue(0, voiceCount - 1)];
+
+                SetSoundVolume(voice, (float)GetRandomValue(0, 100)/(100.0f*voiceCount));
+                SetSoundPan(voice, (float)GetRandomValue(0, 100)/100.0f);
+            }
+
+            if ((GetTime() - phaseStartTime) > PHASE_TIME)
+            {
+                // NOTE: Stats are updated by audio thread, a callback being measured could be missed
+                int count = stats.count - phaseCount;
+
+                results[phase].callbacks = count;
+                results[phase].mixTime = (count > 0)? (stats.mixTime - phaseMixTime)/count : 0.0;
+                results[phase].load = (stats.periodTime > phasePeriodTime)? 100.0*(stats.mixTime - phaseMixTime)/(stats.periodTime - phasePeriodTime) : 0.0;
+                results[phase].realVoices = GetAudioRealVoices();
+                results[phase].virtualVoices = GetAudioVirtualVoices();
+                results[phase].stolenVoices = GetAudioStolenVoices() - phaseStolenVoices;
+
+                phase++;
+                phaseCount = stats.count;
+                phaseMixTime = stats.mixTime;
+                phasePeriodTime = stats.periodTime;
+                phaseStolenVoices = GetAudioStolenVoices();
+                phaseStartTime = GetTime();
+            }
+        }
+        else if (headless) break;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("Voices", 10, 10, 20, DARKGRAY);
+            DrawText("Pitch", 120, 10, 20, DARKGRAY);
+            DrawText("Mix time (ms)", 240, 10, 20, DARKGRAY);
+            DrawText("Load (%)", 400, 10, 20, DARKGRAY);
+            DrawText("Real/Virtual/Stolen", 520, 10, 20, DARKGRAY);
+
+            for (int i = 0; i < BENCHMARK_PHASES; i++)
+            {
+                int posY = 50 + i*30;
+                Color color = (i == phase)? MAROON : BLACK;
+
+                DrawText(TextFormat("%i", results[i].voices), 10, posY, 20, color);
+                DrawText(results[i].pitched? "random" : "1.0", 120, posY, 20, color);
+                if (i < phase)
+                {
+                    DrawText(TextFormat("%.4f", results[i].mixTime), 240, posY, 20, color);
+                    DrawText(TextFormat("%.2f", results[i].load), 400, posY, 20, color);
+                    DrawText(TextFormat("%i/%i/%i", results[i].realVoices, results[i].virtualVoices, results[i].stolenVoices), 520, posY, 20, color);
+                }
+                else if (i == phase) DrawText("running...", 240, posY, 20, color);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_VOICES; i++) UnloadSoundAlias(voices[i]);
+    UnloadSound(sound);
+    UnloadAudioStream(marker);
+
+    CloseAudioDevice();     // Close audio device
+
+    if (headless)
+    {
+        printf("Mixer benchmark: %.1f s per phase, %i volume and pan changes per update\n", PHASE_TIME, REQUESTS_PER_UPDATE);
+        printf("%-8s %-8s %10s %14s %10s %6s %8s %8s\n", "voices", "pitch", "callbacks", "mix time (ms)", "load (%)", "real", "virtual", "stolen");
+        for (int i = 0; i < BENCHMARK_PHASES; i++)
+        {
+            printf("%-8i %-8s %10i %14.4f %10.2f %6i %8i %8i\n", results[i].voices, results[i].pitched? "random" : "1.0", results[i].callbacks, results[i].mixTime, results[i].load,
+                results[i].realVoices, results[i].virtualVoices, results[i].stolenVoices);
+        }
+    }
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Audio stream callback, registers mixing start time, stream is the first audio buffer mixed
+// NOTE: Called from audio thread, stream data is silence
+static void MixStartCallback(void *buffer, unsigned int frames)
+{
+    memset(buffer, 0, frames*sizeof(float));
+
+    // NOTE: Stream could be read more than once per callback, only first read is registered
+    if (stats.startTime <= stats.lastEndTime) stats.startTime = GetTime();
+}
+
+// Audio mixed processor, registers mixing time and callback period
+// NOTE: Called from audio thread, after all audio buffers have been mixed
+static void MixEndCallback(void *buffer, unsigned int frames)
+{
+    double time = GetTime();
+
+    if ((stats.lastEndTime > 0.0) && (stats.startTime > stats.lastEndTime))
+    {
+        stats.mixTime += (time - stats.startTime)*1000.0;
+        stats.periodTime += (time - stats.lastEndTime)*1000.0;
+        stats.count++;
+    }
+
+    stats.lastEndTime = time;
+}
@@ -0,0 +1,200 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Mixer stress test, audio callback jitter measurement
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Program thread keeps decoding several music streams and sending play, stop, volume
+*   and pan requests, audio device callback period is measured using a mixed audio processor,
+*   a callback waiting for program thread shows up as jitter and late callbacks
+*
+*   NOTE: Run with --headless argument to run the stress test on a hidden window,
+*   results are printed to standard output and program exits when finished,
+*   on systems with no audio device, miniaudio null backend is used
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>           // Required for: sqrt()
+#include <stdio.h>          // Required for: printf()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_SOUNDS              64      // Number of sound aliases played
+#define MAX_MUSICS               4      // Number of music streams decoded
+#define REQUESTS_PER_UPDATE     64      // Number of sound requests sent per update
+#define UPDATE_TIME          0.001      // Program thread update time on headless mode (seconds)
+#define STRESS_TEST_TIME       5.0      // Stress test duration (seconds)
+
+// Audio callback timing stats, updated by audio thread
+typedef struct CallbackStats {
+    double lastTime;                    // Last callback time
+    int count;                          // Callback intervals measured
+    double sum;                         // Intervals sum (ms)
+    double sumSquared;                  // Intervals squared sum (ms^2)
+    double min;                         // Minimum interval (ms)
+    double max;                         // Maximum interval (ms)
+    int lateCount;                      // Intervals longer than 1.5x the mean interval measured
+} CallbackStats;
+
+static CallbackStats stats = { 0 };
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void MeasureCallback(void *buffer, unsigned int frames);     // Audio mixed processor, measures callback intervals
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - mixer stress test");
+
+    InitAudioDevice();              // Initialize audio device
+
+    Sound sound = LoadSound("resources/coin.wav");
+    Sound aliases[MAX_SOUNDS] = { 0 };
+    for (int i = 0; i < MAX_SOUNDS; i++) aliases[i] = LoadSoundAlias(sound);
+
+    const char *musicFiles[MAX_MUSICS] = { "resources/country.mp3", "resources/target.ogg", "resources/target.qoa", "resources/mini1111.xm" };
+    Music musics[MAX_MUSICS] = { 0 };
+    for (int i = 0; i < MAX_MUSICS; i++)
+    {
+        musics[i] = LoadMusicStream(musicFiles[i]);
+        SetMusicVolume(musics[i], 0.2f);
+        PlayMusicStream(musics[i]);
+    }
+
+    AttachAudioMixedProcessor(MeasureCallback);
+
+    int requests = 0;
+    int updates = 0;
+    double startTime = GetTime();
+
+    if (!headless) SetTargetFPS(60);    // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        for (int i = 0; i < MAX_MUSICS; i++) UpdateMusicStream(musics[i]);
+
+        for (int i = 0; i < REQUESTS_PER_UPDATE; i++)
+        {
+            Sound alias = aliases[GetRandomValue(0, MAX_SOUNDS - 1)];
+
+            switch (GetRandomValue(0, 3))
+            {
+                case 0: PlaySound(alias); break;
+                case 1: StopSound(alias); break;
+                case 2: SetSoundVolume(alias, (float)GetRandomValue(0, 100)/400.0f); break;
+                case 3: SetSoundPan(alias, (float)GetRandomValue(0, 100)/100.0f); break;
+                default: break;
+            }
+        }
+
+        requests += REQUESTS_PER_UPDATE;
+        updates++;
+        //----------------------------------------------------------------------------------
+
+        if (headless)
+        {
+            if ((GetTime() - startTime) > STRESS_TEST_TIME) break;
+
+            WaitTime(UPDATE_TIME);
+            continue;
+        }
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%i music streams decoded, %i sound requests per frame", MAX_MUSICS, REQUESTS_PER_UPDATE), 10, 10, 20, DARKGRAY);
+
+            if (stats.count > 0)
+            {
+                double mean = stats.sum/stats.count;
+
+                DrawText(TextFormat("Audio callbacks: %i", stats.count), 10, 60, 20, BLACK);
+                DrawText(TextFormat("Callback period mean: %.3f ms", mean), 10, 90, 20, BLACK);
+                DrawText(TextFormat("Callback period min/max: %.3f / %.3f ms", stats.min, stats.max), 10, 120, 20, BLACK);
+                DrawText(TextFormat("Callback jitter (stddev): %.3f ms", sqrt(fmax(stats.sumSquared/stats.count - mean*mean, 0.0))), 10, 150, 20, MAROON);
+                DrawText(TextFormat("Late callbacks: %i", stats.lateCount), 10, 180, 20, MAROON);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_SOUNDS; i++) UnloadSoundAlias(aliases[i]);
+    UnloadSound(sound);
+    for (int i = 0; i < MAX_MUSICS; i++) UnloadMusicStream(musics[i]);
+
+    CloseAudioDevice();     // Close audio device, audio thread is not running anymore
+
+    if (headless)
+    {
+        double mean = (stats.count > 0)? stats.sum/stats.count : 0.0;
+
+        printf("Mixer stress test: %.1f s, %i music streams, %i updates, %i sound requests\n", STRESS_TEST_TIME, MAX_MUSICS, updates, requests);
+        printf("%-24s %10i\n", "callbacks", stats.count);
+        printf("%-24s %10.3f\n", "period mean (ms)", mean);
+        printf("%-24s %10.3f\n", "period min (ms)", stats.min);
+        printf("%-24s %10.3f\n", "period max (ms)", stats.max);
+        printf("%-24s %10.3f\n", "jitter stddev (ms)", (stats.count > 0)? sqrt(fmax(stats.sumSquared/stats.count - mean*mean, 0.0)) : 0.0);
+        printf("%-24s %10i\n", "late callbacks", stats.lateCount);
+    }
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Audio mixed processor, measures interval between audio callbacks
+// NOTE: Called from audio thread, after all audio buffers have been mixed
+static void MeasureCallback(void *buffer, unsigned int frames)
+{
+    double time = GetTime();
+
+    if (stats.lastTime > 0.0)
+    {
+        double interval = (time - stats.lastTime)*1000.0;
+
+        if ((stats.count == 0) || (interval < stats.min)) stats.min = interval;
+        if ((stats.count == 0) || (interval > stats.max)) stats.max = interval;
+
+        if ((stats.count > 0) && (interval > 1.5*stats.sum/stats.count)) stats.lateCount++;
+
+        stats.sum += interval;
+        stats.sumSquared += interval*interval;
+        stats.count++;
+    }
+
+    stats.lastTime = time;
+}
@@ -0,0 +1,177 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Music streaming benchmark, many concurrent music streams
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Several music streams are played at the same time, UpdateMusicStream() time on
+*   program thread is measured and music time played is compared to program time elapsed,
+*   music played slower than real time means music streams buffers ran out of data (starving)
+*
+*   NOTE: Program thread simulates a long frame (hitch) periodically, with SUPPORT_MUSIC_STREAMING_THREAD
+*   music streams are decoded ahead by streaming thread and they should not starve on hitches,
+*   without it music streams are decoded by UpdateMusicStream() on program thread
+*
+*   NOTE: Run with --headless argument to run the benchmark on a hidden window,
+*   results are printed to standard output and program exits when finished,
+*   on systems with no audio device, miniaudio null backend is used
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_MUSICS              16      // Number of music streams played
+#define MUSIC_FILES              4      // Number of music files loaded
+#define HITCH_FRAMES            60      // Frames between simulated hitches
+#define HITCH_TIME           0.080      // Simulated hitch duration (seconds)
+#define BENCHMARK_TIME         5.0      // Benchmark duration on headless mode (seconds)
+
+// Music streaming stats, updated every frame
+typedef struct StreamingStats {
+    int frames;                         // Frames measured
+    double updateTime;                  // UpdateMusicStream() total time, all music streams (ms)
+    double updateTimeMax;               // UpdateMusicStream() maximum time per frame, all music streams (ms)
+    double elapsedTime;                 // Program time elapsed (seconds)
+    double playedTime[MAX_MUSICS];      // Music time played, accumulated (seconds)
+    float lastPlayedTime[MAX_MUSICS];   // Music time played on previous frame (seconds)
+} StreamingStats;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static double GetStarvedTime(StreamingStats *stats);    // Get music time not played, mean per music stream (seconds)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - music streaming benchmark");
+
+    InitAudioDevice();              // Initialize audio device
+
+    const char *musicFiles[MUSIC_FILES] = { "resources/country.mp3", "resources/target.ogg", "resources/target.qoa", "resources/mini1111.xm" };
+    Music musics[MAX_MUSICS] = { 0 };
+    for (int i = 0; i < MAX_MUSICS; i++)
+    {
+        musics[i] = LoadMusicStream(musicFiles[i%MUSIC_FILES]);
+        SetMusicVolume(musics[i], 1.0f/MAX_MUSICS);
+        PlayMusicStream(musics[i]);
+    }
+
+    StreamingStats stats = { 0 };
+    bool hitches = true;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) hitches = !hitches;
+
+        double startTime = GetTime();
+        for (int i = 0; i < MAX_MUSICS; i++) UpdateMusicStream(musics[i]);
+        double updateTime = (GetTime() - startTime)*1000.0;
+
+        stats.updateTime += updateTime;
+        if (updateTime > stats.updateTimeMax) stats.updateTimeMax = updateTime;
+        stats.elapsedTime += GetFrameTime();
+        stats.frames++;
+
+        // Accumulate music time played, music streams loop
+        for (int i = 0; i < MAX_MUSICS; i++)
+        {
+            float timePlayed = GetMusicTimePlayed(musics[i]);
+            float timeDelta = timePlayed - stats.lastPlayedTime[i];
+            if (timeDelta < 0.0f) timeDelta += GetMusicTimeLength(musics[i]);
+
+            stats.playedTime[i] += timeDelta;
+            stats.lastPlayedTime[i] = timePlayed;
+        }
+
+        // Simulate a long frame, i.e. loading data or a garbage collection
+        if (hitches && ((stats.frames%HITCH_FRAMES) == 0)) WaitTime(HITCH_TIME);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%i music streams playing", MAX_MUSICS), 10, 10, 20, DARKGRAY);
+
+            DrawText(TextFormat("UpdateMusicStream() time mean: %.3f ms", stats.updateTime/stats.frames), 10, 60, 20, BLACK);
+            DrawText(TextFormat("UpdateMusicStream() time max: %.3f ms", stats.updateTimeMax), 10, 90, 20, BLACK);
+            DrawText(TextFormat("Music time starved: %.3f s in %.1f s", GetStarvedTime(&stats), stats.elapsedTime), 10, 120, 20, MAROON);
+
+            for (int i = 0; i < MAX_MUSICS; i++)
+            {
+                DrawRectangle(10 + i*48, 180, 40, 12, LIGHTGRAY);
+                DrawRectangle(10 + i*48, 180, (int)(40*GetMusicTimePlayed(musics[i])/GetMusicTimeLength(musics[i])), 12, MAROON);
+            }
+
+            DrawText(TextFormat("Press SPACE to toggle simulated hitches (%.0f ms): %s", HITCH_TIME*1000.0, hitches? "ON" : "OFF"), 10, 420, 20, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+
+        if (headless && (stats.elapsedTime > BENCHMARK_TIME)) break;
+    }
+
+    if (headless)
+    {
+        printf("Music streaming benchmark: %.1f s, %i music streams, %.0f ms hitch every %i frames\n", stats.elapsedTime, MAX_MUSICS, HITCH_TIME*1000.0, HITCH_FRAMES);
+        printf("%-32s %10.3f\n", "UpdateMusicStream() mean (ms)", stats.updateTime/stats.frames);
+        printf("%-32s %10.3f\n", "UpdateMusicStream() max (ms)", stats.updateTimeMax);
+        printf("%-32s %10.3f\n", "time starved per stream (s)", GetStarvedTime(&stats));
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_MUSICS; i++) UnloadMusicStream(musics[i]);
+
+    CloseAudioDevice();     // Close audio device (music streaming is stopped automatically)
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Get music time not played, mean per music stream (seconds)
+// NOTE: Music streams buffering latency is not considered starving
+static double GetStarvedTime(StreamingStats *stats)
+{
+    double starvedTime = 0.0;
+
+    for (int i = 0; i < MAX_MUSICS; i++) starvedTime += stats->elapsedTime - stats->playedTime[i];
+
+    starvedTime /= MAX_MUSICS;
+
+    return (starvedTime > 0.0)? starvedTime : 0.0;
+}
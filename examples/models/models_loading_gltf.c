@@ -9,7 +9,7 @@
 *     - Only supports translation/rotation/scale animation channel.path,
 *       weights not considered (i.e. morph targets)
 *
-*   Example originally created with raylib 3.7, last time updated with raylib 4.2
+*   Example originally created with raylib 3.7, last time updated with raylib 5.1
 *
 *   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
 *   BSD-like license that allows static linking with closed source software
@@ -46,7 +46,9 @@ int main(void)
     // Load gltf model animations
     int animsCount = 0;
     unsigned int animIndex = 0;
-    unsigned int animCurrentFrame = 0;
+    unsigned int animPrevIndex = 0;
+    float animTime = 0.0f;              // Animation time in seconds
+    float animBlend = 1.0f;             // Blend factor from previous to current animation
     ModelAnimation *modelAnimations = LoadModelAnimations("resources/models/gltf/robot.glb", &animsCount);
 
     Vector3 position = { 0.0f, 0.0f, 0.0f };    // Set model position
@@ -62,14 +64,25 @@ int main(void)
         // Update
         //----------------------------------------------------------------------------------
         UpdateCamera(&camera, CAMERA_THIRD_PERSON);
-        // Select current animation
-        if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) animIndex = (animIndex + 1)%animsCount;
-        else if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) animIndex = (animIndex + animsCount - 1)%animsCount;
-
-        // Update model animation
+        // Select current animation, previous one is kept for blending
+        if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT) || IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+        {
+            animPrevIndex = animIndex;
+            if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) animIndex = (animIndex + 1)%animsCount;
+            else animIndex = (animIndex + animsCount - 1)%animsCount;
+            animBlend = 0.0f;
+        }
+
+        // Update model animation, interpolated at current time and
+        // cross-faded from previous animation during 0.25 seconds
         ModelAnimation anim = modelAnimations[animIndex];
-        animCurrentFrame = (animCurrentFrame + 1)%anim.frameCount;
-        UpdateModelAnimation(model, anim, animCurrentFrame);
+        animTime += GetFrameTime();
+        animBlend += GetFrameTime()/0.25f;
+        if (animBlend > 1.0f) animBlend = 1.0f;
+
+        ModelAnimation blendAnims[2] = { modelAnimations[animPrevIndex], anim };
+        float blendWeights[2] = { 1.0f - animBlend, animBlend };
+        UpdateModelAnimationEx(model, blendAnims, blendWeights, 2, animTime);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -95,6 +108,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadModel(model);         // Unload model and meshes/material
+    UnloadModelAnimations(modelAnimations, animsCount); // Unload model animations
 
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -0,0 +1,195 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Mesh vertex data compression, GPU memory saved per model
+*
+*   NOTE: Models meshes are uploaded again with UploadMeshCompressed(), vertex data is stored
+*   on GPU using compact formats, mesh CPU data is not modified:
+*
+*     - Positions > snorm16, quantized to mesh bounds (not applied to animated meshes)
+*     - Texcoords > unorm16, only if all texcoords are in [0..1] range
+*     - Normals   > snorm8 (not applied to animated meshes)
+*     - Tangents  > snorm8
+*
+*   NOTE: Vertex data compression requires OpenGL 3.3 or OpenGL ES 2.0 backend
+*
+*   NOTE: Run with --headless argument to print the report to standard output and exit
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_MODELS      32          // Maximum number of models loaded
+
+typedef struct ModelInfo {
+    Model model;                    // Model loaded, meshes compressed on GPU
+    const char *name;               // Model file name
+    int vertexCount;                // Model vertex count (all meshes)
+    int size;                       // Vertex data size uploaded to GPU (bytes)
+    int compressedSize;             // Vertex data size uploaded to GPU, compressed (bytes)
+} ModelInfo;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static int GetMeshUploadSize(Mesh mesh, unsigned int compression);  // Get mesh vertex data size uploaded to GPU (bytes)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh compression");
+
+    // Load all models available in resources and compress their meshes
+    FilePathList files = LoadDirectoryFilesEx("resources/models", ".obj;.glb;.iqm;.vox;.m3d", true);
+
+    ModelInfo infos[MAX_MODELS] = { 0 };
+    int modelCount = 0;
+
+    for (unsigned int i = 0; (i < files.count) && (modelCount < MAX_MODELS); i++)
+    {
+        ModelInfo *info = &infos[modelCount];
+
+        info->model = LoadModel(files.paths[i]);
+        if (info->model.meshCount == 0) continue;
+
+        info->name = GetFileName(files.paths[i]);
+
+        for (int m = 0; m < info->model.meshCount; m++)
+        {
+            UploadMeshCompressed(&info->model.meshes[m], MESH_COMPRESS_ALL);
+
+            info->vertexCount += info->model.meshes[m].vertexCount;
+            info->size += GetMeshUploadSize(info->model.meshes[m], 0);
+            info->compressedSize += GetMeshUploadSize(info->model.meshes[m], info->model.meshes[m].compression);
+        }
+
+        modelCount++;
+    }
+
+    int totalSize = 0;
+    int totalCompressedSize = 0;
+    for (int i = 0; i < modelCount; i++)
+    {
+        totalSize += infos[i].size;
+        totalCompressedSize += infos[i].compressedSize;
+    }
+
+    if (headless)
+    {
+        printf("%-24s %10s %12s %12s %8s\n", "model", "vertices", "size (B)", "compressed", "ratio");
+        for (int i = 0; i < modelCount; i++)
+        {
+            printf("%-24s %10i %12i %12i %7.2fx\n", infos[i].name, infos[i].vertexCount, infos[i].size, infos[i].compressedSize, (float)infos[i].size/infos[i].compressedSize);
+        }
+        printf("%-24s %10s %12i %12i %7.2fx\n", "TOTAL", "", totalSize, totalCompressedSize, (float)totalSize/totalCompressedSize);
+    }
+
+    Camera camera = { 0 };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    int selected = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!headless && !WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_DOWN)) selected = (selected + 1)%modelCount;
+        else if (IsKeyPressed(KEY_UP)) selected = (selected + modelCount - 1)%modelCount;
+
+        // Orbit camera around selected model bounds
+        BoundingBox bounds = GetModelBoundingBox(infos[selected].model);
+        float radius = Vector3Distance(bounds.min, bounds.max);
+        camera.target = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+        camera.position = Vector3Add(camera.target, (Vector3){ sinf((float)GetTime()*0.5f)*radius, radius*0.5f, cosf((float)GetTime()*0.5f)*radius });
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+                DrawModel(infos[selected].model, Vector3Zero(), 1.0f, WHITE);
+            EndMode3D();
+
+            DrawText("Model", 10, 10, 10, DARKGRAY);
+            DrawText("GPU size (KB)", 160, 10, 10, DARKGRAY);
+            DrawText("Compressed", 250, 10, 10, DARKGRAY);
+
+            for (int i = 0; i < modelCount; i++)
+            {
+                int posY = 30 + i*16;
+                Color color = (i == selected)? MAROON : BLACK;
+
+                DrawText(infos[i].name, 10, posY, 10, color);
+                DrawText(TextFormat("%.1f", infos[i].size/1024.0f), 160, posY, 10, color);
+                DrawText(TextFormat("%.1f (%.2fx)", infos[i].compressedSize/1024.0f, (float)infos[i].size/infos[i].compressedSize), 250, posY, 10, color);
+            }
+
+            DrawText(TextFormat("TOTAL: %.1f KB > %.1f KB", totalSize/1024.0f, totalCompressedSize/1024.0f), 10, 40 + modelCount*16, 10, DARKGREEN);
+            DrawText("Use UP/DOWN keys to select model", 10, screenHeight - 20, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < modelCount; i++) UnloadModel(infos[i].model);
+    UnloadDirectoryFiles(files);
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Get mesh vertex data size uploaded to GPU (bytes), for provided compression flags
+// NOTE: Compressed attributes sizes are padded to 4 bytes per vertex
+static int GetMeshUploadSize(Mesh mesh, unsigned int compression)
+{
+    int size = 0;
+
+    size += mesh.vertexCount*((compression & MESH_COMPRESS_POSITIONS)? 4*sizeof(short) : 3*sizeof(float));
+    if (mesh.texcoords != NULL) size += mesh.vertexCount*((compression & MESH_COMPRESS_TEXCOORDS)? 2*sizeof(unsigned short) : 2*sizeof(float));
+    if (mesh.normals != NULL) size += mesh.vertexCount*((compression & MESH_COMPRESS_NORMALS)? 4 : 3*sizeof(float));
+    if (mesh.tangents != NULL) size += mesh.vertexCount*((compression & MESH_COMPRESS_TANGENTS)? 4 : 4*sizeof(float));
+    if (mesh.texcoords2 != NULL) size += mesh.vertexCount*2*sizeof(float);
+    if (mesh.colors != NULL) size += mesh.vertexCount*4;
+    if (mesh.indices != NULL) size += mesh.triangleCount*3*sizeof(unsigned short);
+
+    return size;
+}
@@ -0,0 +1,231 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Mesh optimization, vertex cache efficiency report (ACMR)
+*
+*   NOTE: OptimizeMesh() welds duplicated vertices, indexes the mesh and reorders triangles
+*   and vertices for GPU post-transform vertex cache and vertex fetch locality
+*
+*   NOTE: ACMR (Average Cache Miss Ratio) is the number of vertex shader invocations per triangle,
+*   simulated with a FIFO vertex cache, lower is better: 3.0 for not indexed meshes, ~0.5 optimal
+*
+*   NOTE: Run with --headless argument to print the report to standard output and exit
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_MODELS          32      // Maximum number of models loaded
+#define FIFO_CACHE_SIZE     16      // Simulated GPU vertex cache size (FIFO)
+
+typedef struct ModelInfo {
+    Model model;                    // Model loaded, meshes optimized
+    const char *name;               // Model name
+    int vertexCount[2];             // Model vertex count (all meshes), before and after optimization
+    float acmr[2];                  // Model ACMR (all meshes), before and after optimization
+} ModelInfo;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static int GetMeshCacheMisses(Mesh mesh);   // Get mesh vertex cache misses, simulating a FIFO cache
+static void OptimizeModelInfo(ModelInfo *info);   // Optimize model meshes, registering ACMR before and after
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh optimization");
+
+    ModelInfo infos[MAX_MODELS] = { 0 };
+    int modelCount = 0;
+
+    // Generated meshes, some of them not indexed
+    Image cubicmap = LoadImage("resources/cubicmap.png");
+    Image heightmap = LoadImage("resources/heightmap.png");
+
+    infos[modelCount].name = "GenMeshCubicmap()";
+    infos[modelCount++].model = LoadModelFromMesh(GenMeshCubicmap(cubicmap, (Vector3){ 1.0f, 1.0f, 1.0f }));
+    infos[modelCount].name = "GenMeshHeightmap()";
+    infos[modelCount++].model = LoadModelFromMesh(GenMeshHeightmap(heightmap, (Vector3){ 16.0f, 8.0f, 16.0f }));
+    infos[modelCount].name = "GenMeshSphere()";
+    infos[modelCount++].model = LoadModelFromMesh(GenMeshSphere(1.0f, 32, 32));
+    infos[modelCount].name = "GenMeshKnot()";
+    infos[modelCount++].model = LoadModelFromMesh(GenMeshKnot(1.0f, 2.0f, 64, 128));
+
+    UnloadImage(cubicmap);
+    UnloadImage(heightmap);
+
+    // Models available in resources
+    FilePathList files = LoadDirectoryFilesEx("resources/models", ".obj;.glb;.iqm;.vox;.m3d", true);
+
+    for (unsigned int i = 0; (i < files.count) && (modelCount < MAX_MODELS); i++)
+    {
+        Model model = LoadModel(files.paths[i]);
+
+        if (model.meshCount > 0)
+        {
+            infos[modelCount].name = GetFileName(files.paths[i]);
+            infos[modelCount].model = model;
+            modelCount++;
+        }
+        else UnloadModel(model);    // Animations only file
+    }
+
+    for (int i = 0; i < modelCount; i++) OptimizeModelInfo(&infos[i]);
+
+    if (headless)
+    {
+        printf("%-24s %10s %10s %8s %8s\n", "model", "vertices", "optimized", "ACMR", "ACMR opt");
+        for (int i = 0; i < modelCount; i++)
+        {
+            printf("%-24s %10i %10i %8.3f %8.3f\n", infos[i].name, infos[i].vertexCount[0], infos[i].vertexCount[1], infos[i].acmr[0], infos[i].acmr[1]);
+        }
+    }
+
+    Camera camera = { 0 };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    int selected = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!headless && !WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_DOWN)) selected = (selected + 1)%modelCount;
+        else if (IsKeyPressed(KEY_UP)) selected = (selected + modelCount - 1)%modelCount;
+
+        // Orbit camera around selected model bounds
+        BoundingBox bounds = GetModelBoundingBox(infos[selected].model);
+        float radius = Vector3Distance(bounds.min, bounds.max);
+        camera.target = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+        camera.position = Vector3Add(camera.target, (Vector3){ sinf((float)GetTime()*0.5f)*radius, radius*0.5f, cosf((float)GetTime()*0.5f)*radius });
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+                DrawModel(infos[selected].model, Vector3Zero(), 1.0f, WHITE);
+                DrawModelWires(infos[selected].model, Vector3Zero(), 1.0f, Fade(DARKGRAY, 0.2f));
+            EndMode3D();
+
+            DrawText("Model", 10, 10, 10, DARKGRAY);
+            DrawText("Vertices", 160, 10, 10, DARKGRAY);
+            DrawText("ACMR", 270, 10, 10, DARKGRAY);
+
+            for (int i = 0; i < modelCount; i++)
+            {
+                int posY = 30 + i*14;
+                Color color = (i == selected)? MAROON : BLACK;
+
+                DrawText(infos[i].name, 10, posY, 10, color);
+                DrawText(TextFormat("%i > %i", infos[i].vertexCount[0], infos[i].vertexCount[1]), 160, posY, 10, color);
+                DrawText(TextFormat("%.3f > %.3f", infos[i].acmr[0], infos[i].acmr[1]), 270, posY, 10, color);
+            }
+
+            DrawText("Use UP/DOWN keys to select model", 10, screenHeight - 20, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < modelCount; i++) UnloadModel(infos[i].model);
+    UnloadDirectoryFiles(files);
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Get mesh vertex cache misses (vertex shader invocations), simulating a FIFO cache
+// NOTE: Not indexed meshes do not use vertex cache, every vertex is processed
+static int GetMeshCacheMisses(Mesh mesh)
+{
+    if (mesh.indices == NULL) return mesh.triangleCount*3;
+
+    int cache[FIFO_CACHE_SIZE] = { 0 };
+    for (int i = 0; i < FIFO_CACHE_SIZE; i++) cache[i] = -1;
+
+    int cacheNext = 0;
+    int misses = 0;
+
+    for (int i = 0; i < mesh.triangleCount*3; i++)
+    {
+        bool hit = false;
+        for (int j = 0; j < FIFO_CACHE_SIZE; j++) if (cache[j] == mesh.indices[i]) hit = true;
+
+        if (!hit)
+        {
+            cache[cacheNext] = mesh.indices[i];
+            cacheNext = (cacheNext + 1)%FIFO_CACHE_SIZE;
+            misses++;
+        }
+    }
+
+    return misses;
+}
+
+// Optimize model meshes, registering vertex count and ACMR before and after
+static void OptimizeModelInfo(ModelInfo *info)
+{
+    int triangleCount = 0;
+    int misses[2] = { 0 };
+
+    for (int m = 0; m < info->model.meshCount; m++)
+    {
+        Mesh *mesh = &info->model.meshes[m];
+
+        triangleCount += mesh->triangleCount;
+        info->vertexCount[0] += mesh->vertexCount;
+        misses[0] += GetMeshCacheMisses(*mesh);
+
+        OptimizeMesh(mesh);
+
+        info->vertexCount[1] += mesh->vertexCount;
+        misses[1] += GetMeshCacheMisses(*mesh);
+    }
+
+    if (triangleCount > 0)
+    {
+        info->acmr[0] = (float)misses[0]/triangleCount;
+        info->acmr[1] = (float)misses[1]/triangleCount;
+    }
+}
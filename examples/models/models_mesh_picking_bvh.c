@@ -0,0 +1,173 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Mesh picking accelerated with a bounding volume hierarchy (BVH)
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#define MESH_SIZES          5       // Number of mesh sizes benchmarked
+#define BENCHMARK_RAYS    500       // Number of rays cast per mesh and method
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh picking bvh");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 6.0f, 4.0f, 6.0f };    // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };      // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };          // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;             // Camera projection type
+
+    // Generate meshes of increasing triangle count, building a BVH for every one of them
+    // NOTE: BVH is built once per mesh, in mesh space, it can be reused with any transform
+    const int resolutions[MESH_SIZES] = { 16, 32, 64, 128, 256 };
+    Mesh meshes[MESH_SIZES] = { 0 };
+    MeshBVH bvhs[MESH_SIZES] = { 0 };
+    double buildTimes[MESH_SIZES] = { 0 };
+
+    for (int i = 0; i < MESH_SIZES; i++)
+    {
+        meshes[i] = GenMeshSphere(2.0f, resolutions[i], resolutions[i]);
+
+        double startTime = GetTime();
+        bvhs[i] = BuildMeshBVH(meshes[i]);
+        buildTimes[i] = GetTime() - startTime;
+    }
+
+    Model model = LoadModelFromMesh(meshes[MESH_SIZES - 1]);
+    Matrix transform = MatrixMultiply(MatrixScale(1.0f, 0.75f, 1.0f), MatrixRotateY(0.5f));
+    model.transform = transform;
+
+    double bruteTimes[MESH_SIZES] = { 0 };
+    double bvhTimes[MESH_SIZES] = { 0 };
+    bool runBenchmark = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) runBenchmark = true;
+
+        if (runBenchmark)
+        {
+            // Cast the same set of rays against every mesh with both methods
+            for (int i = 0; i < MESH_SIZES; i++)
+            {
+                SetRandomSeed(i);
+                double startTime = GetTime();
+
+                for (int r = 0; r < BENCHMARK_RAYS; r++)
+                {
+                    Vector3 origin = { (float)GetRandomValue(-100, 100)/10.0f, (float)GetRandomValue(-100, 100)/10.0f, 10.0f };
+                    Ray ray = { origin, Vector3Normalize(Vector3Negate(origin)) };
+                    GetRayCollisionMesh(ray, meshes[i], transform);
+                }
+
+                bruteTimes[i] = (GetTime() - startTime)*1000.0/BENCHMARK_RAYS;
+
+                SetRandomSeed(i);
+                startTime = GetTime();
+
+                for (int r = 0; r < BENCHMARK_RAYS; r++)
+                {
+                    Vector3 origin = { (float)GetRandomValue(-100, 100)/10.0f, (float)GetRandomValue(-100, 100)/10.0f, 10.0f };
+                    Ray ray = { origin, Vector3Normalize(Vector3Negate(origin)) };
+                    GetRayCollisionMeshBVH(ray, meshes[i], bvhs[i], transform);
+                }
+
+                bvhTimes[i] = (GetTime() - startTime)*1000.0/BENCHMARK_RAYS;
+            }
+
+            runBenchmark = false;
+        }
+
+        // Pick the biggest mesh with the mouse, using its BVH
+        Ray ray = GetScreenToWorldRay(GetMousePosition(), camera);
+        RayCollision collision = GetRayCollisionMeshBVH(ray, meshes[MESH_SIZES - 1], bvhs[MESH_SIZES - 1], transform);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                DrawModelWires(model, Vector3Zero(), 1.0f, LIGHTGRAY);
+
+                // If we hit the mesh, draw the cursor at the hit point
+                if (collision.hit)
+                {
+                    DrawCube(collision.point, 0.1f, 0.1f, 0.1f, ORANGE);
+                    DrawLine3D(collision.point, Vector3Add(collision.point, collision.normal), RED);
+                }
+
+                DrawGrid(10, 1.0f);
+
+            EndMode3D();
+
+            // Draw benchmark results, average time per ray
+            DrawText("Triangles", 10, 40, 10, DARKGRAY);
+            DrawText("Build (ms)", 110, 40, 10, DARKGRAY);
+            DrawText("Brute (ms/ray)", 200, 40, 10, DARKGRAY);
+            DrawText("BVH (ms/ray)", 310, 40, 10, DARKGRAY);
+
+            for (int i = 0; i < MESH_SIZES; i++)
+            {
+                int posY = 60 + i*20;
+
+                DrawText(TextFormat("%i", meshes[i].triangleCount), 10, posY, 10, BLACK);
+                DrawText(TextFormat("%.3f", buildTimes[i]*1000.0), 110, posY, 10, BLACK);
+                DrawText(TextFormat("%.4f", bruteTimes[i]), 200, posY, 10, MAROON);
+                DrawText(TextFormat("%.4f", bvhTimes[i]), 310, posY, 10, DARKGREEN);
+            }
+
+            if (collision.hit) DrawText(TextFormat("Hit distance: %3.2f", collision.distance), 10, 170, 10, BLACK);
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MESH_SIZES; i++)
+    {
+        UnloadMeshBVH(bvhs[i]);
+        if (i < (MESH_SIZES - 1)) UnloadMesh(meshes[i]);
+    }
+
+    UnloadModel(model);         // Unload model (including last mesh)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Skinning benchmark, UpdateModelAnimation() time and accuracy check
+*
+*   NOTE: UpdateModelAnimation() precomputes one skinning matrix per bone and skins vertices with
+*   SIMD multiply-add (SSE2/NEON), big meshes are split in parallel jobs, animated vertices and
+*   normals are compared with a reference skinning (bone transformations applied per vertex influence)
+*
+*   NOTE: Run with --headless argument to print the report to standard output and exit,
+*   program returns an error code if any model exceeds the error tolerance
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <math.h>           // Required for: fabsf()
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_MODELS               2      // Number of animated models tested
+#define UPDATE_ITERATIONS      200      // UpdateModelAnimation() calls measured per model
+#define ERROR_TOLERANCE       1e-4f     // Maximum error allowed, relative to model size
+
+typedef struct SkinningResult {
+    const char *name;               // Model name
+    int vertexCount;                // Model vertex count (all meshes)
+    int boneCount;                  // Model bone count
+    float positionError;            // Maximum position error, relative to model size
+    float normalError;              // Maximum normal error
+    double updateTime;              // UpdateModelAnimation() mean time (ms)
+    double referenceTime;           // Reference skinning mean time (ms)
+} SkinningResult;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void SkinMeshReference(Model model, ModelAnimation anim, int frame, int meshIndex, float *vertices, float *normals);   // Skin mesh vertices, bone transformation applied per vertex influence
+static void TestModelSkinning(Model model, ModelAnimation anim, SkinningResult *result);    // Measure model skinning time and error
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - skinning benchmark");
+
+    const char *modelFiles[MAX_MODELS] = { "resources/models/gltf/robot.glb", "resources/models/iqm/guy.iqm" };
+    const char *animFiles[MAX_MODELS] = { "resources/models/gltf/robot.glb", "resources/models/iqm/guyanim.iqm" };
+
+    Model models[MAX_MODELS] = { 0 };
+    ModelAnimation *anims[MAX_MODELS] = { 0 };
+    int animCounts[MAX_MODELS] = { 0 };
+    SkinningResult results[MAX_MODELS] = { 0 };
+    bool passed = true;
+
+    for (int i = 0; i < MAX_MODELS; i++)
+    {
+        models[i] = LoadModel(modelFiles[i]);
+        anims[i] = LoadModelAnimations(animFiles[i], &animCounts[i]);
+        results[i].name = GetFileName(modelFiles[i]);
+
+        if (animCounts[i] > 0) TestModelSkinning(models[i], anims[i][0], &results[i]);
+        if ((results[i].positionError > ERROR_TOLERANCE) || (results[i].normalError > ERROR_TOLERANCE)) passed = false;
+    }
+
+    if (headless)
+    {
+        printf("Skinning benchmark: %i updates per model, %i parallel job workers, error tolerance %g\n", UPDATE_ITERATIONS, GetParallelJobWorkers(), ERROR_TOLERANCE);
+        printf("%-12s %10s %6s %14s %14s %12s %14s\n", "model", "vertices", "bones", "position error", "normal error", "update (ms)", "reference (ms)");
+        for (int i = 0; i < MAX_MODELS; i++)
+        {
+            printf("%-12s %10i %6i %14.3e %14.3e %12.4f %14.4f\n", results[i].name, results[i].vertexCount, results[i].boneCount,
+                results[i].positionError, results[i].normalError, results[i].updateTime, results[i].referenceTime);
+        }
+        printf("Skinning accuracy: %s\n", passed? "PASSED" : "FAILED");
+    }
+
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 8.0f, 8.0f, 8.0f };
+    camera.target = (Vector3){ 0.0f, 2.0f, 0.0f };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    int frame = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!headless && !WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        frame++;
+        if (animCounts[0] > 0) UpdateModelAnimation(models[0], anims[0][0], frame);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+                DrawModel(models[0], Vector3Zero(), 1.0f, WHITE);
+                DrawGrid(10, 1.0f);
+            EndMode3D();
+
+            DrawText("Model", 10, 10, 10, DARKGRAY);
+            DrawText("Position error", 120, 10, 10, DARKGRAY);
+            DrawText("Normal error", 240, 10, 10, DARKGRAY);
+            DrawText("Update (ms)", 360, 10, 10, DARKGRAY);
+            DrawText("Reference (ms)", 460, 10, 10, DARKGRAY);
+
+            for (int i = 0; i < MAX_MODELS; i++)
+            {
+                int posY = 30 + i*14;
+
+                DrawText(results[i].name, 10, posY, 10, BLACK);
+                DrawText(TextFormat("%.3e", results[i].positionError), 120, posY, 10, BLACK);
+                DrawText(TextFormat("%.3e", results[i].normalError), 240, posY, 10, BLACK);
+                DrawText(TextFormat("%.4f", results[i].updateTime), 360, posY, 10, BLACK);
+                DrawText(TextFormat("%.4f", results[i].referenceTime), 460, posY, 10, BLACK);
+            }
+
+            DrawText(passed? "Skinning accuracy: PASSED" : "Skinning accuracy: FAILED", 10, 70, 20, passed? DARKGREEN : MAROON);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_MODELS; i++)
+    {
+        UnloadModelAnimations(anims[i], animCounts[i]);
+        UnloadModel(models[i]);
+    }
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return passed? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Skin mesh vertices, bone transformation applied per vertex influence
+// NOTE: Same transformation previously used by UpdateModelAnimation(), used as reference
+static void SkinMeshReference(Model model, ModelAnimation anim, int frame, int meshIndex, float *vertices, float *normals)
+{
+    Mesh mesh = model.meshes[meshIndex];
+
+    for (int v = 0; v < mesh.vertexCount; v++)
+    {
+        Vector3 animVertex = { 0 };
+        Vector3 animNormal = { 0 };
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            float boneWeight = mesh.boneWeights[v*4 + j];
+            if (boneWeight == 0.0f) continue;
+
+            int boneId = mesh.boneIds[v*4 + j];
+            Transform bind = model.bindPose[boneId];
+            Transform pose = anim.framePoses[frame][boneId];
+            Quaternion rotation = QuaternionMultiply(pose.rotation, QuaternionInvert(bind.rotation));
+
+            Vector3 vertex = { mesh.vertices[v*3], mesh.vertices[v*3 + 1], mesh.vertices[v*3 + 2] };
+            vertex = Vector3Add(Vector3RotateByQuaternion(Vector3Multiply(Vector3Subtract(vertex, bind.translation), pose.scale), rotation), pose.translation);
+            animVertex = Vector3Add(animVertex, Vector3Scale(vertex, boneWeight));
+
+            if (mesh.normals != NULL)
+            {
+                Vector3 normal = { mesh.normals[v*3], mesh.normals[v*3 + 1], mesh.normals[v*3 + 2] };
+                animNormal = Vector3Add(animNormal, Vector3Scale(Vector3RotateByQuaternion(normal, rotation), boneWeight));
+            }
+        }
+
+        vertices[v*3] = animVertex.x;
+        vertices[v*3 + 1] = animVertex.y;
+        vertices[v*3 + 2] = animVertex.z;
+
+        normals[v*3] = animNormal.x;
+        normals[v*3 + 1] = animNormal.y;
+        normals[v*3 + 2] = animNormal.z;
+    }
+}
+
+// Measure model skinning time and maximum error, all animation frames are checked
+static void TestModelSkinning(Model model, ModelAnimation anim, SkinningResult *result)
+{
+    BoundingBox bounds = GetModelBoundingBox(model);
+    float size = Vector3Distance(bounds.min, bounds.max);
+    if (size <= 0.0f) size = 1.0f;
+
+    result->boneCount = model.boneCount;
+    for (int m = 0; m < model.meshCount; m++) result->vertexCount += model.meshes[m].vertexCount;
+
+    float *vertices = (float *)malloc(result->vertexCount*3*sizeof(float));
+    float *normals = (float *)malloc(result->vertexCount*3*sizeof(float));
+
+    // Accuracy, all animation frames compared with reference skinning
+    for (int frame = 0; frame < anim.frameCount; frame++)
+    {
+        UpdateModelAnimation(model, anim, frame);
+
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            Mesh mesh = model.meshes[m];
+            if ((mesh.boneIds == NULL) || (mesh.boneWeights == NULL) || (mesh.animVertices == NULL)) continue;
+
+            SkinMeshReference(model, anim, frame, m, vertices, normals);
+
+            for (int i = 0; i < mesh.vertexCount*3; i++)
+            {
+                float positionError = fabsf(mesh.animVertices[i] - vertices[i])/size;
+                if (positionError > result->positionError) result->positionError = positionError;
+
+                if (mesh.animNormals != NULL)
+                {
+                    float normalError = fabsf(mesh.animNormals[i] - normals[i]);
+                    if (normalError > result->normalError) result->normalError = normalError;
+                }
+            }
+        }
+    }
+
+    // Timing, UpdateModelAnimation() includes vertex buffers upload
+    double startTime = GetTime();
+    for (int i = 0; i < UPDATE_ITERATIONS; i++) UpdateModelAnimation(model, anim, i);
+    result->updateTime = (GetTime() - startTime)*1000.0/UPDATE_ITERATIONS;
+
+    startTime = GetTime();
+    for (int i = 0; i < UPDATE_ITERATIONS; i++)
+    {
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            if ((model.meshes[m].boneIds == NULL) || (model.meshes[m].boneWeights == NULL)) continue;
+            SkinMeshReference(model, anim, i%anim.frameCount, m, vertices, normals);
+        }
+    }
+    result->referenceTime = (GetTime() - startTime)*1000.0/UPDATE_ITERATIONS;
+
+    free(vertices);
+    free(normals);
+}
@@ -0,0 +1,221 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - raymath batch functions benchmark
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Batch functions (arrays processing) are compared against equivalent scalar loops
+*   calling per element raymath functions, SIMD code paths depend on compilation target
+*
+*   NOTE: Run with --headless argument to run the benchmark on a hidden window,
+*   results are printed to standard output and program exits when finished
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_POINTS      1000000     // Number of points processed by vector functions
+#define MAX_MATRICES     100000     // Number of matrices processed by matrix functions
+#define BENCHMARK_RUNS       20     // Number of runs measured per function
+#define BENCHMARK_TESTS       5     // Number of functions benchmarked
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void RunBenchmark(double *scalarTimes, double *batchTimes);   // Run all tests, times per run (ms)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [others] example - raymath batch benchmark");
+
+    const char *testNames[BENCHMARK_TESTS] = {
+        "Vector3TransformArray()", "Vector3TransformNormalArray()", "Vector3NormalizeArray()",
+        "Vector3MinMaxArray()", "MatrixMultiplyArray()"
+    };
+
+    double scalarTimes[BENCHMARK_TESTS] = { 0 };    // Scalar loops time per run (ms)
+    double batchTimes[BENCHMARK_TESTS] = { 0 };     // Batch functions time per run (ms)
+
+    RunBenchmark(scalarTimes, batchTimes);
+
+    if (headless)
+    {
+        printf("raymath functions time per run (ms), %i points, %i matrices, %i runs\n", MAX_POINTS, MAX_MATRICES, BENCHMARK_RUNS);
+        printf("%-32s %10s %10s %8s\n", "function", "scalar", "batch", "speedup");
+        for (int i = 0; i < BENCHMARK_TESTS; i++)
+        {
+            printf("%-32s %10.3f %10.3f %7.2fx\n", testNames[i], scalarTimes[i], batchTimes[i], scalarTimes[i]/batchTimes[i]);
+        }
+
+        CloseWindow();
+        return 0;
+    }
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) RunBenchmark(scalarTimes, batchTimes);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%i points, %i matrices, time per run (ms): scalar loop vs batch function", MAX_POINTS, MAX_MATRICES), 10, 10, 10, DARKGRAY);
+
+            for (int i = 0; i < BENCHMARK_TESTS; i++)
+            {
+                int posY = 40 + i*70;
+                float maxTime = (float)fmax(scalarTimes[i], batchTimes[i]);
+
+                DrawText(testNames[i], 10, posY, 20, BLACK);
+                DrawRectangle(10, posY + 25, (int)(500*scalarTimes[i]/maxTime), 14, GRAY);
+                DrawRectangle(10, posY + 41, (int)(500*batchTimes[i]/maxTime), 14, MAROON);
+                DrawText(TextFormat("%.3f", scalarTimes[i]), 520, posY + 27, 10, GRAY);
+                DrawText(TextFormat("%.3f (%.2fx)", batchTimes[i], scalarTimes[i]/batchTimes[i]), 520, posY + 43, 10, MAROON);
+            }
+
+            DrawText("Press SPACE to run the benchmark again", 10, 420, 20, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Run all tests, scalar loops and batch functions, times per run (ms)
+static void RunBenchmark(double *scalarTimes, double *batchTimes)
+{
+    Vector3 *points = (Vector3 *)malloc(MAX_POINTS*sizeof(Vector3));
+    Vector3 *results = (Vector3 *)malloc(MAX_POINTS*sizeof(Vector3));
+    Matrix *matrices = (Matrix *)malloc(MAX_MATRICES*sizeof(Matrix));
+    Matrix *matResults = (Matrix *)malloc(MAX_MATRICES*sizeof(Matrix));
+
+    for (int i = 0; i < MAX_POINTS; i++) points[i] = (Vector3){ (float)GetRandomValue(-1000, 1000)/10.0f, (float)GetRandomValue(-1000, 1000)/10.0f, (float)GetRandomValue(-1000, 1000)/10.0f };
+    for (int i = 0; i < MAX_MATRICES; i++) matrices[i] = MatrixMultiply(MatrixRotateXYZ(points[i]), MatrixTranslate(points[i].z, points[i].x, points[i].y));
+
+    Matrix transform = MatrixMultiply(MatrixMultiply(MatrixScale(2.0f, 2.0f, 2.0f), MatrixRotateXYZ((Vector3){ 0.3f, 0.6f, 0.9f })), MatrixTranslate(10.0f, -5.0f, 2.0f));
+    Vector3 min = { 0 };
+    Vector3 max = { 0 };
+    Vector3 scalarMin = { 0 };
+    Vector3 scalarMax = { 0 };
+
+    for (int i = 0; i < BENCHMARK_TESTS; i++)
+    {
+        scalarTimes[i] = 0.0;
+        batchTimes[i] = 0.0;
+    }
+
+    for (int run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        // Vector3TransformArray() vs Vector3Transform()
+        double startTime = GetTime();
+        for (int i = 0; i < MAX_POINTS; i++) results[i] = Vector3Transform(points[i], transform);
+        scalarTimes[0] += (GetTime() - startTime)*1000.0;
+
+        startTime = GetTime();
+        Vector3TransformArray(results, points, MAX_POINTS, transform);
+        batchTimes[0] += (GetTime() - startTime)*1000.0;
+
+        // Vector3TransformNormalArray() vs matrix rotation + Vector3Normalize()
+        startTime = GetTime();
+        for (int i = 0; i < MAX_POINTS; i++)
+        {
+            Vector3 n = points[i];
+            results[i] = Vector3Normalize((Vector3){ transform.m0*n.x + transform.m4*n.y + transform.m8*n.z,
+                transform.m1*n.x + transform.m5*n.y + transform.m9*n.z, transform.m2*n.x + transform.m6*n.y + transform.m10*n.z });
+        }
+        scalarTimes[1] += (GetTime() - startTime)*1000.0;
+
+        startTime = GetTime();
+        Vector3TransformNormalArray(results, points, MAX_POINTS, transform);
+        batchTimes[1] += (GetTime() - startTime)*1000.0;
+
+        // Vector3NormalizeArray() vs Vector3Normalize()
+        startTime = GetTime();
+        for (int i = 0; i < MAX_POINTS; i++) results[i] = Vector3Normalize(points[i]);
+        scalarTimes[2] += (GetTime() - startTime)*1000.0;
+
+        startTime = GetTime();
+        Vector3NormalizeArray(results, points, MAX_POINTS);
+        batchTimes[2] += (GetTime() - startTime)*1000.0;
+
+        // Vector3MinMaxArray() vs Vector3Min() + Vector3Max()
+        startTime = GetTime();
+        scalarMin = points[0];
+        scalarMax = points[0];
+        for (int i = 1; i < MAX_POINTS; i++)
+        {
+            scalarMin = Vector3Min(scalarMin, points[i]);
+            scalarMax = Vector3Max(scalarMax, points[i]);
+        }
+        scalarTimes[3] += (GetTime() - startTime)*1000.0;
+
+        startTime = GetTime();
+        Vector3MinMaxArray(points, MAX_POINTS, &min, &max);
+        batchTimes[3] += (GetTime() - startTime)*1000.0;
+
+        // MatrixMultiplyArray() vs MatrixMultiply()
+        startTime = GetTime();
+        for (int i = 0; i < MAX_MATRICES; i++) matResults[i] = MatrixMultiply(matrices[i], transform);
+        scalarTimes[4] += (GetTime() - startTime)*1000.0;
+
+        startTime = GetTime();
+        MatrixMultiplyArray(matResults, matrices, MAX_MATRICES, transform);
+        batchTimes[4] += (GetTime() - startTime)*1000.0;
+    }
+
+    for (int i = 0; i < BENCHMARK_TESTS; i++)
+    {
+        scalarTimes[i] /= BENCHMARK_RUNS;
+        batchTimes[i] /= BENCHMARK_RUNS;
+    }
+
+    // Avoid results being optimized out
+    TraceLog(LOG_DEBUG, "BENCHMARK: Results check: %f %f %f %f %f %f", results[0].x, matResults[0].m0, min.x, max.x, scalarMin.x, scalarMax.x);
+
+    free(points);
+    free(results);
+    free(matrices);
+    free(matResults);
+}
@@ -0,0 +1,21 @@
+#version 330
+
+// Input fragment attributes (from vertex shader)
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+// Input uniform values
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+uniform vec4 tint;
+
+// Output fragment color
+out vec4 finalColor;
+
+void main()
+{
+    // Texel color fetching from texture sampler, multiplied by tint uniform
+    vec4 texelColor = texture(texture0, fragTexCoord);
+
+    finalColor = texelColor*colDiffuse*fragColor*tint;
+}
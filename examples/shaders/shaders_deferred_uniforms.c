@@ -0,0 +1,112 @@
+/*******************************************************************************************
+*
+*   raylib [shaders] example - deferred draw mode uniforms
+*
+*   Example demonstrates setting a shader uniform between draws using the same shader
+*   while rlgl deferred draw mode is enabled: draws are sorted by state and merged,
+*   draws recorded before a uniform change keep using the previous uniform value
+*
+*   NOTE: This example requires raylib OpenGL 3.3 or ES2 versions for shaders support,
+*         OpenGL 1.1 does not support shaders, recompile raylib to OpenGL 3.3 version.
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#define MAX_TINTS       4
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shaders] example - deferred draw mode uniforms");
+
+    // Load shader multiplying fragments color by a tint uniform
+    // NOTE: Defining 0 (NULL) for vertex shader forces usage of internal default vertex shader
+    Shader shader = LoadShader(0, TextFormat("resources/shaders/glsl%i/color_tint.fs", GLSL_VERSION));
+    int tintLoc = GetShaderLocation(shader, "tint");
+
+    const float tints[MAX_TINTS][4] = {
+        { 1.0f, 0.2f, 0.2f, 1.0f },
+        { 0.2f, 1.0f, 0.2f, 1.0f },
+        { 0.2f, 0.2f, 1.0f, 1.0f },
+        { 1.0f, 1.0f, 0.2f, 1.0f }
+    };
+
+    bool deferred = true;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) deferred = !deferred;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (deferred) rlEnableDeferredDraw();
+
+            for (int i = 0; i < MAX_TINTS; i++)
+            {
+                // Tint uniform changes between draws using the same shader, every rectangle
+                // must keep its own tint, also when draws are sorted and merged
+                SetShaderValue(shader, tintLoc, tints[i], SHADER_UNIFORM_VEC4);
+
+                BeginShaderMode(shader);
+                    DrawRectangle(40 + i*185, 120, 165, 165, WHITE);
+                EndShaderMode();
+
+                // Draws with default shader between them, sorted apart on deferred draw mode
+                DrawRectangleLines(40 + i*185, 120, 165, 165, DARKGRAY);
+                DrawText(TextFormat("TINT %i", i), 50 + i*185, 300, 20, DARKGRAY);
+            }
+
+            if (deferred) rlDisableDeferredDraw();
+
+            DrawText("Rectangles drawn with the same shader, tint uniform set before each one", 40, 40, 20, DARKGRAY);
+            DrawText(TextFormat("Press SPACE to toggle deferred draw mode: %s", deferred? "ON" : "OFF"), 40, 380, 20, deferred? MAROON : DARKGRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadShader(shader);           // Unload shader
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Dynamic font loading, glyphs rasterized on first use
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stddef.h>         // Required for: NULL
+
+#define MAX_LOG_LINES       16          // Number of chat log lines displayed
+#define LINE_CODEPOINTS     32          // Number of codepoints per chat log line
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font dynamic");
+
+    // Load font for dynamic glyphs rasterization, no codepoints required up front
+    // NOTE: Atlas grows as required up to 512 KB, least recently used glyphs are evicted once full
+    Font font = LoadFontDynamic("resources/DotGothic16-Regular.ttf", 20, 512*1024);
+
+    // Chat log lines, filled with random kana and CJK ideographs
+    char *lines[MAX_LOG_LINES] = { 0 };
+    int codepoints[LINE_CODEPOINTS] = { 0 };
+    float lineTimer = 0.0f;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        lineTimer += GetFrameTime();
+
+        if ((lineTimer > 0.25f) || IsKeyDown(KEY_SPACE))
+        {
+            // Scroll chat log and add a new line
+            UnloadUTF8(lines[0]);
+            for (int i = 0; i < MAX_LOG_LINES - 1; i++) lines[i] = lines[i + 1];
+
+            for (int i = 0; i < LINE_CODEPOINTS; i++)
+            {
+                if (GetRandomValue(0, 3) == 0) codepoints[i] = GetRandomValue(0x3041, 0x3096);  // Hiragana
+                else codepoints[i] = GetRandomValue(0x4e00, 0x6fff);                            // CJK ideographs
+            }
+
+            lines[MAX_LOG_LINES - 1] = LoadUTF8(codepoints, LINE_CODEPOINTS);
+            lineTimer = 0.0f;
+        }
+
+        // Update font atlas texture and glyph count, atlas could have been recreated on last frame glyphs loading
+        UpdateFontDynamic(&font);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Glyphs not yet available are rasterized and uploaded to the atlas when drawn
+            for (int i = 0; i < MAX_LOG_LINES; i++)
+            {
+                if (lines[i] != NULL) DrawTextEx(font, lines[i], (Vector2){ 20, 60.0f + i*22 }, (float)font.baseSize, 2, DARKGRAY);
+            }
+
+            DrawText("Glyphs are rasterized on first use, press SPACE to add lines faster", 20, 30, 10, GRAY);
+            DrawText(TextFormat("Glyphs loaded: %i | Atlas: %ix%i", font.glyphCount, font.texture.width, font.texture.height), 20, 42, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_LOG_LINES; i++) UnloadUTF8(lines[i]);
+
+    UnloadFont(font);           // Unload dynamic font (atlas and font file data included)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Font loading benchmark, glyphs rasterization on parallel jobs
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define GLYPH_COUNTS        3       // Number of glyph counts benchmarked
+#define FONT_TYPES          3       // Number of font types benchmarked
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font loading benchmark");
+
+    // Font file data is loaded once, only glyphs rasterization and atlas packing is measured
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData("resources/DotGothic16-Regular.ttf", &dataSize);
+
+    // Codepoints: ASCII + CJK unified ideographs
+    const int glyphCounts[GLYPH_COUNTS] = { 95, 1000, 4000 };
+    int *codepoints = (int *)malloc(glyphCounts[GLYPH_COUNTS - 1]*sizeof(int));
+    for (int i = 0; i < glyphCounts[GLYPH_COUNTS - 1]; i++) codepoints[i] = (i < 95)? (32 + i) : (0x4e00 + i - 95);
+
+    const int fontTypes[FONT_TYPES] = { FONT_DEFAULT, FONT_SDF, FONT_BITMAP };
+    const char *fontTypeNames[FONT_TYPES] = { "FONT_DEFAULT", "FONT_SDF", "FONT_BITMAP" };
+
+    const int maxWorkers = GetParallelJobWorkers();
+
+    double loadTimes[2][FONT_TYPES][GLYPH_COUNTS] = { 0 };     // Glyphs rasterization times: single worker, all workers
+    double atlasTimes[FONT_TYPES][GLYPH_COUNTS] = { 0 };       // Atlas packing times
+    int framesCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) framesCounter = 0;
+
+        // NOTE: Benchmark is run on second frame, first frame displays the running message
+        if (framesCounter == 1)
+        {
+            for (int t = 0; t < FONT_TYPES; t++)
+            {
+                for (int g = 0; g < GLYPH_COUNTS; g++)
+                {
+                    for (int w = 0; w < 2; w++)
+                    {
+                        SetParallelJobWorkers((w == 0)? 1 : maxWorkers);
+
+                        double startTime = GetTime();
+                        GlyphInfo *glyphs = LoadFontData(fileData, dataSize, 32, codepoints, glyphCounts[g], fontTypes[t]);
+                        loadTimes[w][t][g] = (GetTime() - startTime)*1000.0;
+
+                        if (w == 1)
+                        {
+                            Rectangle *recs = NULL;
+                            startTime = GetTime();
+                            Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCounts[g], 32, 4, 0);
+                            atlasTimes[t][g] = (GetTime() - startTime)*1000.0;
+
+                            UnloadImage(atlas);
+                            MemFree(recs);
+                        }
+
+                        UnloadFontData(glyphs, glyphCounts[g]);
+                    }
+                }
+            }
+
+            SetParallelJobWorkers(maxWorkers);
+        }
+
+        framesCounter++;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (framesCounter <= 1) DrawText("Running benchmark...", 10, 40, 20, MAROON);
+            else
+            {
+                DrawText(TextFormat("LoadFontData() and GenImageFontAtlas() times (ms), 32 px, %i workers", maxWorkers), 10, 40, 10, DARKGRAY);
+                DrawText("Type", 10, 60, 10, DARKGRAY);
+                DrawText("Glyphs", 130, 60, 10, DARKGRAY);
+                DrawText("1 worker", 210, 60, 10, DARKGRAY);
+                DrawText(TextFormat("%i workers", maxWorkers), 310, 60, 10, DARKGRAY);
+                DrawText("Speedup", 410, 60, 10, DARKGRAY);
+                DrawText("Atlas", 510, 60, 10, DARKGRAY);
+
+                for (int t = 0; t < FONT_TYPES; t++)
+                {
+                    for (int g = 0; g < GLYPH_COUNTS; g++)
+                    {
+                        int posY = 80 + (t*GLYPH_COUNTS + g)*20;
+
+                        DrawText(fontTypeNames[t], 10, posY, 10, BLACK);
+                        DrawText(TextFormat("%i", glyphCounts[g]), 130, posY, 10, BLACK);
+                        DrawText(TextFormat("%.2f", loadTimes[0][t][g]), 210, posY, 10, MAROON);
+                        DrawText(TextFormat("%.2f", loadTimes[1][t][g]), 310, posY, 10, DARKGREEN);
+                        DrawText(TextFormat("x%.2f", loadTimes[0][t][g]/loadTimes[1][t][g]), 410, posY, 10, BLACK);
+                        DrawText(TextFormat("%.2f", atlasTimes[t][g]), 510, posY, 10, DARKBLUE);
+                    }
+                }
+            }
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(codepoints);
+    UnloadFileData(fileData);
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
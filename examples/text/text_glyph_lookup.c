@@ -0,0 +1,136 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Glyph lookup benchmark (Latin and CJK glyph sets)
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define CJK_GLYPHS          4000        // Number of CJK ideographs loaded (starting at U+4E00)
+#define TEXT_CODEPOINTS     2000        // Number of codepoints in every benchmark text
+#define BENCHMARK_RUNS       200        // Number of MeasureTextEx() calls per measure
+
+// Measure average time in milliseconds to layout a text with MeasureTextEx()
+static double BenchmarkText(Font font, const char *text)
+{
+    double startTime = GetTime();
+
+    for (int i = 0; i < BENCHMARK_RUNS; i++) MeasureTextEx(font, text, (float)font.baseSize, 0.0f);
+
+    return (GetTime() - startTime)*1000.0/BENCHMARK_RUNS;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - glyph lookup");
+
+    // Load codepoints: ASCII (including fallback glyph '?') + CJK unified ideographs
+    int codepointCount = 95 + CJK_GLYPHS;
+    int *codepoints = (int *)malloc(codepointCount*sizeof(int));
+    for (int i = 0; i < 95; i++) codepoints[i] = 32 + i;
+    for (int i = 0; i < CJK_GLYPHS; i++) codepoints[95 + i] = 0x4e00 + i;
+
+    Font fontLatin = LoadFontEx("resources/DotGothic16-Regular.ttf", 16, codepoints, 95);
+    Font fontCJK = LoadFontEx("resources/DotGothic16-Regular.ttf", 16, codepoints, codepointCount);
+
+    // Generate random texts using the loaded glyph sets
+    int *textCodepoints = (int *)malloc(TEXT_CODEPOINTS*sizeof(int));
+    for (int i = 0; i < TEXT_CODEPOINTS; i++) textCodepoints[i] = codepoints[GetRandomValue(1, 94)];
+    char *textLatin = LoadUTF8(textCodepoints, TEXT_CODEPOINTS);
+    for (int i = 0; i < TEXT_CODEPOINTS; i++) textCodepoints[i] = codepoints[GetRandomValue(95, codepointCount - 1)];
+    char *textCJK = LoadUTF8(textCodepoints, TEXT_CODEPOINTS);
+
+    free(textCodepoints);
+    free(codepoints);
+
+    // Fonts without lookup table fallback to linear glyphs search, used as reference
+    Font fontLatinLinear = fontLatin;
+    fontLatinLinear.glyphLookup = NULL;
+    Font fontCJKLinear = fontCJK;
+    fontCJKLinear.glyphLookup = NULL;
+
+    double times[4] = { 0 };
+    bool runBenchmark = true;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) runBenchmark = true;
+
+        if (runBenchmark)
+        {
+            times[0] = BenchmarkText(fontLatinLinear, textLatin);
+            times[1] = BenchmarkText(fontLatin, textLatin);
+            times[2] = BenchmarkText(fontCJKLinear, textCJK);
+            times[3] = BenchmarkText(fontCJK, textCJK);
+
+            runBenchmark = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw some of the benchmark text, every glyph goes through GetGlyphIndex()
+            // NOTE: TextSubtext() works on bytes, CJK ideographs are encoded with 3 bytes in UTF-8
+            DrawTextEx(fontCJK, TextSubtext(textCJK, 0, 40*3), (Vector2){ 10, 200 }, 16, 0, DARKGRAY);
+            DrawTextEx(fontLatin, TextSubtext(textLatin, 0, 90), (Vector2){ 10, 230 }, 16, 0, DARKGRAY);
+
+            DrawText(TextFormat("Text layout of %i codepoints, MeasureTextEx() average time (ms)", TEXT_CODEPOINTS), 10, 40, 10, DARKGRAY);
+            DrawText("Linear search", 200, 60, 10, DARKGRAY);
+            DrawText("Hashed lookup", 320, 60, 10, DARKGRAY);
+
+            DrawText(TextFormat("Latin (%i glyphs)", fontLatin.glyphCount), 10, 80, 10, BLACK);
+            DrawText(TextFormat("%.4f", times[0]), 200, 80, 10, MAROON);
+            DrawText(TextFormat("%.4f", times[1]), 320, 80, 10, DARKGREEN);
+
+            DrawText(TextFormat("CJK (%i glyphs)", fontCJK.glyphCount), 10, 100, 10, BLACK);
+            DrawText(TextFormat("%.4f", times[2]), 200, 100, 10, MAROON);
+            DrawText(TextFormat("%.4f", times[3]), 320, 100, 10, DARKGREEN);
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadUTF8(textLatin);
+    UnloadUTF8(textCJK);
+
+    UnloadFont(fontLatin);      // Unload fonts (lookup table included)
+    UnloadFont(fontCJK);
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Text layout cache for static text
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_LABELS      120         // Number of static labels drawn every frame
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - text layout cache");
+
+    Font font = LoadFontEx("resources/pixantiqua.ttf", 16, 0, 0);
+
+    // Load labels layouts once, glyphs placement is not computed again while text does not change
+    TextLayout layouts[MAX_LABELS] = { 0 };
+    for (int i = 0; i < MAX_LABELS; i++) layouts[i] = LoadTextLayout(font, TextFormat("Static label %03i: HP MP XP", i), 16, 1);
+
+    // Dynamic label, only recomputed when the text changes
+    TextLayout scoreLayout = { 0 };
+    int score = 0;
+
+    bool useLayouts = true;
+    double drawTime = 0.0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useLayouts = !useLayouts;
+
+        if (GetRandomValue(0, 30) == 0) score += 10;
+
+        UpdateTextLayout(&scoreLayout, font, TextFormat("SCORE: %08i", score), 32, 2);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Measure CPU time required to submit all labels to the render batch
+            double startTime = GetTime();
+
+            for (int i = 0; i < MAX_LABELS; i++)
+            {
+                Vector2 position = { 10.0f + (i%4)*195.0f, 80.0f + (i/4)*12.0f };
+
+                if (useLayouts) DrawTextLayout(layouts[i], position, DARKGRAY);
+                else DrawTextEx(font, TextFormat("Static label %03i: HP MP XP", i), position, 16, 1, DARKGRAY);
+            }
+
+            drawTime = drawTime*0.95 + (GetTime() - startTime)*1000.0*0.05;
+
+            DrawTextLayout(scoreLayout, (Vector2){ screenWidth - scoreLayout.size.x - 10, 10 }, MAROON);
+
+            DrawText(TextFormat("%s: %.3f ms", useLayouts? "DrawTextLayout()" : "DrawTextEx()", drawTime), 10, 40, 20, BLACK);
+            DrawText("Press SPACE to toggle text layouts", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_LABELS; i++) UnloadTextLayout(layouts[i]);
+    UnloadTextLayout(scoreLayout);
+
+    UnloadFont(font);           // Unload font
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
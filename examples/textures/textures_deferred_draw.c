@@ -0,0 +1,155 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Deferred draw mode, draw calls sorted by state and merged
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Run with --headless argument to draw the scene on a hidden window with both
+*   draw modes, draw calls statistics are printed to standard output and program exits
+*
+*   NOTE: Rendering statistics require raylib compiled with RLGL_ENABLE_FRAME_STATS (config.h),
+*   otherwise they are reported as zero
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlEnableDeferredDraw(), rlSetDrawLayer(), rlGetFrameStats()...
+
+#include <stdio.h>          // Required for: printf()
+#include <math.h>           // Required for: sinf()
+#include <string.h>         // Required for: strcmp()
+
+#define WIDGETS_COLUMNS     12      // Number of widgets per row
+#define WIDGETS_ROWS         8      // Number of widgets rows
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void DrawWidgets(Texture2D icon, float time);    // Draw UI widgets: panel, icon, label and highlight
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - deferred draw");
+
+    Texture2D icon = LoadTexture("resources/wabbit_alpha.png");
+
+    bool deferred = true;
+    rlFrameStats stats[2] = { 0 };      // Scene rendering statistics: immediate, deferred
+
+    int framesCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) deferred = !deferred;
+
+        // Headless: first frame drawn immediate, second one deferred
+        if (headless) deferred = (framesCounter > 0);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // NOTE: Rendering statistics are reset on BeginDrawing(),
+            // scene render batch is drawn to get scene only statistics
+            if (deferred) rlEnableDeferredDraw();
+
+            DrawWidgets(icon, (float)GetTime());
+
+            rlDrawRenderBatchActive();
+            rlDisableDeferredDraw();
+            stats[deferred? 1 : 0] = rlGetFrameStats();
+
+            DrawRectangle(0, screenHeight - 70, screenWidth, 70, Fade(BLACK, 0.8f));
+            DrawText(TextFormat("Draw mode: %s (press SPACE to change)", deferred? "DEFERRED" : "IMMEDIATE"), 10, screenHeight - 60, 20, deferred? LIME : ORANGE);
+            for (int i = 0; i < 2; i++)
+            {
+                DrawText(TextFormat("%s: %i draw commands, %i draw calls, %i texture binds, %i shader binds, %i blend changes", (i == 0)? "Immediate" : "Deferred",
+                    stats[i].drawCommands, stats[i].drawCalls, stats[i].textureBinds, stats[i].shaderSwitches, stats[i].blendSwitches), 10, screenHeight - 35 + i*15, 10, RAYWHITE);
+            }
+
+            DrawFPS(screenWidth - 90, screenHeight - 60);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+
+        framesCounter++;
+        if (headless && (framesCounter == 2)) break;
+    }
+
+    if (headless)
+    {
+        printf("Scene draw calls, %i widgets\n", WIDGETS_COLUMNS*WIDGETS_ROWS);
+        for (int i = 0; i < 2; i++)
+        {
+            printf("%-10s %i draw commands, %i draw calls, %i texture binds, %i shader binds, %i blend changes\n", (i == 0)? "immediate:" : "deferred:",
+                stats[i].drawCommands, stats[i].drawCalls, stats[i].textureBinds, stats[i].shaderSwitches, stats[i].blendSwitches);
+        }
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(icon);        // Unload icon texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Draw UI widgets: panel, icon, label and highlight
+// NOTE: Every widget switches texture and blend mode, panels are drawn in a lower layer,
+// on deferred draw mode widgets contents are sorted by state but always over panels
+static void DrawWidgets(Texture2D icon, float time)
+{
+    for (int i = 0; i < WIDGETS_COLUMNS*WIDGETS_ROWS; i++)
+    {
+        int posX = 10 + (i%WIDGETS_COLUMNS)*65;
+        int posY = 10 + (i/WIDGETS_COLUMNS)*45;
+
+        rlSetDrawLayer(0);
+        DrawRectangle(posX, posY, 60, 40, LIGHTGRAY);
+        DrawRectangleLines(posX, posY, 60, 40, GRAY);
+
+        rlSetDrawLayer(1);
+        DrawTexture(icon, posX + 2, posY + 4, WHITE);
+        DrawText(TextFormat("%02i", i), posX + 38, posY + 14, 10, DARKGRAY);
+
+        // Animated highlight, additive blending
+        BeginBlendMode(BLEND_ADDITIVE);
+            DrawRectangle(posX, posY + 36, (int)(30.0f + 30.0f*sinf(time*2.0f + i*0.3f)), 4, Fade(SKYBLUE, 0.5f));
+        EndBlendMode();
+    }
+
+    rlSetDrawLayer(0);
+}
@@ -0,0 +1,247 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Image gaussian blur benchmark (4K image, multiple blur sizes)
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define BLUR_SIZES          4       // Number of blur sizes benchmarked
+#define BLUR_ITERATIONS     4       // Number of box blur iterations, same as GAUSSIAN_BLUR_ITERATIONS
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void ImageBlurGaussianReference(Image *image, int blurSize); // Reference blur (float, single thread)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - image blur benchmark");
+
+    // Generate a 4K source image, cellular noise with some transparent holes
+    Image source = GenImageCellular(3840, 2160, 64);
+    ImageColorTint(&source, SKYBLUE);
+    ImageDrawCircle(&source, 1920, 1080, 600, BLANK);
+
+    const int blurSizes[BLUR_SIZES] = { 2, 8, 32, 128 };
+    const int maxWorkers = GetParallelJobWorkers();
+
+    double referenceTimes[BLUR_SIZES] = { 0 };
+    double blurTimes[2][BLUR_SIZES] = { 0 };    // ImageBlurGaussian() times: single worker, all workers
+
+    // Scratch memory required per pixel, not including the resulting pixels
+    // NOTE: Reference uses two Vector4 copies, ImageBlurGaussian() uses one RGBA 8-bit copy
+    int referenceMemory = source.width*source.height*2*sizeof(Vector4);
+    int blurMemory = source.width*source.height*sizeof(Color);
+
+    Texture2D texture = { 0 };
+    int framesCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) framesCounter = 0;
+
+        // NOTE: Benchmark is run on second frame, first frame displays the running message
+        if (framesCounter == 1)
+        {
+            for (int i = 0; i < BLUR_SIZES; i++)
+            {
+                Image image = ImageCopy(source);
+                double startTime = GetTime();
+                ImageBlurGaussianReference(&image, blurSizes[i]);
+                referenceTimes[i] = (GetTime() - startTime)*1000.0;
+                UnloadImage(image);
+
+                for (int w = 0; w < 2; w++)
+                {
+                    SetParallelJobWorkers((w == 0)? 1 : maxWorkers);
+
+                    image = ImageCopy(source);
+                    startTime = GetTime();
+                    ImageBlurGaussian(&image, blurSizes[i]);
+                    blurTimes[w][i] = (GetTime() - startTime)*1000.0;
+
+                    // Keep a preview of the biggest blur
+                    if ((w == 1) && (i == (BLUR_SIZES - 1)))
+                    {
+                        ImageResize(&image, 320, 180);
+                        UnloadTexture(texture);
+                        texture = LoadTextureFromImage(image);
+                    }
+
+                    UnloadImage(image);
+                }
+            }
+
+            SetParallelJobWorkers(maxWorkers);
+        }
+
+        framesCounter++;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (framesCounter <= 1) DrawText("Running benchmark...", 10, 40, 20, MAROON);
+            else
+            {
+                DrawText(TextFormat("ImageBlurGaussian() times (ms), %ix%i image, %i workers", source.width, source.height, maxWorkers), 10, 40, 10, DARKGRAY);
+                DrawText("Blur size", 10, 60, 10, DARKGRAY);
+                DrawText("Reference", 110, 60, 10, DARKGRAY);
+                DrawText("1 worker", 210, 60, 10, DARKGRAY);
+                DrawText(TextFormat("%i workers", maxWorkers), 310, 60, 10, DARKGRAY);
+                DrawText("Speedup", 410, 60, 10, DARKGRAY);
+
+                for (int i = 0; i < BLUR_SIZES; i++)
+                {
+                    int posY = 80 + i*20;
+
+                    DrawText(TextFormat("%i", blurSizes[i]), 10, posY, 10, BLACK);
+                    DrawText(TextFormat("%.2f", referenceTimes[i]), 110, posY, 10, MAROON);
+                    DrawText(TextFormat("%.2f", blurTimes[0][i]), 210, posY, 10, DARKGREEN);
+                    DrawText(TextFormat("%.2f", blurTimes[1][i]), 310, posY, 10, DARKGREEN);
+                    DrawText(TextFormat("x%.2f", referenceTimes[i]/blurTimes[1][i]), 410, posY, 10, BLACK);
+                }
+
+                DrawText(TextFormat("Scratch memory: reference %i MB, ImageBlurGaussian() %i MB", referenceMemory/(1024*1024), blurMemory/(1024*1024)), 10, 170, 10, DARKGRAY);
+
+                DrawTexture(texture, screenWidth - texture.width - 10, 40, WHITE);
+                DrawRectangleLines(screenWidth - texture.width - 10, 40, texture.width, texture.height, GRAY);
+            }
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texture);     // Unload preview texture
+    UnloadImage(source);        // Unload source image
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Reference gaussian blur: repeated float box blurs on two Vector4 copies of the image
+// NOTE: Same algorithm as previous ImageBlurGaussian() implementation, cost per pixel is fixed but
+// every pass converts and stores 16 bytes per pixel, all the work is done on a single thread
+static void ImageBlurGaussianReference(Image *image, int blurSize)
+{
+    int width = image->width;
+    int height = image->height;
+
+    ImageAlphaPremultiply(image);
+    Color *pixels = LoadImageColors(*image);
+
+    Vector4 *pixelsCopy1 = (Vector4 *)malloc(width*height*sizeof(Vector4));
+    Vector4 *pixelsCopy2 = (Vector4 *)malloc(width*height*sizeof(Vector4));
+
+    for (int i = 0; i < width*height; i++) pixelsCopy1[i] = (Vector4){ pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a };
+
+    for (int j = 0; j < BLUR_ITERATIONS; j++)
+    {
+        // Horizontal box blur: pixelsCopy1 -> pixelsCopy2, vertical box blur: pixelsCopy2 -> pixelsCopy1
+        for (int pass = 0; pass < 2; pass++)
+        {
+            Vector4 *src = (pass == 0)? pixelsCopy1 : pixelsCopy2;
+            Vector4 *dst = (pass == 0)? pixelsCopy2 : pixelsCopy1;
+            int lineCount = (pass == 0)? height : width;
+            int lineSize = (pass == 0)? width : height;
+            int lineStride = (pass == 0)? width : 1;
+            int step = (pass == 0)? 1 : width;
+
+            for (int line = 0; line < lineCount; line++)
+            {
+                Vector4 *srcLine = src + line*lineStride;
+                Vector4 *dstLine = dst + line*lineStride;
+                Vector4 sum = { 0 };
+                int count = 0;
+
+                for (int i = 0; (i <= blurSize) && (i < lineSize); i++, count++)
+                {
+                    sum.x += srcLine[i*step].x; sum.y += srcLine[i*step].y;
+                    sum.z += srcLine[i*step].z; sum.w += srcLine[i*step].w;
+                }
+
+                for (int i = 0; i < lineSize; i++)
+                {
+                    dstLine[i*step] = (Vector4){ sum.x/count, sum.y/count, sum.z/count, sum.w/count };
+
+                    if ((i + blurSize + 1) < lineSize)
+                    {
+                        Vector4 in = srcLine[(i + blurSize + 1)*step];
+                        sum.x += in.x; sum.y += in.y; sum.z += in.z; sum.w += in.w;
+                        count++;
+                    }
+
+                    if ((i - blurSize) >= 0)
+                    {
+                        Vector4 out = srcLine[(i - blurSize)*step];
+                        sum.x -= out.x; sum.y -= out.y; sum.z -= out.z; sum.w -= out.w;
+                        count--;
+                    }
+                }
+            }
+        }
+    }
+
+    // Reverse premultiply
+    for (int i = 0; i < width*height; i++)
+    {
+        if (pixelsCopy1[i].w == 0.0f) pixels[i] = BLANK;
+        else
+        {
+            float alpha = pixelsCopy1[i].w/255.0f;
+            float r = pixelsCopy1[i].x/alpha;
+            float g = pixelsCopy1[i].y/alpha;
+            float b = pixelsCopy1[i].z/alpha;
+
+            pixels[i] = (Color){ (unsigned char)((r > 255.0f)? 255.0f : r), (unsigned char)((g > 255.0f)? 255.0f : g),
+                                 (unsigned char)((b > 255.0f)? 255.0f : b), (unsigned char)pixelsCopy1[i].w };
+        }
+    }
+
+    free(pixelsCopy1);
+    free(pixelsCopy2);
+
+    Image result = { pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    ImageFormat(&result, image->format);
+
+    UnloadImage(*image);
+    *image = result;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Image flip and rotation benchmark (8K sprite sheet)
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define SHEET_SIZE          8192    // Sprite sheet width and height
+#define PIXEL_FORMATS          3    // Number of pixel formats benchmarked
+#define TRANSFORMS             4    // Number of transforms benchmarked
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - image transform benchmark");
+
+    const int formats[PIXEL_FORMATS] = { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    const char *formatNames[PIXEL_FORMATS] = { "GRAYSCALE", "R8G8B8", "R8G8B8A8" };
+    const char *transformNames[TRANSFORMS] = { "ImageFlipVertical()", "ImageFlipHorizontal()", "ImageRotateCW()", "ImageRotateCCW()" };
+
+    double times[PIXEL_FORMATS][TRANSFORMS] = { 0 };
+    int dataSizes[PIXEL_FORMATS] = { 0 };
+    int framesCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) framesCounter = 0;
+
+        // NOTE: Benchmark is run on second frame, first frame displays the running message
+        if (framesCounter == 1)
+        {
+            for (int f = 0; f < PIXEL_FORMATS; f++)
+            {
+                // Generate 8K sprite sheet, 64x64 sprites grid
+                Image sheet = GenImageChecked(SHEET_SIZE, SHEET_SIZE, 64, 64, ORANGE, DARKBLUE);
+                ImageFormat(&sheet, formats[f]);
+                dataSizes[f] = GetPixelDataSize(sheet.width, sheet.height, sheet.format);
+
+                for (int t = 0; t < TRANSFORMS; t++)
+                {
+                    double startTime = GetTime();
+
+                    switch (t)
+                    {
+                        case 0: ImageFlipVertical(&sheet); break;
+                        case 1: ImageFlipHorizontal(&sheet); break;
+                        case 2: ImageRotateCW(&sheet); break;
+                        case 3: ImageRotateCCW(&sheet); break;
+                        default: break;
+                    }
+
+                    times[f][t] = (GetTime() - startTime)*1000.0;
+                }
+
+                UnloadImage(sheet);
+            }
+        }
+
+        framesCounter++;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (framesCounter <= 1) DrawText("Running benchmark...", 10, 40, 20, MAROON);
+            else
+            {
+                DrawText(TextFormat("Image transform times (ms) and throughput (MB/s), %ix%i sprite sheet", SHEET_SIZE, SHEET_SIZE), 10, 40, 10, DARKGRAY);
+
+                for (int f = 0; f < PIXEL_FORMATS; f++) DrawText(formatNames[f], 200 + f*180, 60, 10, DARKGRAY);
+
+                for (int t = 0; t < TRANSFORMS; t++)
+                {
+                    int posY = 80 + t*20;
+
+                    DrawText(transformNames[t], 10, posY, 10, BLACK);
+
+                    for (int f = 0; f < PIXEL_FORMATS; f++)
+                    {
+                        DrawText(TextFormat("%.2f", times[f][t]), 200 + f*180, posY, 10, MAROON);
+                        DrawText(TextFormat("%.0f", (dataSizes[f]/(1024.0*1024.0))/(times[f][t]/1000.0)), 270 + f*180, posY, 10, DARKGREEN);
+                    }
+                }
+            }
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Sprite instancing, animated particles drawn with DrawTextureInstanced()
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Instancing requires OpenGL 3.3 or OpenGL ES 2.0 instancing extensions,
+*   sprites are drawn through render batch if not supported
+*
+*   NOTE: Run with --headless argument to run the benchmark on a hidden window,
+*   results are printed to standard output and program exits when finished
+*
+*   NOTE: Uploaded data statistics require raylib compiled with RLGL_ENABLE_FRAME_STATS (config.h),
+*   otherwise they are reported as zero
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlDrawRenderBatchActive(), rlGetFrameStats()
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_PARTICLES   200000      // Number of particles drawn every frame
+#define FRAMES_COUNT         6      // Number of sprite animation frames
+#define DRAW_METHODS         2      // Number of drawing methods benchmarked
+#define BENCHMARK_FRAMES   120      // Number of frames measured per method
+
+typedef struct Particle {
+    Vector2 speed;
+    float spin;
+} Particle;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void UpdateParticles(SpriteInstance *sprites, const Particle *particles, int count, int screenWidth, int screenHeight);   // Update particles movement and animation
+static void DrawParticlesTexturePro(Texture2D texture, const Rectangle *frames, const SpriteInstance *sprites, int count);   // Draw particles using DrawTexturePro()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+    for (int i = 1; i < argc; i++) if (strcmp(argv[i], "--headless") == 0) headless = true;
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - sprite instancing");
+
+    Texture2D scarfy = LoadTexture("resources/scarfy.png");     // Sprite sheet, 6 animation frames
+
+    Rectangle frames[FRAMES_COUNT] = { 0 };
+    for (int i = 0; i < FRAMES_COUNT; i++) frames[i] = (Rectangle){ (float)i*scarfy.width/FRAMES_COUNT, 0.0f, (float)scarfy.width/FRAMES_COUNT, (float)scarfy.height };
+
+    // Particles sprites instances data, updated on CPU every frame
+    SpriteInstance *sprites = (SpriteInstance *)malloc(MAX_PARTICLES*sizeof(SpriteInstance));
+    Particle *particles = (Particle *)malloc(MAX_PARTICLES*sizeof(Particle));
+
+    for (int i = 0; i < MAX_PARTICLES; i++)
+    {
+        sprites[i].position = (Vector2){ (float)GetRandomValue(0, screenWidth), (float)GetRandomValue(0, screenHeight) };
+        sprites[i].rotation = (float)GetRandomValue(0, 359);
+        sprites[i].scale = (float)GetRandomValue(5, 20)/100.0f;
+        sprites[i].frame = (unsigned short)GetRandomValue(0, FRAMES_COUNT - 1);
+        sprites[i].tint = (Color){ GetRandomValue(100, 255), GetRandomValue(100, 255), GetRandomValue(100, 255), 255 };
+
+        particles[i].speed = (Vector2){ (float)GetRandomValue(-100, 100)/100.0f, (float)GetRandomValue(-100, 100)/100.0f };
+        particles[i].spin = (float)GetRandomValue(-20, 20)/10.0f;
+    }
+
+    const char *methodNames[DRAW_METHODS] = { "DrawTexturePro()", "DrawTextureInstanced()" };
+    double times[DRAW_METHODS] = { 0 };             // Accumulated drawing times (ms)
+    unsigned int uploads[DRAW_METHODS] = { 0 };     // Vertex data uploaded per frame (bytes)
+
+    int method = 0;
+    int framesCounter = 0;
+    bool finished = false;
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            for (int i = 0; i < DRAW_METHODS; i++) times[i] = 0.0;
+            method = 0;
+            framesCounter = 0;
+            finished = false;
+        }
+
+        UpdateParticles(sprites, particles, MAX_PARTICLES, screenWidth, screenHeight);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // NOTE: Only CPU drawing time is measured, including render batch draws and instances upload
+            double startTime = GetTime();
+
+            if (method == 0) DrawParticlesTexturePro(scarfy, frames, sprites, MAX_PARTICLES);
+            else DrawTextureInstanced(scarfy, frames, FRAMES_COUNT, sprites, MAX_PARTICLES);
+
+            rlDrawRenderBatchActive();
+
+            if (!finished)
+            {
+                times[method] += (GetTime() - startTime)*1000.0;
+                uploads[method] = rlGetFrameStats().uploadBytes;
+                framesCounter++;
+
+                if (framesCounter == BENCHMARK_FRAMES)
+                {
+                    framesCounter = 0;
+                    method++;
+
+                    if (method == DRAW_METHODS)
+                    {
+                        finished = true;
+                        method = 1;
+                    }
+                }
+            }
+
+            DrawRectangle(0, 0, screenWidth, 40 + DRAW_METHODS*20, Fade(RAYWHITE, 0.9f));
+            DrawText(TextFormat("%i particles, drawing CPU time per frame (ms) and vertex data uploaded (KB)", MAX_PARTICLES), 10, 30, 10, DARKGRAY);
+
+            for (int i = 0; i < DRAW_METHODS; i++)
+            {
+                int posY = 50 + i*20;
+
+                DrawText(methodNames[i], 10, posY, 10, (i == method)? MAROON : BLACK);
+                if (finished)
+                {
+                    DrawText(TextFormat("%.3f", times[i]/BENCHMARK_FRAMES), 200, posY, 10, MAROON);
+                    DrawText(TextFormat("%u", uploads[i]/1024), 280, posY, 10, DARKGREEN);
+                }
+            }
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+
+        if (headless && finished) break;
+    }
+
+    if (headless)
+    {
+        printf("Particles drawing CPU time per frame (ms) and vertex data uploaded (KB), %i particles, %i frames\n", MAX_PARTICLES, BENCHMARK_FRAMES);
+        for (int i = 0; i < DRAW_METHODS; i++) printf("%-24s %8.3f %10u\n", methodNames[i], times[i]/BENCHMARK_FRAMES, uploads[i]/1024);
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(sprites);
+    free(particles);
+    UnloadTexture(scarfy);      // Unload sprite sheet texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Update particles movement and animation, particles wrap around screen borders
+static void UpdateParticles(SpriteInstance *sprites, const Particle *particles, int count, int screenWidth, int screenHeight)
+{
+    static int animCounter = 0;
+    bool nextFrame = ((animCounter++%8) == 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        sprites[i].position.x += particles[i].speed.x;
+        sprites[i].position.y += particles[i].speed.y;
+        sprites[i].rotation += particles[i].spin;
+
+        if (sprites[i].position.x < 0.0f) sprites[i].position.x += screenWidth;
+        else if (sprites[i].position.x > screenWidth) sprites[i].position.x -= screenWidth;
+        if (sprites[i].position.y < 0.0f) sprites[i].position.y += screenHeight;
+        else if (sprites[i].position.y > screenHeight) sprites[i].position.y -= screenHeight;
+
+        if (nextFrame) sprites[i].frame = (sprites[i].frame + 1)%FRAMES_COUNT;
+    }
+}
+
+// Draw particles using DrawTexturePro(), sprite quads expanded on CPU render batch
+static void DrawParticlesTexturePro(Texture2D texture, const Rectangle *frames, const SpriteInstance *sprites, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Rectangle source = frames[sprites[i].frame];
+        Rectangle dest = { sprites[i].position.x, sprites[i].position.y, source.width*sprites[i].scale, source.height*sprites[i].scale };
+
+        DrawTexturePro(texture, source, dest, (Vector2){ dest.width/2.0f, dest.height/2.0f }, sprites[i].rotation, sprites[i].tint);
+    }
+}
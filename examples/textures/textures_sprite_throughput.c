@@ -0,0 +1,301 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Sprite throughput benchmark, per-vertex vs bulk vertex submission
+*
+*   Example originally created with raylib 5.1, last time updated with raylib 5.1
+*
+*   NOTE: Run with --headless argument to run the benchmark on a hidden window,
+*   results are printed to standard output and program exits when finished
+*
+*   NOTE: Run with --interleaved or --persistent argument to select render batch
+*   vertex data streaming mode, set before window (and rlgl) initialization
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlBegin(), rlVertex2f(), rlPushQuads(), rlReserveVertexBatch(), rlSetRenderBatchStreamMode()...
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: strcmp()
+
+#define MAX_SPRITES     100000      // Number of sprites drawn every frame
+#define SUBMIT_METHODS       4      // Number of vertex submission methods benchmarked
+#define BENCHMARK_FRAMES   120      // Number of frames measured per method
+
+typedef struct Sprite {
+    Vector2 position;
+    Color color;
+} Sprite;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void DrawSpritesPerVertex(Texture2D texture, const Sprite *sprites, int count);      // Draw sprites using per-vertex rlgl calls
+static void DrawSpritesTexturePro(Texture2D texture, const Sprite *sprites, int count);     // Draw sprites using DrawTexturePro()
+static void DrawSpritesQuads(Texture2D texture, const rlQuad *quads, int count);            // Draw sprites using rlPushQuads(), prebuilt quads
+static void DrawSpritesReserve(Texture2D texture, const Sprite *sprites, int count);        // Draw sprites using rlReserveVertexBatch()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    bool headless = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--headless") == 0) headless = true;
+        else if (strcmp(argv[i], "--interleaved") == 0) rlSetRenderBatchStreamMode(RL_BATCH_STREAM_INTERLEAVED);
+        else if (strcmp(argv[i], "--persistent") == 0) rlSetRenderBatchStreamMode(RL_BATCH_STREAM_PERSISTENT);
+    }
+
+    if (headless) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - sprite throughput");
+
+    Texture2D texture = LoadTexture("resources/wabbit_alpha.png");
+
+    // Generate sprites, same sprites are used by all methods
+    Sprite *sprites = (Sprite *)malloc(MAX_SPRITES*sizeof(Sprite));
+    rlQuad *quads = (rlQuad *)malloc(MAX_SPRITES*sizeof(rlQuad));
+
+    for (int i = 0; i < MAX_SPRITES; i++)
+    {
+        sprites[i].position = (Vector2){ (float)GetRandomValue(0, screenWidth - texture.width), (float)GetRandomValue(60, screenHeight - texture.height) };
+        sprites[i].color = (Color){ GetRandomValue(50, 240), GetRandomValue(80, 240), GetRandomValue(100, 240), 255 };
+
+        float x = sprites[i].position.x;
+        float y = sprites[i].position.y;
+        Color c = sprites[i].color;
+
+        quads[i] = (rlQuad){ .vertices = {
+            { x, y, 0.0f, 0.0f, c.r, c.g, c.b, c.a },
+            { x, y + texture.height, 0.0f, 1.0f, c.r, c.g, c.b, c.a },
+            { x + texture.width, y + texture.height, 1.0f, 1.0f, c.r, c.g, c.b, c.a },
+            { x + texture.width, y, 1.0f, 0.0f, c.r, c.g, c.b, c.a } } };
+    }
+
+    // NOTE: Requested streaming mode could fallback to a supported one
+    const char *streamModeNames[3] = { "separate", "interleaved", "persistent" };
+    const char *streamModeName = streamModeNames[rlGetRenderBatchStreamMode()];
+
+    const char *methodNames[SUBMIT_METHODS] = { "rlVertex2f() per vertex", "DrawTexturePro()", "rlPushQuads()", "rlReserveVertexBatch()" };
+    double times[SUBMIT_METHODS] = { 0 };       // Accumulated submission times (ms)
+
+    int method = 0;
+    int framesCounter = 0;
+    bool finished = false;
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            for (int i = 0; i < SUBMIT_METHODS; i++) times[i] = 0.0;
+            method = 0;
+            framesCounter = 0;
+            finished = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (!finished)
+            {
+                // NOTE: Only CPU submission time is measured, including render batch draws when full
+                double startTime = GetTime();
+
+                switch (method)
+                {
+                    case 0: DrawSpritesPerVertex(texture, sprites, MAX_SPRITES); break;
+                    case 1: DrawSpritesTexturePro(texture, sprites, MAX_SPRITES); break;
+                    case 2: DrawSpritesQuads(texture, quads, MAX_SPRITES); break;
+                    case 3: DrawSpritesReserve(texture, sprites, MAX_SPRITES); break;
+                    default: break;
+                }
+
+                rlDrawRenderBatchActive();
+
+                times[method] += (GetTime() - startTime)*1000.0;
+                framesCounter++;
+
+                if (framesCounter == BENCHMARK_FRAMES)
+                {
+                    framesCounter = 0;
+                    method++;
+
+                    if (method == SUBMIT_METHODS)
+                    {
+                        finished = true;
+                        method = 0;
+                    }
+                }
+
+                DrawRectangle(0, 0, screenWidth, 60, RAYWHITE);
+                DrawText(TextFormat("Running benchmark: %s", methodNames[method]), 10, 40, 10, MAROON);
+            }
+            else
+            {
+                DrawText(TextFormat("Sprites submission CPU time per frame (ms), %i sprites, %i frames, %s vertex streaming", MAX_SPRITES, BENCHMARK_FRAMES, streamModeName), 10, 40, 10, DARKGRAY);
+
+                for (int i = 0; i < SUBMIT_METHODS; i++)
+                {
+                    int posY = 70 + i*20;
+
+                    DrawText(methodNames[i], 10, posY, 10, BLACK);
+                    DrawText(TextFormat("%.3f", times[i]/BENCHMARK_FRAMES), 200, posY, 10, MAROON);
+                    DrawText(TextFormat("x%.2f", times[0]/times[i]), 280, posY, 10, DARKGREEN);
+                }
+            }
+
+            DrawText("Press SPACE to run the benchmark again", 10, 430, 10, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+
+        if (headless && finished) break;
+    }
+
+    if (headless)
+    {
+        printf("Sprites submission CPU time per frame (ms), %i sprites, %i frames, %s vertex streaming\n", MAX_SPRITES, BENCHMARK_FRAMES, streamModeName);
+        for (int i = 0; i < SUBMIT_METHODS; i++) printf("%-24s %8.3f  x%.2f\n", methodNames[i], times[i]/BENCHMARK_FRAMES, times[0]/times[i]);
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(sprites);
+    free(quads);
+    UnloadTexture(texture);     // Unload sprite texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Draw sprites using per-vertex rlgl calls, same as previous DrawTexturePro() implementation
+static void DrawSpritesPerVertex(Texture2D texture, const Sprite *sprites, int count)
+{
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < count; i++)
+        {
+            float x = sprites[i].position.x;
+            float y = sprites[i].position.y;
+
+            rlColor4ub(sprites[i].color.r, sprites[i].color.g, sprites[i].color.b, sprites[i].color.a);
+
+            rlTexCoord2f(0.0f, 0.0f);
+            rlVertex2f(x, y);
+
+            rlTexCoord2f(0.0f, 1.0f);
+            rlVertex2f(x, y + texture.height);
+
+            rlTexCoord2f(1.0f, 1.0f);
+            rlVertex2f(x + texture.width, y + texture.height);
+
+            rlTexCoord2f(1.0f, 0.0f);
+            rlVertex2f(x + texture.width, y);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Draw sprites using DrawTexturePro(), one quad pushed per call
+static void DrawSpritesTexturePro(Texture2D texture, const Sprite *sprites, int count)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    for (int i = 0; i < count; i++)
+    {
+        Rectangle dest = { sprites[i].position.x, sprites[i].position.y, (float)texture.width, (float)texture.height };
+        DrawTexturePro(texture, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, sprites[i].color);
+    }
+}
+
+// Draw sprites using rlPushQuads(), all prebuilt quads pushed at once
+static void DrawSpritesQuads(Texture2D texture, const rlQuad *quads, int count)
+{
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        rlPushQuads(quads, count);
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Draw sprites using rlReserveVertexBatch(), vertex data written directly to render batch
+// NOTE: Reserved vertex data is not transformed by current matrix
+static void DrawSpritesReserve(Texture2D texture, const Sprite *sprites, int count)
+{
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        for (int i = 0; i < count;)
+        {
+            // Reserve sprites by chunks, chunk size must fit in render batch buffer
+            int spriteCount = ((count - i) < 1024)? (count - i) : 1024;
+            rlVertexBatch batch = rlReserveVertexBatch(spriteCount*4);
+
+            if (batch.vertexCount == 0) break;
+
+            for (int k = 0; k < spriteCount*4; k++)
+            {
+                const Sprite *sprite = &sprites[i + k/4];
+                float u = ((k%4) >= 2)? 1.0f : 0.0f;
+                float v = (((k%4) == 1) || ((k%4) == 2))? 1.0f : 0.0f;
+
+                batch.vertices[3*k] = sprite->position.x + u*texture.width;
+                batch.vertices[3*k + 1] = sprite->position.y + v*texture.height;
+                batch.vertices[3*k + 2] = batch.depth;
+
+                batch.texcoords[2*k] = u;
+                batch.texcoords[2*k + 1] = v;
+
+                batch.normals[3*k] = 0.0f;
+                batch.normals[3*k + 1] = 0.0f;
+                batch.normals[3*k + 2] = 1.0f;
+
+                batch.colors[4*k] = sprite->color.r;
+                batch.colors[4*k + 1] = sprite->color.g;
+                batch.colors[4*k + 2] = sprite->color.b;
+                batch.colors[4*k + 3] = sprite->color.a;
+            }
+
+            i += spriteCount;
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
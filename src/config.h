@@ -100,6 +100,10 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Enable rendering statistics counters: draw calls, vertex, uploads, state changes (rlGetFrameStats())
+// NOTE: Counters are updated on every draw, statistics are zero if not enabled
+//#define RLGL_ENABLE_FRAME_STATS                1
+
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
@@ -192,6 +196,10 @@
 //#define SUPPORT_FILEFORMAT_FNT          1
 //#define SUPPORT_FILEFORMAT_BDF          1
 
+// Support dynamic fonts, glyphs rasterized on first use into a growable atlas [LoadFontDynamic()]
+// NOTE: Requires SUPPORT_FILEFORMAT_TTF, font file data is kept loaded
+#define SUPPORT_FONT_GLYPH_CACHE        1
+
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
 #define SUPPORT_TEXT_MANIPULATION       1
@@ -221,6 +229,9 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Keep only keyframes poses for glTF animations, instead of resampling them at fixed rate
+// WARNING: Frames are unevenly spaced in time (ModelAnimation.frameTimes), use UpdateModelAnimationEx() to play them
+//#define SUPPORT_GLTF_ANIMATION_KEYFRAMES 1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
@@ -239,13 +250,19 @@
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
 
+// Music streams are decoded on a dedicated thread, keeping streams buffers filled ahead,
+// UpdateMusicStream() does not decode data on calling thread, it only updates music looping state
+#define SUPPORT_MUSIC_STREAMING_THREAD  1
+
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_VOICES                  64    // Maximum number of sounds mixed (real voices), other playing sounds are virtual
+
+#define MUSIC_STREAMING_LATENCY_MS       100    // Music streams data decoded ahead by streaming thread (milliseconds)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -256,9 +273,20 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Run internal parallel jobs on worker threads: mesh skinning, font rasterization, image processing...
+// NOTE: Not available on PLATFORM_WEB, unless compiled with pthreads support
+#define SUPPORT_THREADED_JOBS           1
+// Record CPU profiling zones in hot-path functions: input polling, batch drawing, animation, image/texture loading...
+// NOTE: Zones are exported as Chrome trace JSON on CloseWindow(), file: raylib_trace.json
+//#define SUPPORT_PROFILING_ZONES         1
+// Map files to memory on LoadMappedFile(), file data is read from disk on access, not copied to a memory buffer
+// NOTE: Used by audio WAV/QOA loading and music streaming, not available on PLATFORM_WEB and PLATFORM_ANDROID
+#define SUPPORT_FILE_MAPPING            1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_JOB_WORKER_THREADS          4       // Max worker threads used to run parallel jobs (including caller thread)
+#define MAX_PROFILE_ZONE_EVENTS      4096       // Max profiling zone events stored per thread ring buffer
 
 #endif // CONFIG_H
@@ -4,7 +4,7 @@
 *
 *   qoaplay is a tiny abstraction to read and decode a QOA file "on the fly".
 *   It reads and decodes one frame at a time with minimal memory requirements.
-*   qoaplay also provides some functions to seek to a specific frame.
+*   qoaplay also provides some functions to seek to a specific frame or sample.
 *
 *   LICENSE: MIT License
 *
@@ -39,6 +39,7 @@ typedef struct {
 
     FILE *file;                     // QOA file to read, if NULL, using memory buffer -> file_data
     unsigned char *file_data;       // QOA file data on memory
+    int file_data_shared;           // QOA file data on memory not owned (not copied, not freed), i.e. mapped file
     unsigned int file_data_size;    // QOA file data on memory size
     unsigned int file_data_offset;  // QOA file data on memory offset for next read
 
@@ -64,10 +65,12 @@ extern "C" {            // Prevents name mangling of functions
 
 qoaplay_desc *qoaplay_open(const char *path);
 qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size);
+qoaplay_desc *qoaplay_open_memory_shared(const unsigned char *data, int data_size);
 void qoaplay_close(qoaplay_desc *qoa_ctx);
 
 void qoaplay_rewind(qoaplay_desc *qoa_ctx);
 void qoaplay_seek_frame(qoaplay_desc *qoa_ctx, int frame);
+void qoaplay_seek_sample(qoaplay_desc *qoa_ctx, int sample);
 unsigned int qoaplay_decode(qoaplay_desc *qoa_ctx, float *sample_data, int num_samples);
 unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx);
 double qoaplay_get_duration(qoaplay_desc *qoa_ctx);
@@ -126,36 +129,51 @@ qoaplay_desc *qoaplay_open(const char *path)
 }
 
 // Open QOA file from memory, no FILE pointer required
+// NOTE: File data is copied to be managed internally
 qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size)
 {
-    // Read and decode the file header
-    unsigned char header[QOA_MIN_FILESIZE];
-    memcpy(header, data, QOA_MIN_FILESIZE);
+    if ((data == NULL) || (data_size < QOA_MIN_FILESIZE)) return NULL;
+
+    unsigned char *file_data = (unsigned char *)QOA_MALLOC(data_size);
+    memcpy(file_data, data, data_size);
+
+    qoaplay_desc *qoa_ctx = qoaplay_open_memory_shared(file_data, data_size);
+
+    if (qoa_ctx != NULL) qoa_ctx->file_data_shared = 0;
+    else QOA_FREE(file_data);
+
+    return qoa_ctx;
+}
 
+// Open QOA file from memory, no FILE pointer required
+// NOTE: File data is not copied, it must be kept valid until qoaplay_close(), frames are decoded directly from it
+qoaplay_desc *qoaplay_open_memory_shared(const unsigned char *data, int data_size)
+{
+    if ((data == NULL) || (data_size < QOA_MIN_FILESIZE)) return NULL;
+
+    // Read and decode the file header
     qoa_desc qoa;
-    unsigned int first_frame_pos = qoa_decode_header(header, QOA_MIN_FILESIZE, &qoa);
+    unsigned int first_frame_pos = qoa_decode_header(data, QOA_MIN_FILESIZE, &qoa);
     if (!first_frame_pos) return NULL;
 
     // Allocate one chunk of memory for the qoaplay_desc struct
     // + the sample data for one frame
-    // + a buffer to hold one frame of encoded data
-    unsigned int buffer_size = qoa_max_frame_size(&qoa);
+    // NOTE: No buffer is required to hold encoded frames, they are decoded from file data
     unsigned int sample_data_size = qoa.channels*QOA_FRAME_LEN*sizeof(short)*2;
-    qoaplay_desc *qoa_ctx = QOA_MALLOC(sizeof(qoaplay_desc) + buffer_size + sample_data_size);
+    qoaplay_desc *qoa_ctx = QOA_MALLOC(sizeof(qoaplay_desc) + sample_data_size);
     memset(qoa_ctx, 0, sizeof(qoaplay_desc));
 
     qoa_ctx->file = NULL;
 
-    // Keep a copy of file data provided to be managed internally
-    qoa_ctx->file_data = (unsigned char *)QOA_MALLOC(data_size);
-    memcpy(qoa_ctx->file_data, data, data_size);
+    qoa_ctx->file_data = (unsigned char *)data;
+    qoa_ctx->file_data_shared = 1;
     qoa_ctx->file_data_size = data_size;
-    qoa_ctx->file_data_offset = 0;
+    qoa_ctx->file_data_offset = first_frame_pos;
     qoa_ctx->first_frame_pos = first_frame_pos;
 
     // Setup data pointers to previously allocated data
-    qoa_ctx->buffer = ((unsigned char *)qoa_ctx) + sizeof(qoaplay_desc);
-    qoa_ctx->sample_data = (short *)(((unsigned char *)qoa_ctx) + sizeof(qoaplay_desc) + buffer_size);
+    qoa_ctx->buffer = NULL;
+    qoa_ctx->sample_data = (short *)(((unsigned char *)qoa_ctx) + sizeof(qoaplay_desc));
 
     qoa_ctx->info.channels = qoa.channels;
     qoa_ctx->info.samplerate = qoa.samplerate;
@@ -169,7 +187,7 @@ void qoaplay_close(qoaplay_desc *qoa_ctx)
 {
     if (qoa_ctx->file) fclose(qoa_ctx->file);
 
-    if ((qoa_ctx->file_data) && (qoa_ctx->file_data_size > 0))
+    if ((qoa_ctx->file_data) && (qoa_ctx->file_data_size > 0) && !qoa_ctx->file_data_shared)
     {
         QOA_FREE(qoa_ctx->file_data);
         qoa_ctx->file_data_size = 0;
@@ -181,16 +199,23 @@ void qoaplay_close(qoaplay_desc *qoa_ctx)
 // Decode one frame from QOA data
 unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx)
 {
+    const unsigned char *frame_data = qoa_ctx->buffer;
+
     if (qoa_ctx->file) qoa_ctx->buffer_len = fread(qoa_ctx->buffer, 1, qoa_max_frame_size(&qoa_ctx->info), qoa_ctx->file);
     else
     {
+        // Frame is decoded directly from memory, last frame can be shorter than maximum frame size
+        unsigned int data_left = (qoa_ctx->file_data_offset < qoa_ctx->file_data_size)? qoa_ctx->file_data_size - qoa_ctx->file_data_offset : 0;
+
         qoa_ctx->buffer_len = qoa_max_frame_size(&qoa_ctx->info);
-        memcpy(qoa_ctx->buffer, qoa_ctx->file_data + qoa_ctx->file_data_offset, qoa_ctx->buffer_len);
+        if (qoa_ctx->buffer_len > data_left) qoa_ctx->buffer_len = data_left;
+
+        frame_data = qoa_ctx->file_data + qoa_ctx->file_data_offset;
         qoa_ctx->file_data_offset += qoa_ctx->buffer_len;
     }
 
     unsigned int frame_len;
-    qoa_decode_frame(qoa_ctx->buffer, qoa_ctx->buffer_len, &qoa_ctx->info, qoa_ctx->sample_data, &frame_len);
+    qoa_decode_frame(frame_data, qoa_ctx->buffer_len, &qoa_ctx->info, qoa_ctx->sample_data, &frame_len);
     qoa_ctx->sample_data_pos = 0;
     qoa_ctx->sample_data_len = frame_len;
 
@@ -201,7 +226,7 @@ unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx)
 void qoaplay_rewind(qoaplay_desc *qoa_ctx)
 {
     if (qoa_ctx->file) fseek(qoa_ctx->file, qoa_ctx->first_frame_pos, SEEK_SET);
-    else qoa_ctx->file_data_offset = 0;
+    else qoa_ctx->file_data_offset = qoa_ctx->first_frame_pos;
 
     qoa_ctx->sample_position = 0;
     qoa_ctx->sample_data_len = 0;
@@ -276,3 +301,22 @@ void qoaplay_seek_frame(qoaplay_desc *qoa_ctx, int frame)
     if (qoa_ctx->file) fseek(qoa_ctx->file, offset, SEEK_SET);
     else qoa_ctx->file_data_offset = offset;
 }
+
+// Seek QOA audio sample, frame containing the sample is decoded
+// NOTE: QOA frames have a fixed size, seeking does not depend on position
+void qoaplay_seek_sample(qoaplay_desc *qoa_ctx, int sample)
+{
+    if (sample < 0) sample = 0;
+
+    qoaplay_seek_frame(qoa_ctx, sample/QOA_FRAME_LEN);
+
+    unsigned int samples_to_skip = sample - qoa_ctx->sample_position;
+
+    if ((samples_to_skip > 0) && qoaplay_decode_frame(qoa_ctx))
+    {
+        if (samples_to_skip > qoa_ctx->sample_data_len) samples_to_skip = qoa_ctx->sample_data_len;
+
+        qoa_ctx->sample_data_pos = samples_to_skip;
+        qoa_ctx->sample_position += samples_to_skip;
+    }
+}
@@ -28,6 +28,14 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define RAUDIO_NO_SIMD
+*           Disable SIMD intrinsics on mixing kernels, scalar code is used.
+*           By default SSE2 is used on x86-64 and NEON on ARM64
+*
+*       #define SUPPORT_MUSIC_STREAMING_THREAD
+*           Music streams are decoded on a dedicated thread, streams buffers are kept filled ahead
+*           by MUSIC_STREAMING_LATENCY_MS, UpdateMusicStream() does not decode data on calling thread
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -184,10 +192,28 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// SIMD intrinsics used by mixing kernels
+// NOTE: Scalar code is used on other architectures or if RAUDIO_NO_SIMD is defined
+#if !defined(RAUDIO_NO_SIMD) && !defined(__TINYC__)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RAUDIO_SSE2
+        #include <emmintrin.h>          // Required for: SSE2 intrinsics
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define RAUDIO_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics
+    #endif
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
     #endif
+    #ifndef PROFILE_ZONE_BEGIN
+        #define PROFILE_ZONE_BEGIN(name) (void)0
+    #endif
+    #ifndef PROFILE_ZONE_END
+        #define PROFILE_ZONE_END() (void)0
+    #endif
 
     // Allow custom memory allocators
     #ifndef RL_MALLOC
@@ -295,8 +321,28 @@ typedef struct tagBITMAPINFOHEADER {
     #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device output sample rate
 #endif
 
-#ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
-    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                  64    // Maximum number of sounds mixed (real voices), other playing sounds are virtual
+#endif
+#ifndef AUDIO_VOICE_MIN_VOLUME
+    #define AUDIO_VOICE_MIN_VOLUME        0.001f    // Sounds with lower volume are inaudible (-60 dB), never mixed
+#endif
+
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE        1024    // Mixer commands queue size, must be a power of 2
+#endif
+
+#ifndef AUDIO_MIXER_GAIN_RAMP_FRAMES
+    #define AUDIO_MIXER_GAIN_RAMP_FRAMES     256    // Frames to ramp audio buffers gain to new volume and pan, avoids clicks
+#endif
+
+#ifndef MUSIC_STREAMING_LATENCY_MS
+    #define MUSIC_STREAMING_LATENCY_MS       100    // Music streams data decoded ahead by streaming thread (milliseconds)
+#endif
+
+// Music streaming thread requires threads support, not available on web without pthreads
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #undef SUPPORT_MUSIC_STREAMING_THREAD
 #endif
 
 //----------------------------------------------------------------------------------
@@ -315,6 +361,14 @@ typedef enum {
     LOG_FATAL,          // Fatal logging, used to abort program: exit(EXIT_FAILURE)
     LOG_NONE            // Disable logging
 } TraceLogLevel;
+
+// Mapped file, read-only file data
+// NOTE: On standalone mode file data is always loaded, not mapped
+typedef struct MappedFile {
+    const unsigned char *data;      // File data (read-only)
+    int dataSize;                   // File data size in bytes
+    bool mapped;                    // File data is mapped to memory, not loaded
+} MappedFile;
 #endif
 
 // Music context type
@@ -338,31 +392,84 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Mixer commands, requested by program threads and executed by the audio thread
+// NOTE: The audio thread never waits for program threads, all state changes go through the commands queue
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Add audio buffer to mixer list
+    AUDIO_COMMAND_UNTRACK,          // Remove audio buffer from mixer list
+    AUDIO_COMMAND_UNLOAD,           // Remove audio buffer from mixer list and release it (param: free buffer data)
+    AUDIO_COMMAND_PLAY,             // Play audio buffer from the start (param: play request id)
+    AUDIO_COMMAND_STOP,             // Stop audio buffer (param: stream write cursor at stop)
+    AUDIO_COMMAND_PAUSE,            // Pause audio buffer
+    AUDIO_COMMAND_RESUME,           // Resume audio buffer
+    AUDIO_COMMAND_VOLUME,           // Set audio buffer volume (value)
+    AUDIO_COMMAND_PITCH,            // Set audio buffer pitch (value)
+    AUDIO_COMMAND_PAN,              // Set audio buffer pan (value)
+    AUDIO_COMMAND_PRIORITY,         // Set audio buffer voice priority (param)
+    AUDIO_COMMAND_CALLBACK,         // Set audio buffer callback (callback)
+    AUDIO_COMMAND_ATTACH,           // Attach processor to audio buffer or mixed output if buffer is NULL (processor)
+    AUDIO_COMMAND_DETACH,           // Detach processors from audio buffer or mixed output if buffer is NULL (callback)
+    AUDIO_COMMAND_UPDATE            // Copy frames into static audio buffer data (data, param: data size in bytes)
+} AudioCommandType;
+
+typedef struct MusicStreamEntry MusicStreamEntry;
+
 // Audio buffer struct
+// NOTE: Fields marked (mixer) are only accessed by audio thread once the buffer is tracked, fields marked (atomic)
+// are shared between threads, stream data is shared through a single-producer/single-consumer ring buffer
 struct rAudioBuffer {
-    ma_data_converter converter;    // Audio data converter
+    ma_data_converter converter;    // Audio data converter (mixer)
 
-    AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads
-    rAudioProcessor *processor;     // Audio processor
+    AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads (mixer)
+    rAudioProcessor *processor;     // Audio processor (mixer)
 
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
+    int priority;                   // Audio buffer voice priority, higher priority sounds are mixed first
 
     bool playing;                   // Audio buffer state: AUDIO_PLAYING
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    unsigned int playCount;         // Audio buffer play requests counter
+    ma_uint32 endedCount;           // Audio buffer last play request ended by mixer (atomic)
+
+    float mixVolume;                // Audio buffer volume (mixer)
+    float mixPan;                   // Audio buffer pan (mixer)
+    float mixPitch;                 // Audio buffer pitch (mixer)
+    float mixGain[2];               // Audio buffer channels gain mixed, from volume and pan (mixer)
+    float mixGainTarget[2];         // Audio buffer channels gain being ramped to (mixer)
+    float mixGainStep[2];           // Audio buffer channels gain increment per frame while ramping (mixer)
+    unsigned int mixRampFrames;     // Audio buffer frames left to reach target gain (mixer)
+    bool mixGainReady;              // Audio buffer gain set since last play request, no ramp on play (mixer)
+    bool mixPlaying;                // Audio buffer playing state (mixer)
+    bool mixPaused;                 // Audio buffer paused state (mixer)
+    unsigned int mixPlayCount;      // Audio buffer play request being mixed (mixer)
+    int mixPriority;                // Audio buffer voice priority (mixer)
+    bool mixVoice;                  // Audio buffer is on voices list (mixer)
+    bool mixVoiceRanked;            // Audio buffer sound ranked to be mixed on current callback (mixer)
+    bool mixVoiceReal;              // Audio buffer voice mixed on current callback, not virtual (mixer)
+    bool mixVoiceFading;            // Audio buffer voice stolen, mixed until gain is ramped to silence (mixer)
+    ma_uint64 mixVirtualRemainder;  // Audio buffer virtual voice cursor advance remainder, resampling (mixer)
+
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
+    unsigned int frameCursorPos;    // Frame cursor position, static buffers (mixer)
+    ma_uint32 readCursor;           // Stream ring read cursor, in [0..2*sizeInFrames) range (atomic, mixer)
+    ma_uint32 writeCursor;          // Stream ring write cursor, in [0..2*sizeInFrames) range (atomic)
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    MappedFile file;                // Music file mapped to memory, music decoded from it (if required)
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    MusicStreamEntry *streamEntry;  // Music stream decoded by streaming thread, NULL if not registered
+#endif
 
-    rAudioBuffer *next;             // Next audio buffer on the list
-    rAudioBuffer *prev;             // Previous audio buffer on the list
+    rAudioBuffer *next;             // Next audio buffer on the list (mixer)
+    rAudioBuffer *prev;             // Previous audio buffer on the list (mixer)
+    rAudioBuffer *nextVoice;        // Next audio buffer on the voices list (mixer)
+    rAudioBuffer *prevVoice;        // Previous audio buffer on the voices list (mixer)
 };
 
 // Audio processor struct
@@ -375,22 +482,77 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Mixer command struct
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Audio buffer to apply command
+    rAudioProcessor *processor;     // Audio processor to attach
+    AudioCallback callback;         // Audio callback to set or processor callback to detach
+    void *data;                     // Command data, freed by program threads once released by mixer
+    float value;                    // Command value: volume, pitch, pan
+    unsigned int param;             // Command parameter
+} AudioCommand;
+
+// Music stream entry, decoded by music streaming thread
+// NOTE: While the entry is registered, music decoder context and entry state are accessed by streaming thread
+// only while entry is marked as decoding, and by program threads holding the streaming lock once it is not
+struct MusicStreamEntry {
+    Music music;                    // Music stream decoded
+    ma_uint32 looping;              // Music looping, updated by UpdateMusicStream() (atomic)
+    bool decoding;                  // Music is being decoded by streaming thread, outside of streaming lock
+    int lockRequests;               // Program threads waiting for music decoding to finish, decoding is not restarted
+    ma_event decodedEvent;          // Music decoding finished event, signaled if program threads are waiting
+    bool active;                    // Music is streamed, from play request to stop request or music end
+    bool ended;                     // Music has been fully streamed, stopped once queued frames are played
+    unsigned int latencyInFrames;   // Frames to keep queued in stream ring buffer
+    MusicStreamEntry *next;         // Next music stream entry on the list
+};
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock, program threads only, never locked by audio thread
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
     struct {
-        AudioBuffer *first;         // Pointer to first AudioBuffer in the list
-        AudioBuffer *last;          // Pointer to last AudioBuffer in the list
+        AudioBuffer *first;         // Pointer to first AudioBuffer in the list (mixer)
+        AudioBuffer *last;          // Pointer to last AudioBuffer in the list (mixer)
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
-    rAudioProcessor *mixedProcessor;
+    struct {
+        AudioBuffer *first;         // Pointer to first playing AudioBuffer (voice) in the list (mixer)
+        AudioBuffer *last;          // Pointer to last playing AudioBuffer (voice) in the list (mixer)
+        AudioBuffer *ranked[MAX_AUDIO_VOICES];  // Sounds voices ranked by priority and volume, mixed ones (mixer)
+        ma_uint32 maxReal;          // Maximum number of sounds mixed, real voices (atomic)
+        ma_uint32 realCount;        // Voices mixed on last callback, sounds and streams (atomic)
+        ma_uint32 virtualCount;     // Voices not mixed on last callback, cursor advanced only (atomic)
+        ma_uint32 stolenCount;      // Real voices turned virtual by higher ranked voices, since device init (atomic)
+    } Voice;
+    struct {
+        AudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE];       // Commands queue: program threads -> mixer
+        ma_uint32 head;             // Commands queue write position (atomic)
+        ma_uint32 tail;             // Commands queue read position (atomic)
+        AudioCommand released[AUDIO_COMMAND_QUEUE_SIZE];    // Released resources queue: mixer -> program threads
+        ma_uint32 releasedHead;     // Released resources queue write position (atomic)
+        ma_uint32 releasedTail;     // Released resources queue read position (atomic)
+    } Command;
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    struct {
+        ma_thread thread;           // Music streaming thread
+        ma_mutex lock;              // Music streams list lock, only held by streaming thread to pick and release entries
+        ma_event wakeUpEvent;       // Music streaming thread wake up event, waited while no music is streamed
+        ma_uint32 isRunning;        // Check if music streaming thread is running (atomic)
+        ma_uint32 wakeUp;           // Music streaming thread wake up request, on music play (atomic)
+        MusicStreamEntry *first;    // Pointer to first music stream entry in the list
+        size_t pcmBufferSize;       // Pre-allocated buffer size
+        void *pcmBuffer;            // Pre-allocated buffer to decode music data, streaming thread
+    } Streaming;
+#endif
+    rAudioProcessor *mixedProcessor;    // Mixed output processors (mixer)
 } AudioData;
 
 //----------------------------------------------------------------------------------
@@ -403,6 +565,7 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Voice.maxReal = MAX_AUDIO_VOICES,
     .mixedProcessor = NULL
 };
 
@@ -417,10 +580,33 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
-
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
+static void MixAudioFramesWithGain(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, const float *gain, const float *gainStep);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *laneGain, const float *laneStep);
+
+static void PushAudioCommand(AudioCommand command);
+static void ProcessAudioCommands(void);
+static bool PushReleasedAudioResource(AudioCommand resource);
+static void FreeReleasedAudioResources(void);
+static void EndAudioBufferPlaying(AudioBuffer *buffer);
+static void AddAudioVoice(AudioBuffer *buffer);
+static void RemoveAudioVoice(AudioBuffer *buffer);
+static void UpdateAudioVoices(void);
+static void AdvanceVirtualVoice(AudioBuffer *buffer, ma_uint32 frameCount);
+static unsigned int GetAudioBufferQueuedFrames(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static AudioStream LoadAudioStreamWithLatency(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int latencyInFrames);
+static AudioStream LoadMusicAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels);
+
+static void ReadMusicStreamFrames(Music music, void *framesOut, unsigned int frameCount);
+static void RewindMusicStream(Music music);
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+static ma_thread_result MA_THREADCALL MusicStreamingThread(void *userData);
+static bool StreamMusicFrames(MusicStreamEntry *entry);
+static void LockMusicStreamEntry(MusicStreamEntry *entry);
+static void RegisterMusicStream(Music music);
+static void UnregisterMusicStream(Music music);
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -431,6 +617,8 @@ static const char *GetFileNameWithoutExt(const char *filePath);     // Get filen
 static unsigned char *LoadFileData(const char *fileName, int *dataSize);    // Load file data as byte array (read)
 static bool SaveFileData(const char *fileName, void *data, int dataSize);   // Save data to file from byte array (write)
 static bool SaveFileText(const char *fileName, char *text);         // Save text data to file (write), string must be '\0' terminated
+static MappedFile LoadMappedFile(const char *fileName);             // Load file data (read-only), file data is loaded, not mapped
+static void UnloadMappedFile(MappedFile file);                      // Unload file data loaded by LoadMappedFile()
 #endif
 
 //----------------------------------------------------------------------------------
@@ -448,6 +636,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -490,8 +679,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixing happens on a separate thread, program threads send mixer commands through a lock-free queue
+    // NOTE: Mutex only serializes program threads calling audio functions, audio thread never waits on it
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -500,6 +689,8 @@ void InitAudioDevice(void)
         return;
     }
 
+    ma_atomic_store_32(&AUDIO.Voice.stolenCount, 0);
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
     result = ma_device_start(&AUDIO.System.device);
@@ -519,6 +710,33 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
     AUDIO.System.isReady = true;
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    // Music streams decoding happens on a dedicated thread, never on program threads or audio thread
+    // NOTE: If thread can not be created, music streams are decoded by UpdateMusicStream()
+    if (ma_mutex_init(&AUDIO.Streaming.lock) != MA_SUCCESS) TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for music streaming");
+    else if (ma_event_init(&AUDIO.Streaming.wakeUpEvent) != MA_SUCCESS)
+    {
+        ma_mutex_uninit(&AUDIO.Streaming.lock);
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create event for music streaming");
+    }
+    else
+    {
+        ma_atomic_store_32(&AUDIO.Streaming.isRunning, 1);
+
+        if (ma_thread_create(&AUDIO.Streaming.thread, ma_thread_priority_default, 0, MusicStreamingThread, NULL, NULL) == MA_SUCCESS)
+        {
+            TRACELOG(LOG_INFO, "    > Music streaming: Thread, %i ms latency", MUSIC_STREAMING_LATENCY_MS);
+        }
+        else
+        {
+            ma_atomic_store_32(&AUDIO.Streaming.isRunning, 0);
+            ma_event_uninit(&AUDIO.Streaming.wakeUpEvent);
+            ma_mutex_uninit(&AUDIO.Streaming.lock);
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to create music streaming thread");
+        }
+    }
+#endif
 }
 
 // Close the audio device for all contexts
@@ -526,11 +744,44 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+        if (ma_atomic_load_32(&AUDIO.Streaming.isRunning))
+        {
+            ma_atomic_store_32(&AUDIO.Streaming.isRunning, 0);
+            ma_event_signal(&AUDIO.Streaming.wakeUpEvent);
+            ma_thread_wait(&AUDIO.Streaming.thread);
+
+            // Music streams not unloaded are decoded by UpdateMusicStream() from now on
+            while (AUDIO.Streaming.first != NULL)
+            {
+                MusicStreamEntry *entry = AUDIO.Streaming.first;
+                AUDIO.Streaming.first = entry->next;
+                entry->music.stream.buffer->streamEntry = NULL;
+                ma_event_uninit(&entry->decodedEvent);
+                RL_FREE(entry);
+            }
+
+            ma_event_uninit(&AUDIO.Streaming.wakeUpEvent);
+            ma_mutex_uninit(&AUDIO.Streaming.lock);
+
+            RL_FREE(AUDIO.Streaming.pcmBuffer);
+            AUDIO.Streaming.pcmBuffer = NULL;
+            AUDIO.Streaming.pcmBufferSize = 0;
+        }
+#endif
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
         AUDIO.System.isReady = false;
+
+        // Audio thread is not running anymore, pending commands are processed on this thread
+        ma_mutex_lock(&AUDIO.System.lock);
+        ProcessAudioCommands();
+        FreeReleasedAudioResources();
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        ma_mutex_uninit(&AUDIO.System.lock);
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -560,6 +811,34 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Set maximum number of sounds mixed (real voices)
+// NOTE: Other playing sounds are virtual voices, not mixed until they rank high enough, audio streams are always mixed
+void SetAudioMaxVoices(int count)
+{
+    if (count < 0) count = 0;
+    else if (count > MAX_AUDIO_VOICES) count = MAX_AUDIO_VOICES;
+
+    ma_atomic_store_32(&AUDIO.Voice.maxReal, (ma_uint32)count);
+}
+
+// Get number of voices mixed (real voices), sounds and audio streams
+int GetAudioRealVoices(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voice.realCount);
+}
+
+// Get number of playing sounds not mixed (virtual voices), inaudible or lower ranked
+int GetAudioVirtualVoices(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voice.virtualCount);
+}
+
+// Get number of voices stolen, real voices turned virtual by higher ranked sounds, since audio device initialization
+int GetAudioStolenVoices(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voice.stolenCount);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -595,6 +874,10 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
 
+    audioBuffer->mixVolume = 1.0f;
+    audioBuffer->mixPan = 0.5f;
+    audioBuffer->mixPitch = 1.0f;
+
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
@@ -606,10 +889,10 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
 
-    // Buffers should be marked as processed by default so that a call to
+    // Stream ring buffer is empty by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+    audioBuffer->readCursor = 0;
+    audioBuffer->writeCursor = 0;
 
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
@@ -618,24 +901,30 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer memory is freed once the mixer has released it
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
+        ma_mutex_lock(&AUDIO.System.lock);
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNLOAD, .buffer = buffer, .param = 1 });
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing
+// NOTE: Play requests not processed yet by mixer are considered playing
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        result = (buffer->playing && !buffer->paused && (ma_atomic_load_32(&buffer->endedCount) != buffer->playCount));
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+
     return result;
 }
 
@@ -649,17 +938,25 @@ void PlayAudioBuffer(AudioBuffer *buffer)
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->playing = true;
         buffer->paused = false;
-        buffer->frameCursorPos = 0;
+        buffer->playCount++;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer, .param = buffer->playCount });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer
+// NOTE: Stream queued frames are discarded
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        buffer->playing = false;
+        buffer->paused = false;
+        buffer->framesProcessed = 0;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer, .param = ma_atomic_load_32(&buffer->writeCursor) });
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
 }
 
 // Pause an audio buffer
@@ -669,6 +966,7 @@ void PauseAudioBuffer(AudioBuffer *buffer)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->paused = true;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAUSE, .buffer = buffer });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -680,6 +978,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->paused = false;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_RESUME, .buffer = buffer });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -691,24 +990,20 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->volume = volume;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Set pitch for an audio buffer
+// NOTE: Data converter sample rate is updated by the mixer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
         buffer->pitch = pitch;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -723,6 +1018,20 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->pan = pan;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan });
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set voice priority for an audio buffer
+// NOTE: When more sounds than maximum voices are playing, lower priority sounds are not mixed (virtual voices)
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority)
+{
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        buffer->priority = priority;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PRIORITY, .buffer = buffer, .param = (unsigned int)priority });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -731,16 +1040,7 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -748,16 +1048,7 @@ void TrackAudioBuffer(AudioBuffer *buffer)
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer });
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -770,14 +1061,13 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Mapping file to memory, file data is decoded from disk pages, not copied to a memory buffer
+    MappedFile file = LoadMappedFile(fileName);
 
     // Loading wave from memory data
-    if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
+    if (file.data != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), file.data, file.dataSize);
 
-    UnloadFileData(fileData);
+    UnloadMappedFile(file);
 
     return wave;
 }
@@ -979,8 +1269,8 @@ Sound LoadSoundAlias(Sound source)
         }
 
         audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
-        audioBuffer->volume = source.stream.buffer->volume;
         audioBuffer->data = source.stream.buffer->data;
+        SetAudioBufferVolume(audioBuffer, source.stream.buffer->volume);
 
         sound.frameCount = source.frameCount;
         sound.stream.sampleRate = AUDIO.System.device.sampleRate;
@@ -1026,9 +1316,9 @@ void UnloadSoundAlias(Sound alias)
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
+        ma_mutex_lock(&AUDIO.System.lock);
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNLOAD, .buffer = alias.stream.buffer, .param = 0 });
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
@@ -1037,9 +1327,26 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
-        StopAudioBuffer(sound.stream.buffer);
+        unsigned int size = frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn);
+        void *update = RL_MALLOC(size);
+
+        if (update != NULL)
+        {
+            AudioBuffer *buffer = sound.stream.buffer;
+
+            // NOTE: Sound data could still be read by mixer (also through sound aliases),
+            // frames are copied by mixer once the stop request is processed
+            memcpy(update, data, size);
 
-        memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
+            ma_mutex_lock(&AUDIO.System.lock);
+            buffer->playing = false;
+            buffer->paused = false;
+            buffer->framesProcessed = 0;
+            PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer, .param = ma_atomic_load_32(&buffer->writeCursor) });
+            PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UPDATE, .buffer = buffer, .data = update, .param = size });
+            ma_mutex_unlock(&AUDIO.System.lock);
+        }
+        else TRACELOG(LOG_WARNING, "SOUND: Failed to allocate memory for sound update");
     }
 }
 
@@ -1220,6 +1527,12 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set priority for a sound
+void SetSoundPriority(Sound sound, int priority)
+{
+    SetAudioBufferPriority(sound.stream.buffer, priority);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1331,24 +1644,34 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (IsFileExtension(fileName, ".wav"))
     {
+        // Music data is decoded from file mapped to memory, file is unmapped on UnloadMusicStream()
+        MappedFile file = LoadMappedFile(fileName);
         drwav *ctxWav = RL_CALLOC(1, sizeof(drwav));
-        bool success = drwav_init_file(ctxWav, fileName, NULL);
+        bool success = ((file.data != NULL) && drwav_init_memory(ctxWav, file.data, file.dataSize, NULL));
 
         if (success)
         {
-            music.ctxType = MUSIC_AUDIO_WAV;
-            music.ctxData = ctxWav;
             int sampleSize = ctxWav->bitsPerSample;
             if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.stream = LoadMusicAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            success = (music.stream.buffer != NULL);
+        }
+
+        if (success)
+        {
+            music.ctxType = MUSIC_AUDIO_WAV;
+            music.ctxData = ctxWav;
+            music.stream.buffer->file = file;
             music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
         }
         else
         {
+            drwav_uninit(ctxWav);
             RL_FREE(ctxWav);
+            UnloadMappedFile(file);
         }
     }
 #endif
@@ -1365,7 +1688,7 @@ Music LoadMusicStream(const char *fileName)
             stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
 
             // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+            music.stream = LoadMusicAudioStream(info.sample_rate, 16, info.channels);
 
             // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
             music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
@@ -1388,7 +1711,7 @@ Music LoadMusicStream(const char *fileName)
         {
             music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
-            music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.stream = LoadMusicAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1402,20 +1725,28 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_QOA)
     else if (IsFileExtension(fileName, ".qoa"))
     {
-        qoaplay_desc *ctxQoa = qoaplay_open(fileName);
+        // Music data is decoded from file mapped to memory, file is unmapped on UnloadMusicStream()
+        MappedFile file = LoadMappedFile(fileName);
+        qoaplay_desc *ctxQoa = qoaplay_open_memory_shared(file.data, file.dataSize);
 
-        if (ctxQoa != NULL)
+        // NOTE: We are loading samples are 32bit float normalized data, so,
+        // we configure the output audio stream to also use float 32bit
+        if (ctxQoa != NULL) music.stream = LoadMusicAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+
+        if ((ctxQoa != NULL) && (music.stream.buffer != NULL))
         {
             music.ctxType = MUSIC_AUDIO_QOA;
             music.ctxData = ctxQoa;
-            // NOTE: We are loading samples are 32bit float normalized data, so,
-            // we configure the output audio stream to also use float 32bit
-            music.stream = LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.stream.buffer->file = file;
             music.frameCount = ctxQoa->info.samples;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
         }
-        else{} //No uninit required
+        else
+        {
+            if (ctxQoa != NULL) qoaplay_close(ctxQoa);
+            UnloadMappedFile(file);
+        }
     }
 #endif
 #if defined(SUPPORT_FILEFORMAT_FLAC)
@@ -1427,7 +1758,7 @@ Music LoadMusicStream(const char *fileName)
         {
             music.ctxType = MUSIC_AUDIO_FLAC;
             music.ctxData = ctxFlac;
-            music.stream = LoadAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
+            music.stream = LoadMusicAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
             music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1455,7 +1786,7 @@ Music LoadMusicStream(const char *fileName)
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1479,7 +1810,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxType = MUSIC_MODULE_MOD;
             music.ctxData = ctxMod;
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1505,6 +1836,10 @@ Music LoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+        RegisterMusicStream(music);     // Music stream decoded by streaming thread, if running
+#endif
     }
 
     return music;
@@ -1532,7 +1867,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             int sampleSize = ctxWav->bitsPerSample;
             if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.stream = LoadMusicAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
             music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1556,7 +1891,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
 
             // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+            music.stream = LoadMusicAudioStream(info.sample_rate, 16, info.channels);
 
             // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
             music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
@@ -1579,7 +1914,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         {
             music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
-            music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.stream = LoadMusicAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1606,7 +1941,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxQoa;
             // NOTE: We are loading samples are 32bit float normalized data, so,
             // we configure the output audio stream to also use float 32bit
-            music.stream = LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.stream = LoadMusicAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
             music.frameCount = ctxQoa->info.samples;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1623,7 +1958,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         {
             music.ctxType = MUSIC_AUDIO_FLAC;
             music.ctxData = ctxFlac;
-            music.stream = LoadAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
+            music.stream = LoadMusicAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
             music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1650,7 +1985,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, 2);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, bits, 2);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1690,7 +2025,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxMod;
 
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, 2);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, 16, 2);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1716,6 +2051,10 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+        RegisterMusicStream(music);     // Music stream decoded by streaming thread, if running
+#endif
     }
 
     return music;
@@ -1734,13 +2073,21 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    UnregisterMusicStream(music);   // Streaming thread does not access music decoder anymore
+#endif
+
+    // Music file mapped to memory is unmapped once music decoder is closed
+    MappedFile file = { 0 };
+    if (music.stream.buffer != NULL) file = music.stream.buffer->file;
+
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
     {
         if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
-        else if (music.ctxType == MUSIC_AUDIO_WAV) drwav_uninit((drwav *)music.ctxData);
+        else if (music.ctxType == MUSIC_AUDIO_WAV) { drwav_uninit((drwav *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
 #if defined(SUPPORT_FILEFORMAT_OGG)
         else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
@@ -1761,11 +2108,39 @@ void UnloadMusicStream(Music music)
         else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
     }
+
+    UnloadMappedFile(file);
 }
 
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->streamEntry != NULL))
+    {
+        MusicStreamEntry *entry = music.stream.buffer->streamEntry;
+
+        LockMusicStreamEntry(entry);
+
+        // Music fully streamed but not stopped yet, restart it from beginning
+        if (entry->ended)
+        {
+            StopAudioStream(music.stream);
+            RewindMusicStream(music);
+        }
+
+        ma_atomic_store_32(&entry->looping, (ma_uint32)music.looping);
+        entry->active = true;
+        entry->ended = false;
+
+        ma_mutex_unlock(&AUDIO.Streaming.lock);
+
+        // Stream buffer is filled by streaming thread without waiting for its next update
+        ma_atomic_store_32(&AUDIO.Streaming.wakeUp, 1);
+        ma_event_signal(&AUDIO.Streaming.wakeUpEvent);
+    }
+#endif
+
     PlayAudioStream(music.stream);
 }
 
@@ -1784,33 +2159,23 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
-    StopAudioStream(music.stream);
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    MusicStreamEntry *entry = (music.stream.buffer != NULL)? music.stream.buffer->streamEntry : NULL;
 
-    switch (music.ctxType)
+    if (entry != NULL)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+        LockMusicStreamEntry(entry);
+        entry->active = false;
+        entry->ended = false;
+    }
 #endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+
+    StopAudioStream(music.stream);
+    RewindMusicStream(music);
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    if (entry != NULL) ma_mutex_unlock(&AUDIO.Streaming.lock);
 #endif
-        default: break;
-    }
 }
 
 // Seek music to a certain position (in seconds)
@@ -1821,6 +2186,11 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    MusicStreamEntry *entry = (music.stream.buffer != NULL)? music.stream.buffer->streamEntry : NULL;
+    if (entry != NULL) LockMusicStreamEntry(entry);
+#endif
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1835,10 +2205,8 @@ void SeekMusicStream(Music music, float position)
 #if defined(SUPPORT_FILEFORMAT_QOA)
         case MUSIC_AUDIO_QOA:
         {
-            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
-            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
-
-            // We need to compute QOA frame number and update positionInFrames
+            // QOA frames have a fixed size, frame containing position is found and decoded directly
+            qoaplay_seek_sample((qoaplay_desc *)music.ctxData, positionInFrames);
             positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
         } break;
 #endif
@@ -1851,6 +2219,10 @@ void SeekMusicStream(Music music, float position)
     ma_mutex_lock(&AUDIO.System.lock);
     music.stream.buffer->framesProcessed = positionInFrames;
     ma_mutex_unlock(&AUDIO.System.lock);
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    if (entry != NULL) ma_mutex_unlock(&AUDIO.Streaming.lock);
+#endif
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1858,6 +2230,17 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    // Music stream decoded by streaming thread, only music looping state is updated
+    if (music.stream.buffer->streamEntry != NULL)
+    {
+        ma_atomic_store_32(&music.stream.buffer->streamEntry->looping, (ma_uint32)music.looping);
+        return;
+    }
+#endif
+
+    PROFILE_ZONE_BEGIN("UpdateMusicStream");
+
     ma_mutex_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -1873,10 +2256,10 @@ void UpdateMusicStream(Music music)
         AUDIO.System.pcmBufferSize = pcmSize;
     }
 
-    // Check both sub-buffers to check if they require refilling
+    // Refill stream ring buffer, one sub-buffer size at a time, up to two sub-buffers
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (GetAudioBufferQueuedFrames(music.stream.buffer) > subBufferSizeInFrames) break; // No refilling required
 
         unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
@@ -1884,116 +2267,7 @@ void UpdateMusicStream(Music music)
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        ReadMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
@@ -2006,12 +2280,15 @@ void UpdateMusicStream(Music music)
                 ma_mutex_unlock(&AUDIO.System.lock);
                 // Streaming is ending, we filled latest frames from input
                 StopMusicStream(music);
+                PROFILE_ZONE_END();
                 return;
             }
         }
     }
 
     ma_mutex_unlock(&AUDIO.System.lock);
+
+    PROFILE_ZONE_END();
 }
 
 // Check if any music is playing
@@ -2059,20 +2336,26 @@ float GetMusicTimePlayed(Music music)
         {
             uint64_t framesPlayed = 0;
 
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+            // Module context is accessed by streaming thread while decoding
+            MusicStreamEntry *entry = music.stream.buffer->streamEntry;
+            if (entry != NULL) LockMusicStreamEntry(entry);
+            jar_xm_get_position(music.ctxData, NULL, NULL, NULL, &framesPlayed);
+            if (entry != NULL) ma_mutex_unlock(&AUDIO.Streaming.lock);
+#else
             jar_xm_get_position(music.ctxData, NULL, NULL, NULL, &framesPlayed);
+#endif
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
         else
 #endif
         {
             ma_mutex_lock(&AUDIO.System.lock);
-            //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
+            // Frames played are the frames streamed minus the frames still queued in the ring buffer
+            // NOTE: Frames queued on a stopped music are discarded by mixer
             int framesProcessed = (int)music.stream.buffer->framesProcessed;
-            int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
-            int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
+            int framesQueued = music.stream.buffer->playing? (int)GetAudioBufferQueuedFrames(music.stream.buffer) : 0;
+            int framesPlayed = (framesProcessed - framesQueued)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
             ma_mutex_unlock(&AUDIO.System.lock);
@@ -2085,33 +2368,7 @@ float GetMusicTimePlayed(Music music)
 // Load audio stream (to stream audio pcm data)
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
-    AudioStream stream = { 0 };
-
-    stream.sampleRate = sampleRate;
-    stream.sampleSize = sampleSize;
-    stream.channels = channels;
-
-    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
-
-    // The size of a streaming buffer must be at least double the size of a period
-    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
-
-    // If the buffer is not set, compute one that would give us a buffer good enough for a decent frame rate
-    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? AUDIO.System.device.sampleRate/30 : AUDIO.Buffer.defaultSize;
-
-    if (subBufferSize < periodSize) subBufferSize = periodSize;
-
-    // Create a double audio buffer of defined size
-    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
-
-    if (stream.buffer != NULL)
-    {
-        stream.buffer->looping = true;    // Always loop for streaming buffers
-        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
-    }
-    else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, stream could not be created");
-
-    return stream;
+    return LoadAudioStreamWithLatency(sampleRate, sampleSize, channels, 0);
 }
 
 // Checks if an audio stream is ready
@@ -2146,11 +2403,8 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
-    return result;
+    // Stream ring buffer requires refill if a sub-buffer size fits in free space
+    return (GetAudioBufferQueuedFrames(stream.buffer) <= stream.buffer->sizeInFrames/2);
 }
 
 // Play audio stream
@@ -2213,14 +2467,13 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
     if (stream.buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
-// The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
-// a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
+// The new processor must be added at the end, processor is linked to the list by the mixer
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
@@ -2228,18 +2481,7 @@ void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH, .buffer = stream.buffer, .processor = processor });
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2248,26 +2490,7 @@ void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH, .buffer = stream.buffer, .callback = process });
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -2281,18 +2504,7 @@ void AttachAudioMixedProcessor(AudioCallback process)
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH, .buffer = NULL, .processor = processor });
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2301,26 +2513,7 @@ void AttachAudioMixedProcessor(AudioCallback process)
 void DetachAudioMixedProcessor(AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH, .buffer = NULL, .callback = process });
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -2342,77 +2535,51 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
 
         return frameCount;
     }
 
-    ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
-    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
-
-    if (currentSubBufferIndex > 1) return 0;
-
-    // Another thread can update the processed state of buffers, so
-    // we just take a copy here to try and avoid potential synchronization problems
-    bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
-
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
-
-    // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
     ma_uint32 framesRead = 0;
-    while (1)
+
+    if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
     {
-        // We break from this loop differently depending on the buffer's usage
-        //  - For static buffers, we simply fill as much data as we can
-        //  - For streaming buffers we only fill half of the buffer that are processed
-        //    Unprocessed halves must keep their audio data in-tact
-        if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
-        {
-            if (framesRead >= frameCount) break;
-        }
-        else
+        // For static buffers, we simply fill as much data as we can
+        while ((framesRead < frameCount) && (audioBuffer->sizeInFrames > 0))
         {
-            if (isSubBufferProcessed[currentSubBufferIndex]) break;
-        }
+            ma_uint32 framesToRead = frameCount - framesRead;
+            ma_uint32 framesRemainingInOutputBuffer = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+            if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
-        ma_uint32 totalFramesRemaining = (frameCount - framesRead);
-        if (totalFramesRemaining == 0) break;
+            memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
+            audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+            framesRead += framesToRead;
 
-        ma_uint32 framesRemainingInOutputBuffer;
-        if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
-        {
-            framesRemainingInOutputBuffer = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
-        }
-        else
-        {
-            ma_uint32 firstFrameIndexOfThisSubBuffer = subBufferSizeInFrames*currentSubBufferIndex;
-            framesRemainingInOutputBuffer = subBufferSizeInFrames - (audioBuffer->frameCursorPos - firstFrameIndexOfThisSubBuffer);
+            // We need to break from this loop if we've read to the end of the buffer and we're not looping
+            if ((framesToRead == framesRemainingInOutputBuffer) && !audioBuffer->looping)
+            {
+                EndAudioBufferPlaying(audioBuffer);
+                break;
+            }
         }
+    }
+    else
+    {
+        // For streaming buffers, we read the frames queued in the ring buffer by program thread,
+        // ring buffer is single-producer/single-consumer, read cursor is only updated here
+        ma_uint32 readCursor = ma_atomic_load_32(&audioBuffer->readCursor);
+        ma_uint32 readPosition = readCursor%audioBuffer->sizeInFrames;
 
-        ma_uint32 framesToRead = totalFramesRemaining;
-        if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
-
-        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
-        framesRead += framesToRead;
+        framesRead = GetAudioBufferQueuedFrames(audioBuffer);
+        if (framesRead > frameCount) framesRead = frameCount;
 
-        // If we've read to the end of the buffer, mark it as processed
-        if (framesToRead == framesRemainingInOutputBuffer)
-        {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
-            isSubBufferProcessed[currentSubBufferIndex] = true;
+        ma_uint32 framesToEnd = audioBuffer->sizeInFrames - readPosition;
+        if (framesToEnd > framesRead) framesToEnd = framesRead;
 
-            currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
+        memcpy(framesOut, audioBuffer->data + (readPosition*frameSizeInBytes), framesToEnd*frameSizeInBytes);
+        memcpy((unsigned char *)framesOut + (framesToEnd*frameSizeInBytes), audioBuffer->data, (framesRead - framesToEnd)*frameSizeInBytes);
 
-            // We need to break from this loop if we're not looping
-            if (!audioBuffer->looping)
-            {
-                StopAudioBufferInLockedState(audioBuffer);
-                break;
-            }
-        }
+        ma_atomic_store_32(&audioBuffer->readCursor, (readCursor + framesRead)%(2*audioBuffer->sizeInFrames));
     }
 
     // Zero-fill excess
@@ -2437,7 +2604,18 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+
+    // Audio buffer data already in mixing format (i.e. sounds), frames are read without conversion
+    // NOTE: Converter is never a passthrough because dynamic sample rate is enabled (pitch)
+    if ((audioBuffer->converter.formatIn == ma_format_f32) &&
+        (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut) &&
+        (audioBuffer->converter.sampleRateIn == audioBuffer->converter.sampleRateOut) &&
+        (audioBuffer->mixPitch == 1.0f))
+    {
+        return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+    }
+
+    ma_uint8 inputBuffer[4096];     // NOTE: Not initialized, only frames read are converted
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2486,14 +2664,24 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Apply program threads requests before mixing, no lock is required: audio thread never waits for program threads
+    // NOTE: Audio buffers list and mixer state are only accessed by audio thread, commands are the only way to change them
+    ProcessAudioCommands();
+
+    // Rank playing sounds, only the highest ranked ones are mixed, mixing cost is bounded by maximum real voices
+    UpdateAudioVoices();
+
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        for (AudioBuffer *audioBuffer = AUDIO.Voice.first; audioBuffer != NULL; audioBuffer = audioBuffer->nextVoice)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            // Ignore paused sounds, virtual voices are not mixed, just moved forward
+            if (audioBuffer->mixPaused) continue;
+
+            if (!audioBuffer->mixVoiceReal)
+            {
+                AdvanceVirtualVoice(audioBuffer, frameCount);
+                continue;
+            }
 
             ma_uint32 framesRead = 0;
 
@@ -2506,7 +2694,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 
                 while (framesToRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float tempBuffer[1024];     // Frames for stereo, not initialized, only frames read are mixed
 
                     ma_uint32 framesToReadRightNow = framesToRead;
                     if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
@@ -2534,7 +2722,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                         framesRead += framesJustRead;
                     }
 
-                    if (!audioBuffer->playing)
+                    if (!audioBuffer->mixPlaying)
                     {
                         framesRead = frameCount;
                         break;
@@ -2545,7 +2733,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     {
                         if (!audioBuffer->looping)
                         {
-                            StopAudioBufferInLockedState(audioBuffer);
+                            EndAudioBufferPlaying(audioBuffer);
                             break;
                         }
                         else
@@ -2571,248 +2759,1134 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor->process(pFramesOut, frameCount);
         processor = processor->next;
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
-    const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    float gain[2] = { buffer->mixVolume, buffer->mixVolume };
 
     if (channels == 2)  // We consider panning
     {
-        const float left = buffer->pan;
+        const float left = buffer->mixPan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        gain[0] = buffer->mixVolume*0.5f*left*(3.0f - left*left);
+        gain[1] = buffer->mixVolume*0.5f*right*(3.0f - right*right);
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    // Stolen voice is faded out before turning virtual
+    if (buffer->mixVoiceFading) gain[0] = gain[1] = 0.0f;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+    // Gain is not ramped when audio buffer starts playing
+    if (!buffer->mixGainReady)
+    {
+        buffer->mixGain[0] = buffer->mixGainTarget[0] = gain[0];
+        buffer->mixGain[1] = buffer->mixGainTarget[1] = gain[1];
+        buffer->mixRampFrames = 0;
+        buffer->mixGainReady = true;
+    }
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+    // Volume or pan changed, gain is ramped linearly from current gain to avoid clicks
+    if ((gain[0] != buffer->mixGainTarget[0]) || (gain[1] != buffer->mixGainTarget[1]))
+    {
+        buffer->mixGainTarget[0] = gain[0];
+        buffer->mixGainTarget[1] = gain[1];
+        buffer->mixGainStep[0] = (gain[0] - buffer->mixGain[0])/AUDIO_MIXER_GAIN_RAMP_FRAMES;
+        buffer->mixGainStep[1] = (gain[1] - buffer->mixGain[1])/AUDIO_MIXER_GAIN_RAMP_FRAMES;
+        buffer->mixRampFrames = AUDIO_MIXER_GAIN_RAMP_FRAMES;
     }
-    else  // We do not consider panning
+
+    ma_uint32 rampFrames = (buffer->mixRampFrames < frameCount)? buffer->mixRampFrames : frameCount;
+
+    if (rampFrames > 0)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        MixAudioFramesWithGain(framesOut, framesIn, rampFrames, channels, buffer->mixGain, buffer->mixGainStep);
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
+        buffer->mixRampFrames -= rampFrames;
+        buffer->mixGain[0] += buffer->mixGainStep[0]*rampFrames;
+        buffer->mixGain[1] += buffer->mixGainStep[1]*rampFrames;
+
+        if (buffer->mixRampFrames == 0)
+        {
+            buffer->mixGain[0] = buffer->mixGainTarget[0];
+            buffer->mixGain[1] = buffer->mixGainTarget[1];
         }
     }
+
+    if (rampFrames < frameCount)
+    {
+        const float gainStep[2] = { 0.0f, 0.0f };
+        MixAudioFramesWithGain(framesOut + rampFrames*channels, framesIn + rampFrames*channels, frameCount - rampFrames, channels, buffer->mixGain, gainStep);
+    }
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Mix (accumulate) frames multiplied by channels gain, gain incremented by gainStep per frame
+// NOTE: Only stereo uses a different gain per channel (panning), other channel counts use gain[0]
+static void MixAudioFramesWithGain(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, const float *gain, const float *gainStep)
 {
-    bool result = false;
+    if ((channels == 1) || (channels == 2) || (channels == 4) || ((gainStep[0] == 0.0f) && (gainStep[1] == 0.0f)))
+    {
+        // Samples are processed in groups of 4, gain of every sample lane in the group is computed from its channel and frame
+        // NOTE: With a constant gain, any number of channels is processed as mono samples
+        ma_uint32 laneChannels = ((channels == 1) || (channels == 2) || (channels == 4))? channels : 1;
+        float laneGain[4] = { 0 };
+        float laneStep[4] = { 0 };
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+        for (int lane = 0; lane < 4; lane++)
+        {
+            int c = (laneChannels == 2)? lane%2 : 0;
 
-    return result;
-}
+            laneGain[lane] = gain[c] + gainStep[c]*(float)(lane/laneChannels);
+            laneStep[lane] = gainStep[c]*(float)(4/laneChannels);
+        }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
-{
-    if (buffer != NULL)
+        MixAudioSamples(framesOut, framesIn, frameCount*channels, laneGain, laneStep);
+    }
+    else
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        // Channel counts not fitting in groups of 4 samples while ramping gain
+        float *frameOut = framesOut;
+        const float *frameIn = framesIn;
+        float frameGain = gain[0];
+
+        for (ma_uint32 frame = 0; frame < frameCount; frame++)
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            for (ma_uint32 c = 0; c < channels; c++) frameOut[c] += (frameIn[c]*frameGain);
+
+            frameOut += channels;
+            frameIn += channels;
+            frameGain += gainStep[0];
         }
     }
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+// Mix (accumulate) samples multiplied by gain, samples processed in groups of 4 (lanes)
+// NOTE: Every lane has its own gain, incremented by lane gain step after every group
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *laneGain, const float *laneStep)
 {
-    if (stream.buffer != NULL)
-    {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
-        {
-            ma_uint32 subBufferToUpdate = 0;
-
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
-            {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
-            }
-            else
-            {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
-            }
+    float gain[4] = { laneGain[0], laneGain[1], laneGain[2], laneGain[3] };
+    ma_uint32 i = 0;
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+#if defined(RAUDIO_SSE2)
+    __m128 vgain = _mm_loadu_ps(gain);
+    const __m128 vstep = _mm_loadu_ps(laneStep);
 
-            // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
-
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
-            {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), vgain));
+        vgain = _mm_add_ps(vgain, vstep);
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(samplesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), vgain));
+        vgain = _mm_add_ps(vgain, vstep);
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
+    }
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+    _mm_storeu_ps(gain, vgain);
+#elif defined(RAUDIO_NEON)
+    float32x4_t vgain = vld1q_f32(gain);
+    const float32x4_t vstep = vld1q_f32(laneStep);
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        float32x4_t out0 = vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), vgain);
+        vgain = vaddq_f32(vgain, vstep);
+        float32x4_t out1 = vmlaq_f32(vld1q_f32(samplesOut + i + 4), vld1q_f32(samplesIn + i + 4), vgain);
+        vgain = vaddq_f32(vgain, vstep);
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
-            }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
-        }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+        vst1q_f32(samplesOut + i, out0);
+        vst1q_f32(samplesOut + i + 4, out1);
     }
-}
 
-// Some required functions for audio standalone module version
-#if defined(RAUDIO_STANDALONE)
-// Check file extension
-static bool IsFileExtension(const char *fileName, const char *ext)
-{
-    bool result = false;
-    const char *fileExt;
+    vst1q_f32(gain, vgain);
+#endif
 
-    if ((fileExt = strrchr(fileName, '.')) != NULL)
+    for (; (i + 4) <= sampleCount; i += 4)
     {
-        if (strcmp(fileExt, ext) == 0) result = true;
+        samplesOut[i] += samplesIn[i]*gain[0];
+        samplesOut[i + 1] += samplesIn[i + 1]*gain[1];
+        samplesOut[i + 2] += samplesIn[i + 2]*gain[2];
+        samplesOut[i + 3] += samplesIn[i + 3]*gain[3];
+
+        gain[0] += laneStep[0];
+        gain[1] += laneStep[1];
+        gain[2] += laneStep[2];
+        gain[3] += laneStep[3];
     }
 
-    return result;
+    for (; i < sampleCount; i++) samplesOut[i] += samplesIn[i]*gain[i%4];
 }
 
-// Get pointer to extension for a filename string (includes the dot: .png)
-static const char *GetFileExtension(const char *fileName)
+// Push command to mixer commands queue, assuming the audio system mutex has been locked
+// NOTE: Program threads wait if queue is full, audio thread never waits
+static void PushAudioCommand(AudioCommand command)
 {
-    const char *dot = strrchr(fileName, '.');
-
-    if (!dot || dot == fileName) return NULL;
+    FreeReleasedAudioResources();
 
-    return dot;
-}
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Command.head);
 
-// String pointer reverse break: returns right-most occurrence of charset in s
-static const char *strprbrk(const char *s, const char *charset)
-{
-    const char *latestMatch = NULL;
-    for (; s = strpbrk(s, charset), s != NULL; latestMatch = s++) { }
-    return latestMatch;
-}
+    while ((head - ma_atomic_load_32(&AUDIO.Command.tail)) == AUDIO_COMMAND_QUEUE_SIZE)
+    {
+        if (AUDIO.System.isReady) ma_sleep(1);
+        else ProcessAudioCommands();
 
-// Get pointer to filename for a path string
-static const char *GetFileName(const char *filePath)
-{
-    const char *fileName = NULL;
-    if (filePath != NULL) fileName = strprbrk(filePath, "\\/");
+        FreeReleasedAudioResources();
+    }
 
-    if (!fileName) return filePath;
+    AUDIO.Command.queue[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+    ma_atomic_store_32(&AUDIO.Command.head, head + 1);
 
-    return fileName + 1;
+    // Audio device is not running, commands are processed on program thread
+    if (!AUDIO.System.isReady)
+    {
+        ProcessAudioCommands();
+        FreeReleasedAudioResources();
+    }
 }
 
-// Get filename string without extension (uses static string)
-static const char *GetFileNameWithoutExt(const char *filePath)
+// Push resource released by mixer to be freed by program threads, audio thread
+// NOTE: Returns false if queue is full, command releasing the resource must be retried later,
+// resource must not be accessed by mixer once pushed
+static bool PushReleasedAudioResource(AudioCommand resource)
 {
-    #define MAX_FILENAMEWITHOUTEXT_LENGTH   256
-
-    static char fileName[MAX_FILENAMEWITHOUTEXT_LENGTH] = { 0 };
-    memset(fileName, 0, MAX_FILENAMEWITHOUTEXT_LENGTH);
-
-    if (filePath != NULL) strcpy(fileName, GetFileName(filePath));   // Get filename with extension
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Command.releasedHead);
 
-    int size = (int)strlen(fileName);   // Get size in bytes
+    if ((head - ma_atomic_load_32(&AUDIO.Command.releasedTail)) == AUDIO_COMMAND_QUEUE_SIZE) return false;
 
-    for (int i = 0; (i < size) && (i < MAX_FILENAMEWITHOUTEXT_LENGTH); i++)
-    {
-        if (fileName[i] == '.')
-        {
-            // NOTE: We break on first '.' found
-            fileName[i] = '\0';
-            break;
-        }
-    }
+    AUDIO.Command.released[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = resource;
+    ma_atomic_store_32(&AUDIO.Command.releasedHead, head + 1);
 
-    return fileName;
+    return true;
 }
 
-// Load data from file into a buffer
-static unsigned char *LoadFileData(const char *fileName, int *dataSize)
+// Process pending mixer commands, audio thread
+static void ProcessAudioCommands(void)
 {
-    unsigned char *data = NULL;
-    *dataSize = 0;
+    ma_uint32 tail = ma_atomic_load_32(&AUDIO.Command.tail);
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Command.head);
 
-    if (fileName != NULL)
+    while (tail != head)
     {
-        FILE *file = fopen(fileName, "rb");
+        AudioCommand *command = &AUDIO.Command.queue[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+        AudioBuffer *buffer = command->buffer;
+        bool pending = false;
 
-        if (file != NULL)
+        switch (command->type)
         {
-            // WARNING: On binary streams SEEK_END could not be found,
-            // using fseek() and ftell() could not work in some (rare) cases
-            fseek(file, 0, SEEK_END);
-            int size = ftell(file);
-            fseek(file, 0, SEEK_SET);
+            case AUDIO_COMMAND_TRACK:
+            {
+                // Track audio buffer to linked list next position
+                if ((buffer->prev != NULL) || (AUDIO.Buffer.first == buffer)) break;
 
-            if (size > 0)
+                if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+                else
+                {
+                    AUDIO.Buffer.last->next = buffer;
+                    buffer->prev = AUDIO.Buffer.last;
+                }
+
+                AUDIO.Buffer.last = buffer;
+
+                if (buffer->mixPlaying) AddAudioVoice(buffer);
+            } break;
+            case AUDIO_COMMAND_UNTRACK:
+            case AUDIO_COMMAND_UNLOAD:
             {
-                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+                // Untrack audio buffer from linked list
+                bool tracked = ((buffer->prev != NULL) || (AUDIO.Buffer.first == buffer));
+                AudioBuffer *prev = buffer->prev;
+                AudioBuffer *next = buffer->next;
 
-                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
-                unsigned int count = (unsigned int)fread(data, sizeof(unsigned char), size, file);
-                *dataSize = count;
+                // NOTE: Buffer could be freed as soon as it is released, it is not accessed after that
+                RemoveAudioVoice(buffer);
 
-                if (count != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
-                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
-            }
-            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+                // Audio buffer is freed by program threads once released by mixer
+                if ((command->type == AUDIO_COMMAND_UNLOAD) && !PushReleasedAudioResource(*command))
+                {
+                    pending = true;
+                    break;
+                }
 
-            fclose(file);
-        }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
-    }
-    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+                if (!tracked) break;
 
-    return data;
-}
+                if (prev == NULL) AUDIO.Buffer.first = next;
+                else prev->next = next;
 
-// Save data to file from buffer
-static bool SaveFileData(const char *fileName, void *data, int dataSize)
-{
-    if (fileName != NULL)
-    {
-        FILE *file = fopen(fileName, "wb");
+                if (next == NULL) AUDIO.Buffer.last = prev;
+                else next->prev = prev;
 
-        if (file != NULL)
+                if (command->type == AUDIO_COMMAND_UNTRACK)
+                {
+                    buffer->prev = NULL;
+                    buffer->next = NULL;
+                }
+            } break;
+            case AUDIO_COMMAND_PLAY:
+            {
+                buffer->mixPlaying = true;
+                buffer->mixPaused = false;
+                buffer->mixPlayCount = command->param;
+                buffer->mixGainReady = false;
+                buffer->mixVirtualRemainder = 0;
+                buffer->frameCursorPos = 0;
+
+                if ((buffer->prev != NULL) || (AUDIO.Buffer.first == buffer)) AddAudioVoice(buffer);
+            } break;
+            case AUDIO_COMMAND_STOP:
+            {
+                buffer->mixPlaying = false;
+                buffer->mixPaused = false;
+                buffer->frameCursorPos = 0;
+
+                // Discard stream frames queued before stop request, frames queued after it are kept
+                if ((buffer->usage == AUDIO_BUFFER_USAGE_STREAM) && (buffer->sizeInFrames > 0))
+                {
+                    ma_uint32 ringSize = 2*buffer->sizeInFrames;
+                    ma_uint32 framesToDiscard = (command->param + ringSize - ma_atomic_load_32(&buffer->readCursor))%ringSize;
+
+                    if (framesToDiscard <= GetAudioBufferQueuedFrames(buffer)) ma_atomic_store_32(&buffer->readCursor, command->param);
+                }
+            } break;
+            case AUDIO_COMMAND_PAUSE: buffer->mixPaused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->mixPaused = false; break;
+            case AUDIO_COMMAND_VOLUME: buffer->mixVolume = command->value; break;
+            case AUDIO_COMMAND_PAN: buffer->mixPan = command->value; break;
+            case AUDIO_COMMAND_PRIORITY: buffer->mixPriority = (int)command->param; break;
+            case AUDIO_COMMAND_PITCH:
+            {
+                // Pitching is just an adjustment of the sample rate
+                // Note that this changes the duration of the sound:
+                //  - higher pitches will make the sound faster
+                //  - lower pitches make it slower
+                ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+                ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+                buffer->mixPitch = command->value;
+            } break;
+            case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+            case AUDIO_COMMAND_ATTACH:
+            {
+                // Processors are added at the end of the list, as there aren't supposed to be a lot of processors
+                // attached, we iterate through the list to find the end
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *last = *first;
+
+                while (last && last->next)
+                {
+                    last = last->next;
+                }
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *first = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH:
+            {
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *processor = *first;
+
+                while (processor)
+                {
+                    rAudioProcessor *next = processor->next;
+                    rAudioProcessor *prev = processor->prev;
+
+                    if (processor->process == command->callback)
+                    {
+                        // Processor is freed by program threads once released by mixer
+                        if (!PushReleasedAudioResource((AudioCommand){ .type = AUDIO_COMMAND_DETACH, .processor = processor }))
+                        {
+                            pending = true;
+                            break;
+                        }
+
+                        if (*first == processor) *first = next;
+                        if (prev) prev->next = next;
+                        if (next) next->prev = prev;
+                    }
+
+                    processor = next;
+                }
+            } break;
+            case AUDIO_COMMAND_UPDATE:
+            {
+                // NOTE: Copy is repeated if the command is retried, data is only freed once released
+                memcpy(buffer->data, command->data, command->param);
+
+                if (!PushReleasedAudioResource((AudioCommand){ .type = AUDIO_COMMAND_UPDATE, .data = command->data })) pending = true;
+            } break;
+            default: break;
+        }
+
+        // Released resources queue is full, command is retried on next call
+        if (pending) break;
+
+        tail++;
+    }
+
+    ma_atomic_store_32(&AUDIO.Command.tail, tail);
+}
+
+// Free resources released by mixer, assuming the audio system mutex has been locked
+static void FreeReleasedAudioResources(void)
+{
+    ma_uint32 tail = ma_atomic_load_32(&AUDIO.Command.releasedTail);
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Command.releasedHead);
+
+    while (tail != head)
+    {
+        AudioCommand *resource = &AUDIO.Command.released[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+
+        if (resource->type == AUDIO_COMMAND_UNLOAD)
+        {
+            AudioBuffer *buffer = resource->buffer;
+
+            while (buffer->processor)
+            {
+                rAudioProcessor *next = buffer->processor->next;
+                RL_FREE(buffer->processor);
+                buffer->processor = next;
+            }
+
+            ma_data_converter_uninit(&buffer->converter, NULL);
+            if (resource->param != 0) RL_FREE(buffer->data);
+            RL_FREE(buffer);
+        }
+        else if (resource->type == AUDIO_COMMAND_DETACH) RL_FREE(resource->processor);
+        else if (resource->type == AUDIO_COMMAND_UPDATE) RL_FREE(resource->data);
+
+        tail++;
+    }
+
+    ma_atomic_store_32(&AUDIO.Command.releasedTail, tail);
+}
+
+// End audio buffer playing, audio thread
+// NOTE: Program threads check the ended play request to know the audio buffer is not playing anymore
+static void EndAudioBufferPlaying(AudioBuffer *buffer)
+{
+    buffer->mixPlaying = false;
+    buffer->mixPaused = false;
+    buffer->frameCursorPos = 0;
+
+    ma_atomic_store_32(&buffer->endedCount, buffer->mixPlayCount);
+}
+
+// Add audio buffer to voices list, audio thread
+// NOTE: Voices list keeps the playing audio buffers, stopped ones are removed by UpdateAudioVoices()
+static void AddAudioVoice(AudioBuffer *buffer)
+{
+    if (buffer->mixVoice) return;
+
+    if (AUDIO.Voice.first == NULL) AUDIO.Voice.first = buffer;
+    else
+    {
+        AUDIO.Voice.last->nextVoice = buffer;
+        buffer->prevVoice = AUDIO.Voice.last;
+    }
+
+    AUDIO.Voice.last = buffer;
+
+    buffer->mixVoice = true;
+    buffer->mixVoiceReal = false;
+    buffer->mixVoiceFading = false;
+}
+
+// Remove audio buffer from voices list, audio thread
+static void RemoveAudioVoice(AudioBuffer *buffer)
+{
+    if (!buffer->mixVoice) return;
+
+    if (buffer->prevVoice == NULL) AUDIO.Voice.first = buffer->nextVoice;
+    else buffer->prevVoice->nextVoice = buffer->nextVoice;
+
+    if (buffer->nextVoice == NULL) AUDIO.Voice.last = buffer->prevVoice;
+    else buffer->nextVoice->prevVoice = buffer->prevVoice;
+
+    buffer->prevVoice = NULL;
+    buffer->nextVoice = NULL;
+    buffer->mixVoice = false;
+    buffer->mixVoiceReal = false;
+    buffer->mixVoiceFading = false;
+}
+
+// Update voices list, choosing the voices mixed on this callback (real voices), audio thread
+// NOTE: Audio streams are always mixed, audible sounds are ranked by priority and volume and only the highest
+// ranked ones are mixed, up to maximum real voices, other sounds are virtual voices: not mixed, only moved forward,
+// stolen voices are still mixed while fading out, at most one gain ramp
+static void UpdateAudioVoices(void)
+{
+    ma_uint32 maxReal = ma_atomic_load_32(&AUDIO.Voice.maxReal);
+    ma_uint32 rankedCount = 0;
+
+    // Remove stopped voices and rank audible sounds, ranked list is sorted from highest to lowest rank
+    // NOTE: On equal rank, voices playing for longer are kept first, avoids voices switching on every callback
+    AudioBuffer *buffer = AUDIO.Voice.first;
+
+    while (buffer != NULL)
+    {
+        AudioBuffer *next = buffer->nextVoice;
+        bool sound = ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (buffer->callback == NULL));
+
+        buffer->mixVoiceRanked = false;
+
+        if (!buffer->mixPlaying) RemoveAudioVoice(buffer);
+        else if (sound && !buffer->mixPaused && (buffer->mixVolume >= AUDIO_VOICE_MIN_VOLUME))
+        {
+            ma_uint32 position = rankedCount;
+
+            while (position > 0)
+            {
+                AudioBuffer *ranked = AUDIO.Voice.ranked[position - 1];
+
+                if ((buffer->mixPriority < ranked->mixPriority) ||
+                    ((buffer->mixPriority == ranked->mixPriority) && (buffer->mixVolume <= ranked->mixVolume))) break;
+
+                position--;
+            }
+
+            if (position < maxReal)
+            {
+                if (rankedCount == maxReal) rankedCount--;     // Lowest ranked sound is discarded
+
+                memmove(&AUDIO.Voice.ranked[position + 1], &AUDIO.Voice.ranked[position], (rankedCount - position)*sizeof(AudioBuffer *));
+                AUDIO.Voice.ranked[position] = buffer;
+                rankedCount++;
+            }
+        }
+
+        buffer = next;
+    }
+
+    for (ma_uint32 i = 0; i < rankedCount; i++) AUDIO.Voice.ranked[i]->mixVoiceRanked = true;
+
+    ma_uint32 realCount = 0;
+    ma_uint32 virtualCount = 0;
+    ma_uint32 stolenCount = 0;
+
+    for (buffer = AUDIO.Voice.first; buffer != NULL; buffer = buffer->nextVoice)
+    {
+        bool sound = ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (buffer->callback == NULL));
+        bool real = (!buffer->mixPaused && (!sound || buffer->mixVoiceRanked));
+
+        if (real)
+        {
+            // Voice becomes real after being virtual or paused, gain is ramped from silence to avoid clicks
+            // NOTE: Voices starting to play are not ramped, they start at the beginning of audio data
+            if (!buffer->mixVoiceReal && (buffer->mixGainReady || (buffer->frameCursorPos > 0)))
+            {
+                buffer->mixGain[0] = buffer->mixGainTarget[0] = 0.0f;
+                buffer->mixGain[1] = buffer->mixGainTarget[1] = 0.0f;
+                buffer->mixRampFrames = 0;
+                buffer->mixGainReady = true;
+            }
+
+            // Voice ranked again while fading out, gain is ramped back from current gain
+            buffer->mixVoiceFading = false;
+
+            realCount++;
+        }
+        else if (!buffer->mixPaused)
+        {
+            // Audible real voice turned virtual, it has been stolen by higher ranked sounds
+            // NOTE: Stolen voice is kept real for one gain ramp, fading to silence, avoids clicks
+            if (buffer->mixVoiceReal && !buffer->mixVoiceFading && (buffer->mixVolume >= AUDIO_VOICE_MIN_VOLUME))
+            {
+                buffer->mixVoiceFading = true;
+                stolenCount++;
+            }
+            else if (buffer->mixVoiceFading && (buffer->mixGain[0] == 0.0f) && (buffer->mixGain[1] == 0.0f)) buffer->mixVoiceFading = false;
+
+            real = buffer->mixVoiceFading;
+
+            if (real) realCount++;
+            else virtualCount++;
+        }
+        else buffer->mixVoiceFading = false;
+
+        buffer->mixVoiceReal = real;
+    }
+
+    ma_atomic_store_32(&AUDIO.Voice.realCount, realCount);
+    ma_atomic_store_32(&AUDIO.Voice.virtualCount, virtualCount);
+    if (stolenCount > 0) ma_atomic_store_32(&AUDIO.Voice.stolenCount, ma_atomic_load_32(&AUDIO.Voice.stolenCount) + stolenCount);
+}
+
+// Move a virtual voice forward as if it was mixed, audio thread
+// NOTE: Frames consumed depend on audio buffer sample rate and pitch, resampling remainder is kept for next callback
+static void AdvanceVirtualVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    if (buffer->sizeInFrames == 0) return;
+
+    ma_uint64 sampleRateIn = buffer->converter.resampler.sampleRateIn;
+    ma_uint64 sampleRateOut = buffer->converter.resampler.sampleRateOut;
+
+    ma_uint64 frames = frameCount*sampleRateIn + buffer->mixVirtualRemainder;
+    buffer->mixVirtualRemainder = frames%sampleRateOut;
+    frames = buffer->frameCursorPos + frames/sampleRateOut;
+
+    if (frames < buffer->sizeInFrames) buffer->frameCursorPos = (unsigned int)frames;
+    else if (buffer->looping) buffer->frameCursorPos = (unsigned int)(frames%buffer->sizeInFrames);
+    else EndAudioBufferPlaying(buffer);
+}
+
+// Get frames queued in stream ring buffer, any thread
+// NOTE: Cursors are kept in [0..2*sizeInFrames) range to distinguish a full ring buffer from an empty one
+static unsigned int GetAudioBufferQueuedFrames(AudioBuffer *buffer)
+{
+    if (buffer->sizeInFrames == 0) return 0;
+
+    ma_uint32 ringSize = 2*buffer->sizeInFrames;
+
+    return (ma_atomic_load_32(&buffer->writeCursor) + ringSize - ma_atomic_load_32(&buffer->readCursor))%ringSize;
+}
+
+// Update audio stream ring buffer, assuming the audio system mutex has been locked
+// NOTE: Ring buffer write cursor is only updated here
+static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+{
+    if (stream.buffer != NULL)
+    {
+        AudioBuffer *buffer = stream.buffer;
+        ma_uint32 framesFree = buffer->sizeInFrames - GetAudioBufferQueuedFrames(buffer);
+
+        if (framesFree > 0)
+        {
+            if (framesFree >= (ma_uint32)frameCount)
+            {
+                ma_uint32 frameSize = stream.channels*(stream.sampleSize/8);
+                ma_uint32 writeCursor = ma_atomic_load_32(&buffer->writeCursor);
+                ma_uint32 writePosition = writeCursor%buffer->sizeInFrames;
+
+                ma_uint32 framesToEnd = buffer->sizeInFrames - writePosition;
+                if (framesToEnd > (ma_uint32)frameCount) framesToEnd = (ma_uint32)frameCount;
+
+                memcpy(buffer->data + writePosition*frameSize, data, framesToEnd*frameSize);
+                memcpy(buffer->data, (const unsigned char *)data + framesToEnd*frameSize, (frameCount - framesToEnd)*frameSize);
+
+                // Frames are available to mixer once write cursor is updated
+                ma_atomic_store_32(&buffer->writeCursor, (writeCursor + frameCount)%(2*buffer->sizeInFrames));
+
+                buffer->framesProcessed += frameCount;
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
+}
+
+// Load audio stream, ring buffer size fits the frames to keep queued
+static AudioStream LoadAudioStreamWithLatency(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int latencyInFrames)
+{
+    AudioStream stream = { 0 };
+
+    stream.sampleRate = sampleRate;
+    stream.sampleSize = sampleSize;
+    stream.channels = channels;
+
+    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    // The size of a streaming buffer must be at least double the size of a period
+    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+
+    // If the buffer is not set, compute one that would give us a buffer good enough for a decent frame rate
+    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? AUDIO.System.device.sampleRate/30 : AUDIO.Buffer.defaultSize;
+
+    if (subBufferSize < periodSize) subBufferSize = periodSize;
+
+    // Create a double audio buffer of defined size, bigger if latency frames must be kept queued while a sub-buffer is written
+    unsigned int sizeInFrames = subBufferSize*2;
+    if (sizeInFrames < (latencyInFrames + subBufferSize)) sizeInFrames = latencyInFrames + subBufferSize;
+
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, sizeInFrames, AUDIO_BUFFER_USAGE_STREAM);
+
+    if (stream.buffer != NULL)
+    {
+        stream.buffer->looping = true;    // Always loop for streaming buffers
+        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, stream could not be created");
+
+    return stream;
+}
+
+// Load audio stream for a music stream, ring buffer size fits streaming thread latency, if running
+static AudioStream LoadMusicAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+{
+    unsigned int latencyInFrames = 0;
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+    if (ma_atomic_load_32(&AUDIO.Streaming.isRunning)) latencyInFrames = MUSIC_STREAMING_LATENCY_MS*sampleRate/1000;
+#endif
+
+    return LoadAudioStreamWithLatency(sampleRate, sampleSize, channels, latencyInFrames);
+}
+
+// Read (decode) music frames from music context, looping to beginning if required
+static void ReadMusicStreamFrames(Music music, void *framesOut, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+// Rewind music context to beginning
+static void RewindMusicStream(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_MUSIC_STREAMING_THREAD)
+// Music streaming thread, keeps registered music streams ring buffers filled ahead
+// NOTE: Music streams are filled one sub-buffer at a time, each entry is decoded marked as decoding without
+// holding the streams list lock, ring buffers are written holding the audio system lock, audio thread never waits on any of them
+static ma_thread_result MA_THREADCALL MusicStreamingThread(void *userData)
+{
+    (void)userData;
+
+    // Music streams are checked several times per latency period
+    double updateTime = ((MUSIC_STREAMING_LATENCY_MS >= 4)? MUSIC_STREAMING_LATENCY_MS/4 : 1)/1000.0;
+
+    while (ma_atomic_load_32(&AUDIO.Streaming.isRunning))
+    {
+        bool streaming = true;
+        bool active = false;
+
+        while (streaming)
+        {
+            streaming = false;
+            active = false;
+
+            ma_mutex_lock(&AUDIO.Streaming.lock);
+            for (MusicStreamEntry *entry = AUDIO.Streaming.first; entry != NULL; entry = entry->next)
+            {
+                // NOTE: Entry is not unregistered while decoding, it stays on the list
+                if (entry->active && (entry->lockRequests == 0))
+                {
+                    entry->decoding = true;
+                    ma_mutex_unlock(&AUDIO.Streaming.lock);
+
+                    if (StreamMusicFrames(entry)) streaming = true;
+
+                    ma_mutex_lock(&AUDIO.Streaming.lock);
+                    entry->decoding = false;
+                    if (entry->lockRequests > 0) ma_event_signal(&entry->decodedEvent);
+                }
+
+                if (entry->active) active = true;
+            }
+            ma_mutex_unlock(&AUDIO.Streaming.lock);
+        }
+
+        if (!active)
+        {
+            // No music streamed, wait until a music play request
+            ma_event_wait(&AUDIO.Streaming.wakeUpEvent);
+        }
+        else
+        {
+            // Wait for next update, a music play request wakes up the thread
+            // NOTE: Wait is measured in elapsed time, sleep granularity could be coarser than requested
+            ma_timer timer;
+            ma_timer_init(&timer);
+
+            while (!ma_atomic_exchange_32(&AUDIO.Streaming.wakeUp, 0) && ma_atomic_load_32(&AUDIO.Streaming.isRunning))
+            {
+                double timeLeft = updateTime - ma_timer_get_time_in_seconds(&timer);
+
+                if (timeLeft <= 0.0) break;
+
+                ma_sleep(1);
+            }
+        }
+    }
+
+    return (ma_thread_result)0;
+}
+
+// Stream music frames to stream ring buffer, one sub-buffer at a time, assuming the entry is marked as decoding
+// NOTE: Returns true if frames have been streamed and more frames could be required
+static bool StreamMusicFrames(MusicStreamEntry *entry)
+{
+    Music music = entry->music;
+    AudioBuffer *buffer = music.stream.buffer;
+    unsigned int framesQueued = GetAudioBufferQueuedFrames(buffer);
+
+    if (entry->ended)
+    {
+        // Music fully streamed, it is stopped once all queued frames have been played
+        if (framesQueued == 0)
+        {
+            StopAudioStream(music.stream);
+            RewindMusicStream(music);
+
+            entry->active = false;
+            entry->ended = false;
+        }
+
+        return false;
+    }
+
+    if (framesQueued >= entry->latencyInFrames) return false;  // No refilling required
+
+    // Sub-buffer size always fits in ring buffer when queued frames are below latency
+    unsigned int subBufferSizeInFrames = buffer->sizeInFrames - entry->latencyInFrames;
+    unsigned int pcmSize = subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8;
+
+    if (AUDIO.Streaming.pcmBufferSize < pcmSize)
+    {
+        RL_FREE(AUDIO.Streaming.pcmBuffer);
+        AUDIO.Streaming.pcmBuffer = RL_CALLOC(1, pcmSize);
+        AUDIO.Streaming.pcmBufferSize = pcmSize;
+    }
+
+    bool looping = (ma_atomic_load_32(&entry->looping) != 0);
+    unsigned int framesLeft = music.frameCount - buffer->framesProcessed;    // Frames left to be processed
+    unsigned int framesToStream = ((framesLeft >= subBufferSizeInFrames) || looping)? subBufferSizeInFrames : framesLeft;
+
+    // Music data is decoded without holding the audio system lock
+    ReadMusicStreamFrames(music, AUDIO.Streaming.pcmBuffer, framesToStream);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    UpdateAudioStreamInLockedState(music.stream, AUDIO.Streaming.pcmBuffer, framesToStream);
+    buffer->framesProcessed = buffer->framesProcessed%music.frameCount;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    // Streaming is ending, we filled latest frames from input
+    if (!looping && (framesLeft <= subBufferSizeInFrames)) entry->ended = true;
+
+    return !entry->ended;
+}
+
+// Lock streams list once music stream entry is not being decoded by streaming thread
+// NOTE: Waiting only happens while this entry is being decoded, a single sub-buffer
+static void LockMusicStreamEntry(MusicStreamEntry *entry)
+{
+    ma_mutex_lock(&AUDIO.Streaming.lock);
+
+    if (entry->decoding)
+    {
+        entry->lockRequests++;
+
+        while (entry->decoding)
+        {
+            ma_mutex_unlock(&AUDIO.Streaming.lock);
+            ma_event_wait(&entry->decodedEvent);
+            ma_mutex_lock(&AUDIO.Streaming.lock);
+        }
+
+        entry->lockRequests--;
+
+        // Decoding is not restarted while requests are pending, next waiting thread is woken up
+        if (entry->lockRequests > 0) ma_event_signal(&entry->decodedEvent);
+    }
+}
+
+// Register music stream to be decoded by streaming thread, if running
+static void RegisterMusicStream(Music music)
+{
+    if ((music.stream.buffer == NULL) || !ma_atomic_load_32(&AUDIO.Streaming.isRunning)) return;
+
+    MusicStreamEntry *entry = (MusicStreamEntry *)RL_CALLOC(1, sizeof(MusicStreamEntry));
+
+    if (ma_event_init(&entry->decodedEvent) != MA_SUCCESS)
+    {
+        // Music stream is decoded by UpdateMusicStream()
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create event for music streaming");
+        RL_FREE(entry);
+        return;
+    }
+
+    entry->music = music;
+    entry->looping = (ma_uint32)music.looping;
+    entry->latencyInFrames = MUSIC_STREAMING_LATENCY_MS*music.stream.sampleRate/1000;
+    if (entry->latencyInFrames >= music.stream.buffer->sizeInFrames) entry->latencyInFrames = music.stream.buffer->sizeInFrames/2;
+
+    ma_mutex_lock(&AUDIO.Streaming.lock);
+    entry->next = AUDIO.Streaming.first;
+    AUDIO.Streaming.first = entry;
+    ma_mutex_unlock(&AUDIO.Streaming.lock);
+
+    music.stream.buffer->streamEntry = entry;
+}
+
+// Unregister music stream from streaming thread
+static void UnregisterMusicStream(Music music)
+{
+    if ((music.stream.buffer == NULL) || (music.stream.buffer->streamEntry == NULL)) return;
+
+    MusicStreamEntry *entry = music.stream.buffer->streamEntry;
+
+    LockMusicStreamEntry(entry);
+    if (AUDIO.Streaming.first == entry) AUDIO.Streaming.first = entry->next;
+    else
+    {
+        MusicStreamEntry *prev = AUDIO.Streaming.first;
+        while (prev->next != entry) prev = prev->next;
+        prev->next = entry->next;
+    }
+    ma_mutex_unlock(&AUDIO.Streaming.lock);
+
+    music.stream.buffer->streamEntry = NULL;
+    ma_event_uninit(&entry->decodedEvent);
+    RL_FREE(entry);
+}
+#endif
+
+// Some required functions for audio standalone module version
+#if defined(RAUDIO_STANDALONE)
+// Check file extension
+static bool IsFileExtension(const char *fileName, const char *ext)
+{
+    bool result = false;
+    const char *fileExt;
+
+    if ((fileExt = strrchr(fileName, '.')) != NULL)
+    {
+        if (strcmp(fileExt, ext) == 0) result = true;
+    }
+
+    return result;
+}
+
+// Get pointer to extension for a filename string (includes the dot: .png)
+static const char *GetFileExtension(const char *fileName)
+{
+    const char *dot = strrchr(fileName, '.');
+
+    if (!dot || dot == fileName) return NULL;
+
+    return dot;
+}
+
+// String pointer reverse break: returns right-most occurrence of charset in s
+static const char *strprbrk(const char *s, const char *charset)
+{
+    const char *latestMatch = NULL;
+    for (; s = strpbrk(s, charset), s != NULL; latestMatch = s++) { }
+    return latestMatch;
+}
+
+// Get pointer to filename for a path string
+static const char *GetFileName(const char *filePath)
+{
+    const char *fileName = NULL;
+    if (filePath != NULL) fileName = strprbrk(filePath, "\\/");
+
+    if (!fileName) return filePath;
+
+    return fileName + 1;
+}
+
+// Get filename string without extension (uses static string)
+static const char *GetFileNameWithoutExt(const char *filePath)
+{
+    #define MAX_FILENAMEWITHOUTEXT_LENGTH   256
+
+    static char fileName[MAX_FILENAMEWITHOUTEXT_LENGTH] = { 0 };
+    memset(fileName, 0, MAX_FILENAMEWITHOUTEXT_LENGTH);
+
+    if (filePath != NULL) strcpy(fileName, GetFileName(filePath));   // Get filename with extension
+
+    int size = (int)strlen(fileName);   // Get size in bytes
+
+    for (int i = 0; (i < size) && (i < MAX_FILENAMEWITHOUTEXT_LENGTH); i++)
+    {
+        if (fileName[i] == '.')
+        {
+            // NOTE: We break on first '.' found
+            fileName[i] = '\0';
+            break;
+        }
+    }
+
+    return fileName;
+}
+
+// Load data from file into a buffer
+static unsigned char *LoadFileData(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    if (fileName != NULL)
+    {
+        FILE *file = fopen(fileName, "rb");
+
+        if (file != NULL)
+        {
+            // WARNING: On binary streams SEEK_END could not be found,
+            // using fseek() and ftell() could not work in some (rare) cases
+            fseek(file, 0, SEEK_END);
+            int size = ftell(file);
+            fseek(file, 0, SEEK_SET);
+
+            if (size > 0)
+            {
+                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+
+                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
+                unsigned int count = (unsigned int)fread(data, sizeof(unsigned char), size, file);
+                *dataSize = count;
+
+                if (count != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
+                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+            fclose(file);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+
+    return data;
+}
+
+// Save data to file from buffer
+static bool SaveFileData(const char *fileName, void *data, int dataSize)
+{
+    if (fileName != NULL)
+    {
+        FILE *file = fopen(fileName, "wb");
+
+        if (file != NULL)
         {
             unsigned int count = (unsigned int)fwrite(data, sizeof(unsigned char), dataSize, file);
 
@@ -2867,6 +3941,23 @@ static bool SaveFileText(const char *fileName, char *text)
 
     return true;
 }
+
+// Load file data (read-only)
+// NOTE: On standalone mode file data is loaded, file mapping is provided by raylib utils module
+static MappedFile LoadMappedFile(const char *fileName)
+{
+    MappedFile file = { 0 };
+
+    file.data = LoadFileData(fileName, &file.dataSize);
+
+    return file;
+}
+
+// Unload file data loaded by LoadMappedFile()
+static void UnloadMappedFile(MappedFile file)
+{
+    RL_FREE((void *)file.data);
+}
 #endif
 
 #undef AudioBuffer
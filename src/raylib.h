@@ -297,6 +297,15 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// SpriteInstance, compact sprite data for instanced drawing (24 bytes)
+typedef struct SpriteInstance {
+    Vector2 position;       // Sprite center position
+    float rotation;         // Sprite rotation in degrees
+    float scale;            // Sprite scale
+    unsigned short frame;   // Sprite frame index (source rectangle)
+    Color tint;             // Sprite tint color
+} SpriteInstance;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -306,6 +315,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rGlyphCache rGlyphCache;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -314,8 +327,23 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int *glyphLookup;       // Glyphs lookup table by codepoint (hashed), generated on font loading
+    rGlyphCache *glyphCache; // Dynamic glyphs cache (internal), only for LoadFontDynamic() fonts
 } Font;
 
+// TextLayout, text glyphs placement for a font, size and spacing, ready to be drawn
+typedef struct TextLayout {
+    Font font;              // Font used for layout
+    char *text;             // Text laid out (copy)
+    float fontSize;         // Font size used for layout
+    float spacing;          // Spacing between glyphs used for layout
+    Vector2 size;           // Text size, same as MeasureTextEx()
+    int glyphCount;         // Number of glyphs to draw
+    int *codepoints;        // Glyphs codepoints
+    int *indices;           // Glyphs indices in font
+    Vector2 *positions;     // Glyphs quads positions, relative to layout position
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -355,6 +383,10 @@ typedef struct Mesh {
     unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
 
+    // Vertex data compression (GPU)
+    unsigned int compression;   // Vertex data compression applied on upload (MeshCompressionFlags)
+    Vector4 quantization;   // Vertex positions dequantization: offset (XYZ) and scale (W)
+
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
@@ -415,6 +447,7 @@ typedef struct ModelAnimation {
     int frameCount;         // Number of animation frames
     BoneInfo *bones;        // Bones information (skeleton)
     Transform **framePoses; // Poses array by frame
+    float *frameTimes;      // Frames time in seconds (optional, frames could be unevenly spaced keyframes)
     char name[32];          // Animation name
 } ModelAnimation;
 
@@ -438,6 +471,21 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// MeshBVHNode, bounding volume hierarchy node
+typedef struct MeshBVHNode {
+    BoundingBox bounds;     // Node bounds (mesh space)
+    int first;              // First triangle (leaf) or left child node index (inner node, right child is first + 1)
+    int count;              // Number of triangles (leaf), 0 for inner nodes
+} MeshBVHNode;
+
+// MeshBVH, mesh bounding volume hierarchy for fast ray-casting
+typedef struct MeshBVH {
+    int nodeCount;          // Number of nodes in the hierarchy
+    int triangleCount;      // Number of triangles referenced by leaf nodes
+    MeshBVHNode *nodes;     // Nodes array (root is nodes[0])
+    int *triangles;         // Mesh triangle indices, sorted by leaf
+} MeshBVH;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -817,6 +865,16 @@ typedef enum {
     SHADER_ATTRIB_VEC4              // Shader attribute type: vec4 (4 float)
 } ShaderAttributeDataType;
 
+// Mesh vertex data compression flags
+// NOTE: Only vertex data uploaded to GPU is compressed, mesh CPU data is kept at full precision
+typedef enum {
+    MESH_COMPRESS_POSITIONS = 1,    // Vertex positions as snorm16, quantized to mesh bounds (8 bytes per vertex)
+    MESH_COMPRESS_TEXCOORDS = 2,    // Vertex texcoords as unorm16, only if in [0..1] range (4 bytes per vertex)
+    MESH_COMPRESS_NORMALS = 4,      // Vertex normals as snorm8 (4 bytes per vertex)
+    MESH_COMPRESS_TANGENTS = 8,     // Vertex tangents as snorm8 (4 bytes per vertex)
+    MESH_COMPRESS_ALL = 15          // All supported vertex attributes compressed
+} MeshCompressionFlags;
+
 // Pixel formats
 // NOTE: Support depends on OpenGL version and platform
 typedef enum {
@@ -1091,6 +1149,8 @@ RLAPI void SetTraceLogLevel(int logLevel);                        // Set the cur
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void SetParallelJobWorkers(int count);                      // Set number of workers for internal parallel jobs (fonts rasterization, mesh skinning...)
+RLAPI int GetParallelJobWorkers(void);                            // Get number of workers for internal parallel jobs
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advance users
@@ -1408,6 +1468,7 @@ RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, fl
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
+RLAPI void DrawTextureInstanced(Texture2D texture, const Rectangle *frames, int frameCount, const SpriteInstance *instances, int instanceCount); // Draw sprites instances from texture frames (source rectangles), using instancing if supported and no custom shader active
 
 // Color/pixel related functions
 RLAPI bool ColorIsEqual(Color col1, Color col2);                            // Check if two colors are equal
@@ -1437,6 +1498,8 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);  // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int memoryBudget);            // Load font for dynamic glyphs rasterization on first use, atlas and glyphs limited to memoryBudget bytes
+RLAPI void UpdateFontDynamic(Font *font);                                                   // Update dynamic font atlas texture and glyph count, atlas could be recreated on glyphs loading
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1452,6 +1515,12 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyphs placement ready to be drawn
+RLAPI bool UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing); // Update text layout, only recomputed if any input changed
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout, all glyphs in a single batch
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1540,14 +1609,18 @@ RLAPI void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source,
 
 // Mesh management functions
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
-RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
+RLAPI void UploadMeshCompressed(Mesh *mesh, unsigned int flags);                            // Upload mesh vertex data in GPU using compact formats (static, MeshCompressionFlags)
+RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index (not compressed buffers)
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void OptimizeMesh(Mesh *mesh);                                                        // Optimize mesh vertex data: weld vertices, index and reorder for vertex cache and fetch
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
+RLAPI MeshBVH BuildMeshBVH(Mesh mesh);                                                      // Build mesh bounding volume hierarchy for ray-casting (mesh space, CPU vertex data required)
+RLAPI void UnloadMeshBVH(MeshBVH bvh);                                                      // Unload mesh bounding volume hierarchy data
 
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
@@ -1573,6 +1646,7 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void UpdateModelAnimationEx(Model model, ModelAnimation *anims, const float *weights, int count, float time); // Update model animation pose, interpolated at time (seconds) and blended between animations
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
@@ -1584,6 +1658,7 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI RayCollision GetRayCollisionMeshBVH(Ray ray, Mesh mesh, MeshBVH bvh, Matrix transform);       // Get collision info between ray and mesh, accelerated by mesh BVH
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
@@ -1598,6 +1673,10 @@ RLAPI void CloseAudioDevice(void);                                    // Close t
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void SetAudioMaxVoices(int count);                              // Set maximum number of sounds mixed (real voices), limited by MAX_AUDIO_VOICES
+RLAPI int GetAudioRealVoices(void);                                   // Get number of voices mixed (real voices)
+RLAPI int GetAudioVirtualVoices(void);                                // Get number of playing sounds not mixed (virtual voices)
+RLAPI int GetAudioStolenVoices(void);                                 // Get number of real voices turned virtual by higher ranked sounds
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1623,6 +1702,7 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound (0 is default, higher priority sounds are mixed first)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
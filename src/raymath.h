@@ -11,7 +11,8 @@
 *       Example: In memory order, row0 is [m0 m4 m8 m12] but in semantic math row0 is [m0 m1 m2 m3]
 *     - Functions are always self-contained, no function use another raymath function inside,
 *       required code is directly re-implemented inside
-*     - Functions input parameters are always received by value (2 unavoidable exceptions)
+*     - Functions input parameters are always received by value (2 unavoidable exceptions,
+*       and batch functions, processing arrays of elements)
 *     - Functions use always a "result" variable for return
 *     - Functions are always defined inline
 *     - Angles are always in radians (DEG2RAD/RAD2DEG macros provided for convenience)
@@ -27,6 +28,11 @@
 *           Define static inline functions code, so #include header suffices for use.
 *           This may use up lots of memory.
 *
+*       #define RAYMATH_NO_SIMD
+*           Disable SIMD intrinsics on batch functions (arrays processing), scalar code is used.
+*           By default SSE2 is used on x86-64 and NEON on ARM64, AVX is used if enabled
+*           on compilation (i.e. -mavx2)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -168,6 +174,22 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
 
+// SIMD intrinsics used by batch functions (arrays processing)
+// NOTE: Scalar code is used on other architectures or if RAYMATH_NO_SIMD is defined
+#if !defined(RAYMATH_NO_SIMD) && !defined(__TINYC__)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RAYMATH_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+        #if defined(__AVX__)
+            #define RAYMATH_AVX
+            #include <immintrin.h>  // Required for: AVX intrinsics [Used in MatrixMultiplyArray(), Vector3MinMaxArray()]
+        #endif
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define RAYMATH_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -2525,4 +2547,424 @@ RMAPI int QuaternionEquals(Quaternion p, Quaternion q)
     return result;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch math (arrays processing)
+//----------------------------------------------------------------------------------
+// NOTE: Batch functions give the same results as the equivalent functions called per element
+// (up to floating point contraction, if enabled by compiler), in-place processing is supported
+
+// SIMD helpers: load/store 4 consecutive Vector3 (12 floats) as components vectors (x, y, z)
+// NOTE: Defined as macros, inline functions with external linkage can not call static functions
+#if defined(RAYMATH_SSE2)
+#define RAYMATH_LOAD_VECTOR3_SSE2(ptr, x, y, z) { \
+        __m128 va = _mm_loadu_ps((const float *)(ptr));         /* x0 y0 z0 x1 */ \
+        __m128 vb = _mm_loadu_ps((const float *)(ptr) + 4);     /* y1 z1 x2 y2 */ \
+        __m128 vc = _mm_loadu_ps((const float *)(ptr) + 8);     /* z2 x3 y3 z3 */ \
+        x = _mm_shuffle_ps(va, _mm_shuffle_ps(vb, vc, _MM_SHUFFLE(1, 0, 3, 2)), _MM_SHUFFLE(3, 0, 3, 0)); \
+        y = _mm_shuffle_ps(_mm_shuffle_ps(va, vb, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(vb, vc, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)); \
+        z = _mm_shuffle_ps(_mm_shuffle_ps(va, vb, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(vc, vc, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)); }
+
+#define RAYMATH_STORE_VECTOR3_SSE2(ptr, x, y, z) { \
+        __m128 vxy = _mm_unpacklo_ps(x, y);                     /* x0 y0 x1 y1 */ \
+        __m128 vxyh = _mm_unpackhi_ps(x, y);                    /* x2 y2 x3 y3 */ \
+        _mm_storeu_ps((float *)(ptr), _mm_shuffle_ps(vxy, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0))); \
+        _mm_storeu_ps((float *)(ptr) + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), vxyh, _MM_SHUFFLE(1, 0, 2, 0))); \
+        _mm_storeu_ps((float *)(ptr) + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0))); }
+#endif
+
+// Transform an array of points by a matrix (points considered with w = 1.0f)
+RMAPI void Vector3TransformArray(Vector3 *result, const Vector3 *points, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SSE2)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        RAYMATH_LOAD_VECTOR3_SSE2(points + i, x, y, z);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        RAYMATH_STORE_VECTOR3_SSE2(result + i, rx, ry, rz);
+    }
+#elif defined(RAYMATH_NEON)
+    float32x4_t m0 = vdupq_n_f32(mat.m0), m4 = vdupq_n_f32(mat.m4), m8 = vdupq_n_f32(mat.m8), m12 = vdupq_n_f32(mat.m12);
+    float32x4_t m1 = vdupq_n_f32(mat.m1), m5 = vdupq_n_f32(mat.m5), m9 = vdupq_n_f32(mat.m9), m13 = vdupq_n_f32(mat.m13);
+    float32x4_t m2 = vdupq_n_f32(mat.m2), m6 = vdupq_n_f32(mat.m6), m10 = vdupq_n_f32(mat.m10), m14 = vdupq_n_f32(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32((const float *)(points + i));   // Load deinterleaved: x, y, z
+        float32x4x3_t r;
+
+        r.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m0, v.val[0]), vmulq_f32(m4, v.val[1])), vmulq_f32(m8, v.val[2])), m12);
+        r.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m1, v.val[0]), vmulq_f32(m5, v.val[1])), vmulq_f32(m9, v.val[2])), m13);
+        r.val[2] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m2, v.val[0]), vmulq_f32(m6, v.val[1])), vmulq_f32(m10, v.val[2])), m14);
+
+        vst3q_f32((float *)(result + i), r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        float z = points[i].z;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+// Transform an array of normals by a matrix, results are normalized
+// NOTE: Matrix translation is not applied, normal matrix (inverse transpose)
+// should be provided for transforms with non-uniform scaling
+RMAPI void Vector3TransformNormalArray(Vector3 *result, const Vector3 *normals, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SSE2)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        RAYMATH_LOAD_VECTOR3_SSE2(normals + i, x, y, z);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z));
+
+        // Normalize, zero length vectors are kept
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_mul_ps(rz, rz)));
+        __m128 valid = _mm_cmpneq_ps(length, zero);
+        __m128 ilength = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(one, length)), _mm_andnot_ps(valid, one));
+
+        RAYMATH_STORE_VECTOR3_SSE2(result + i, _mm_mul_ps(rx, ilength), _mm_mul_ps(ry, ilength), _mm_mul_ps(rz, ilength));
+    }
+#elif defined(RAYMATH_NEON)
+    float32x4_t m0 = vdupq_n_f32(mat.m0), m4 = vdupq_n_f32(mat.m4), m8 = vdupq_n_f32(mat.m8);
+    float32x4_t m1 = vdupq_n_f32(mat.m1), m5 = vdupq_n_f32(mat.m5), m9 = vdupq_n_f32(mat.m9);
+    float32x4_t m2 = vdupq_n_f32(mat.m2), m6 = vdupq_n_f32(mat.m6), m10 = vdupq_n_f32(mat.m10);
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32((const float *)(normals + i));  // Load deinterleaved: x, y, z
+        float32x4x3_t r;
+
+        r.val[0] = vaddq_f32(vaddq_f32(vmulq_f32(m0, v.val[0]), vmulq_f32(m4, v.val[1])), vmulq_f32(m8, v.val[2]));
+        r.val[1] = vaddq_f32(vaddq_f32(vmulq_f32(m1, v.val[0]), vmulq_f32(m5, v.val[1])), vmulq_f32(m9, v.val[2]));
+        r.val[2] = vaddq_f32(vaddq_f32(vmulq_f32(m2, v.val[0]), vmulq_f32(m6, v.val[1])), vmulq_f32(m10, v.val[2]));
+
+        // Normalize, zero length vectors are kept
+        float32x4_t length = vsqrtq_f32(vaddq_f32(vaddq_f32(vmulq_f32(r.val[0], r.val[0]), vmulq_f32(r.val[1], r.val[1])), vmulq_f32(r.val[2], r.val[2])));
+        float32x4_t ilength = vbslq_f32(vceqq_f32(length, zero), one, vdivq_f32(one, length));
+
+        r.val[0] = vmulq_f32(r.val[0], ilength);
+        r.val[1] = vmulq_f32(r.val[1], ilength);
+        r.val[2] = vmulq_f32(r.val[2], ilength);
+
+        vst3q_f32((float *)(result + i), r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = normals[i].x;
+        float y = normals[i].y;
+        float z = normals[i].z;
+
+        float rx = mat.m0*x + mat.m4*y + mat.m8*z;
+        float ry = mat.m1*x + mat.m5*y + mat.m9*z;
+        float rz = mat.m2*x + mat.m6*y + mat.m10*z;
+
+        float length = sqrtf(rx*rx + ry*ry + rz*rz);
+        float ilength = 1.0f;
+        if (length != 0.0f) ilength = 1.0f/length;
+
+        result[i].x = rx*ilength;
+        result[i].y = ry*ilength;
+        result[i].z = rz*ilength;
+    }
+}
+
+// Normalize an array of vectors, zero length vectors are kept
+RMAPI void Vector3NormalizeArray(Vector3 *result, const Vector3 *v, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SSE2)
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        RAYMATH_LOAD_VECTOR3_SSE2(v + i, x, y, z);
+
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 valid = _mm_cmpneq_ps(length, zero);
+        __m128 ilength = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(one, length)), _mm_andnot_ps(valid, one));
+
+        RAYMATH_STORE_VECTOR3_SSE2(result + i, _mm_mul_ps(x, ilength), _mm_mul_ps(y, ilength), _mm_mul_ps(z, ilength));
+    }
+#elif defined(RAYMATH_NEON)
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t r = vld3q_f32((const float *)(v + i));       // Load deinterleaved: x, y, z
+
+        float32x4_t length = vsqrtq_f32(vaddq_f32(vaddq_f32(vmulq_f32(r.val[0], r.val[0]), vmulq_f32(r.val[1], r.val[1])), vmulq_f32(r.val[2], r.val[2])));
+        float32x4_t ilength = vbslq_f32(vceqq_f32(length, zero), one, vdivq_f32(one, length));
+
+        r.val[0] = vmulq_f32(r.val[0], ilength);
+        r.val[1] = vmulq_f32(r.val[1], ilength);
+        r.val[2] = vmulq_f32(r.val[2], ilength);
+
+        vst3q_f32((float *)(result + i), r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Vector3 n = v[i];
+
+        float length = sqrtf(n.x*n.x + n.y*n.y + n.z*n.z);
+        if (length != 0.0f)
+        {
+            float ilength = 1.0f/length;
+
+            n.x *= ilength;
+            n.y *= ilength;
+            n.z *= ilength;
+        }
+
+        result[i] = n;
+    }
+}
+
+// Get minimum and maximum components of an array of points (axis-aligned bounding box)
+// NOTE: Zero vectors are returned if array is empty
+RMAPI void Vector3MinMaxArray(const Vector3 *points, int count, Vector3 *min, Vector3 *max)
+{
+    Vector3 vmin = { 0 };
+    Vector3 vmax = { 0 };
+
+    if (count > 0)
+    {
+        int i = 1;
+
+        vmin = points[0];
+        vmax = points[0];
+
+#if defined(RAYMATH_SSE2)
+        // NOTE: Points are processed as a stream of floats, 4 points are loaded on 3 vectors,
+        // every vector lane always holds the same component, reduced at the end
+#if defined(RAYMATH_AVX)
+        #define RAYMATH_MINMAX_LANES 24
+#else
+        #define RAYMATH_MINMAX_LANES 12
+#endif
+        float lanes[RAYMATH_MINMAX_LANES];
+        for (int k = 0; k < RAYMATH_MINMAX_LANES; k++) lanes[k] = (&vmin.x)[k%3];
+
+        if (count >= RAYMATH_MINMAX_LANES/3)
+        {
+#if defined(RAYMATH_AVX)
+            __m256 mina = _mm256_loadu_ps(lanes), minb = _mm256_loadu_ps(lanes + 8), minc = _mm256_loadu_ps(lanes + 16);
+            __m256 maxa = mina, maxb = minb, maxc = minc;
+
+            for (i = 0; i + 8 <= count; i += 8)
+            {
+                const float *p = (const float *)(points + i);
+                __m256 a = _mm256_loadu_ps(p), b = _mm256_loadu_ps(p + 8), c = _mm256_loadu_ps(p + 16);
+
+                // NOTE: New value first, NaN values are ignored as fminf()/fmaxf() do
+                mina = _mm256_min_ps(a, mina); minb = _mm256_min_ps(b, minb); minc = _mm256_min_ps(c, minc);
+                maxa = _mm256_max_ps(a, maxa); maxb = _mm256_max_ps(b, maxb); maxc = _mm256_max_ps(c, maxc);
+            }
+
+            float lanesMax[RAYMATH_MINMAX_LANES];
+            _mm256_storeu_ps(lanes, mina); _mm256_storeu_ps(lanes + 8, minb); _mm256_storeu_ps(lanes + 16, minc);
+            _mm256_storeu_ps(lanesMax, maxa); _mm256_storeu_ps(lanesMax + 8, maxb); _mm256_storeu_ps(lanesMax + 16, maxc);
+#else
+            __m128 mina = _mm_loadu_ps(lanes), minb = _mm_loadu_ps(lanes + 4), minc = _mm_loadu_ps(lanes + 8);
+            __m128 maxa = mina, maxb = minb, maxc = minc;
+
+            for (i = 0; i + 4 <= count; i += 4)
+            {
+                const float *p = (const float *)(points + i);
+                __m128 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4), c = _mm_loadu_ps(p + 8);
+
+                // NOTE: New value first, NaN values are ignored as fminf()/fmaxf() do
+                mina = _mm_min_ps(a, mina); minb = _mm_min_ps(b, minb); minc = _mm_min_ps(c, minc);
+                maxa = _mm_max_ps(a, maxa); maxb = _mm_max_ps(b, maxb); maxc = _mm_max_ps(c, maxc);
+            }
+
+            float lanesMax[RAYMATH_MINMAX_LANES];
+            _mm_storeu_ps(lanes, mina); _mm_storeu_ps(lanes + 4, minb); _mm_storeu_ps(lanes + 8, minc);
+            _mm_storeu_ps(lanesMax, maxa); _mm_storeu_ps(lanesMax + 4, maxb); _mm_storeu_ps(lanesMax + 8, maxc);
+#endif
+            // Reduce lanes by component
+            for (int k = 0; k < RAYMATH_MINMAX_LANES; k++)
+            {
+                (&vmin.x)[k%3] = fminf((&vmin.x)[k%3], lanes[k]);
+                (&vmax.x)[k%3] = fmaxf((&vmax.x)[k%3], lanesMax[k]);
+            }
+        }
+        #undef RAYMATH_MINMAX_LANES
+#elif defined(RAYMATH_NEON)
+        if (count >= 4)
+        {
+            float32x4_t minx = vdupq_n_f32(vmin.x), miny = vdupq_n_f32(vmin.y), minz = vdupq_n_f32(vmin.z);
+            float32x4_t maxx = minx, maxy = miny, maxz = minz;
+
+            for (i = 0; i + 4 <= count; i += 4)
+            {
+                float32x4x3_t v = vld3q_f32((const float *)(points + i));   // Load deinterleaved: x, y, z
+
+                minx = vminnmq_f32(minx, v.val[0]); miny = vminnmq_f32(miny, v.val[1]); minz = vminnmq_f32(minz, v.val[2]);
+                maxx = vmaxnmq_f32(maxx, v.val[0]); maxy = vmaxnmq_f32(maxy, v.val[1]); maxz = vmaxnmq_f32(maxz, v.val[2]);
+            }
+
+            vmin.x = vminnmvq_f32(minx); vmin.y = vminnmvq_f32(miny); vmin.z = vminnmvq_f32(minz);
+            vmax.x = vmaxnmvq_f32(maxx); vmax.y = vmaxnmvq_f32(maxy); vmax.z = vmaxnmvq_f32(maxz);
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            vmin.x = fminf(vmin.x, points[i].x);
+            vmin.y = fminf(vmin.y, points[i].y);
+            vmin.z = fminf(vmin.z, points[i].z);
+
+            vmax.x = fmaxf(vmax.x, points[i].x);
+            vmax.y = fmaxf(vmax.y, points[i].y);
+            vmax.z = fmaxf(vmax.z, points[i].z);
+        }
+    }
+
+    *min = vmin;
+    *max = vmax;
+}
+
+// Multiply an array of matrices by a matrix, result[i] = MatrixMultiply(left[i], right)
+RMAPI void MatrixMultiplyArray(Matrix *result, const Matrix *left, int count, Matrix right)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SSE2) || defined(RAYMATH_NEON)
+    // NOTE: In memory layout terms, every result row is a linear combination of left rows:
+    // row[c] = sum(r[4*c + k]*leftRow[k]), k = 0..3
+    const float *r = &right.m0;
+#endif
+
+#if defined(RAYMATH_AVX)
+    // Two result rows computed at once, left rows broadcasted to both register halves
+    __m256 b[8];
+    for (int c = 0; c < 2; c++)
+    {
+        for (int k = 0; k < 4; k++) b[4*c + k] = _mm256_setr_ps(r[8*c + k], r[8*c + k], r[8*c + k], r[8*c + k],
+            r[8*c + 4 + k], r[8*c + 4 + k], r[8*c + 4 + k], r[8*c + 4 + k]);
+    }
+
+    for (; i < count; i++)
+    {
+        const float *l = &left[i].m0;
+        float *m = &result[i].m0;
+
+        __m256 l0 = _mm256_broadcast_ps((const __m128 *)l);
+        __m256 l1 = _mm256_broadcast_ps((const __m128 *)(l + 4));
+        __m256 l2 = _mm256_broadcast_ps((const __m128 *)(l + 8));
+        __m256 l3 = _mm256_broadcast_ps((const __m128 *)(l + 12));
+
+        __m256 r01 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(l0, b[0]), _mm256_mul_ps(l1, b[1])), _mm256_mul_ps(l2, b[2])), _mm256_mul_ps(l3, b[3]));
+        __m256 r23 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(l0, b[4]), _mm256_mul_ps(l1, b[5])), _mm256_mul_ps(l2, b[6])), _mm256_mul_ps(l3, b[7]));
+
+        _mm256_storeu_ps(m, r01);
+        _mm256_storeu_ps(m + 8, r23);
+    }
+#elif defined(RAYMATH_SSE2)
+    __m128 b[16];
+    for (int k = 0; k < 16; k++) b[k] = _mm_set1_ps(r[k]);
+
+    for (; i < count; i++)
+    {
+        const float *l = &left[i].m0;
+        float *m = &result[i].m0;
+
+        __m128 l0 = _mm_loadu_ps(l);
+        __m128 l1 = _mm_loadu_ps(l + 4);
+        __m128 l2 = _mm_loadu_ps(l + 8);
+        __m128 l3 = _mm_loadu_ps(l + 12);
+
+        for (int c = 0; c < 4; c++)
+        {
+            _mm_storeu_ps(m + 4*c, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, b[4*c]), _mm_mul_ps(l1, b[4*c + 1])), _mm_mul_ps(l2, b[4*c + 2])), _mm_mul_ps(l3, b[4*c + 3])));
+        }
+    }
+#elif defined(RAYMATH_NEON)
+    for (; i < count; i++)
+    {
+        const float *l = &left[i].m0;
+        float *m = &result[i].m0;
+
+        float32x4_t l0 = vld1q_f32(l);
+        float32x4_t l1 = vld1q_f32(l + 4);
+        float32x4_t l2 = vld1q_f32(l + 8);
+        float32x4_t l3 = vld1q_f32(l + 12);
+
+        for (int c = 0; c < 4; c++)
+        {
+            vst1q_f32(m + 4*c, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(l0, r[4*c]), vmulq_n_f32(l1, r[4*c + 1])), vmulq_n_f32(l2, r[4*c + 2])), vmulq_n_f32(l3, r[4*c + 3])));
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Matrix a = left[i];
+        Matrix m = { 0 };
+
+        m.m0 = a.m0*right.m0 + a.m1*right.m4 + a.m2*right.m8 + a.m3*right.m12;
+        m.m1 = a.m0*right.m1 + a.m1*right.m5 + a.m2*right.m9 + a.m3*right.m13;
+        m.m2 = a.m0*right.m2 + a.m1*right.m6 + a.m2*right.m10 + a.m3*right.m14;
+        m.m3 = a.m0*right.m3 + a.m1*right.m7 + a.m2*right.m11 + a.m3*right.m15;
+        m.m4 = a.m4*right.m0 + a.m5*right.m4 + a.m6*right.m8 + a.m7*right.m12;
+        m.m5 = a.m4*right.m1 + a.m5*right.m5 + a.m6*right.m9 + a.m7*right.m13;
+        m.m6 = a.m4*right.m2 + a.m5*right.m6 + a.m6*right.m10 + a.m7*right.m14;
+        m.m7 = a.m4*right.m3 + a.m5*right.m7 + a.m6*right.m11 + a.m7*right.m15;
+        m.m8 = a.m8*right.m0 + a.m9*right.m4 + a.m10*right.m8 + a.m11*right.m12;
+        m.m9 = a.m8*right.m1 + a.m9*right.m5 + a.m10*right.m9 + a.m11*right.m13;
+        m.m10 = a.m8*right.m2 + a.m9*right.m6 + a.m10*right.m10 + a.m11*right.m14;
+        m.m11 = a.m8*right.m3 + a.m9*right.m7 + a.m10*right.m11 + a.m11*right.m15;
+        m.m12 = a.m12*right.m0 + a.m13*right.m4 + a.m14*right.m8 + a.m15*right.m12;
+        m.m13 = a.m12*right.m1 + a.m13*right.m5 + a.m14*right.m9 + a.m15*right.m13;
+        m.m14 = a.m12*right.m2 + a.m13*right.m6 + a.m14*right.m10 + a.m15*right.m14;
+        m.m15 = a.m12*right.m3 + a.m13*right.m7 + a.m14*right.m11 + a.m15*right.m15;
+
+        result[i] = m;
+    }
+}
+
+#if defined(RAYMATH_SSE2)
+    #undef RAYMATH_LOAD_VECTOR3_SSE2
+    #undef RAYMATH_STORE_VECTOR3_SSE2
+#endif
+
 #endif  // RAYMATH_H
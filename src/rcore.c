@@ -19,6 +19,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_MEMORY:
+*           - Linux, BSD, macOS: no window, CPU software renderer (rlsw) into an in-memory framebuffer
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -110,6 +112,14 @@
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
+#if defined(SUPPORT_PROFILING_ZONES)
+    #define RLGL_PROFILE_ZONE_BEGIN(name) BeginProfileZone(name)
+    #define RLGL_PROFILE_ZONE_END() EndProfileZone()
+#endif
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // Software renderer rasterizes framebuffer tiles on jobs worker threads
+    #define RLSW_PARALLEL_JOBS(job, data, count) RunParallelJobs(job, data, count)
+#endif
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
 
@@ -506,6 +516,8 @@ const char *TextFormat(const char *text, ...);              // Formatting of tex
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_MEMORY)
+    #include "platforms/rcore_memory.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -574,6 +586,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_MEMORY)
+    TRACELOG(LOG_INFO, "Platform backend: MEMORY (software renderer)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -702,6 +716,12 @@ void CloseWindow(void)
     ClosePlatform();
     //--------------------------------------------------------------
 
+    CloseParallelJobs();        // Stop parallel jobs worker threads
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    ExportProfileZones(PROFILE_ZONES_FILE_NAME);    // Export recorded profiling zones to trace file
+#endif
+
     CORE.Window.ready = false;
     TRACELOG(LOG_INFO, "Window closed successfully");
 }
@@ -837,6 +857,8 @@ void BeginDrawing(void)
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+    rlResetFrameStats();                // Reset rendering statistics for current frame
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
@@ -895,7 +917,9 @@ void EndDrawing(void)
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    PROFILE_ZONE_BEGIN("SwapScreenBuffer");
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    PROFILE_ZONE_END();
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -916,7 +940,9 @@ void EndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
+    PROFILE_ZONE_BEGIN("PollInputEvents");
     PollInputEvents();      // Poll user events (before next frame update)
+    PROFILE_ZONE_END();
 #endif
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
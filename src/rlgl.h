@@ -31,6 +31,10 @@
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
+*       #define GRAPHICS_API_OPENGL_11_SOFTWARE
+*           Use OpenGL 1.1 graphics backend implemented by software renderer (rlsw.h),
+*           rendering is done by CPU into an in-memory framebuffer, no GPU or OpenGL library required
+*
 *       #define RLGL_IMPLEMENTATION
 *           Generates the implementation of the library into the included file.
 *           If not defined, the library is in header only mode and can be included in other headers
@@ -46,16 +50,28 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_FRAME_STATS
+*           Enable rendering statistics counters (draw calls, vertex, uploads, state changes), rlGetFrameStats()
+*           If not defined, counters are not compiled and statistics are always zero
+*
+*       #define RLGL_PROFILE_ZONE_BEGIN(name)
+*       #define RLGL_PROFILE_ZONE_END()
+*           Profiling zones hooks, called on hot-path functions (i.e. rlDrawRenderBatch()),
+*           define them before implementation inclusion to use a custom profiler, empty by default
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_STREAM_BUFFERS       3    // Minimum number of batch buffers for persistent mapped vertex streaming
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
+*       #define RL_DEFAULT_BATCH_DEFERRED_DRAWCALLS 2048   // Default number of batch draw commands recorded on deferred draw mode (sorted and merged on draw)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SPRITE_FRAMES                 64    // Maximum number of sprite frames (source rectangles) on instanced sprites drawing
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -145,6 +161,11 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// OpenGL 1.1 software renderer uses OpenGL 1.1 functionality
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE) && !defined(GRAPHICS_API_OPENGL_11)
+    #define GRAPHICS_API_OPENGL_11
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -212,9 +233,15 @@
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef RL_DEFAULT_BATCH_STREAM_BUFFERS
+    #define RL_DEFAULT_BATCH_STREAM_BUFFERS          3      // Minimum number of batch buffers for persistent mapped vertex streaming
+#endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
+#ifndef RL_DEFAULT_BATCH_DEFERRED_DRAWCALLS
+    #define RL_DEFAULT_BATCH_DEFERRED_DRAWCALLS   2048      // Default number of batch draw commands recorded on deferred draw mode (sorted and merged on draw)
+#endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
@@ -229,6 +256,11 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// Instanced sprites limits
+#ifndef RL_MAX_SPRITE_FRAMES
+    #define RL_MAX_SPRITE_FRAMES                    64      // Maximum number of sprite frames (source rectangles) on instanced sprites drawing
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -268,7 +300,10 @@
 #define RL_QUADS                                0x0007      // GL_QUADS
 
 // GL equivalent data types
+#define RL_BYTE                                 0x1400      // GL_BYTE
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_SHORT                                0x1402      // GL_SHORT
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
 
 // GL buffer usage hint
@@ -379,18 +414,25 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned char *streamData;  // Interleaved vertex data, staging or persistent mapped memory (interleaved streaming modes)
+    void *streamFence;          // OpenGL sync object, signaled when vertex data is not used anymore by GPU (persistent streaming mode)
 } rlVertexBuffer;
 
 // Draw call type
-// NOTE: Only texture changes register a new draw, other state-change-related elements are not
-// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
-// of those state-change happens (this is done in core module)
+// NOTE: Only mode and texture changes register a new draw, shader and blend mode changes force
+// a batch draw call, except on deferred draw mode, where they also register a new draw and
+// draws are sorted by state (layer, shader, blend mode, texture) before drawing the batch
+// Other state-change-related elements are not used at this moment (vaoId, matrices),
+// raylib just forces a batch draw call if any of those state-change happens (this is done in core module)
 typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
+    unsigned int shaderId;      // Shader id to be used on the draw -> Set from RLGL.currentShaderId
+    int *shaderLocs;            // Shader locations to be used on the draw -> Set from RLGL.currentShaderLocs
+    int blendMode;              // Blending mode to be used on the draw -> Set from RLGL.currentBlendMode
+    int layer;                  // Draw layer, lower layers are drawn first (deferred draw mode)
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
@@ -401,6 +443,7 @@ typedef struct rlDrawCall {
 typedef struct rlRenderBatch {
     int bufferCount;            // Number of vertex buffers (multi-buffering support)
     int currentBuffer;          // Current buffer tracking in case of multi-buffering
+    int streamMode;             // Vertex data streaming mode to GPU (rlBatchStreamMode)
     rlVertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
@@ -408,6 +451,63 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Rendering statistics, accumulated since last reset (by default, reset every frame)
+// NOTE: Counters are only updated if RLGL_ENABLE_FRAME_STATS is defined
+typedef struct rlFrameStats {
+    int drawCalls;              // Number of draw calls submitted (render batch and vertex array draws)
+    int drawCommands;           // Number of render batch draw commands recorded (draw calls required without deferred sorting and merging)
+    int batchFlushes;           // Number of render batches drawn with vertex data
+    int batchOverflows;         // Number of render batches drawn because batch limits were reached (vertex elements, draw calls)
+    int vertexCount;            // Number of vertex drawn (render batch and vertex array draws, instances included)
+    int textureBinds;           // Number of texture binds
+    int shaderSwitches;         // Number of shader program changes (binding the already bound program is not counted)
+    int blendSwitches;          // Number of blending mode changes
+    unsigned int uploadBytes;   // Number of bytes uploaded to GPU: vertex, index, shader storage buffers and textures
+} rlFrameStats;
+
+// Draw calls statistics, subset of rendering statistics
+// NOTE: Kept for compatibility, use rlFrameStats
+typedef struct rlDrawCallStats {
+    int batchCount;             // Number of render batches drawn (with vertex data)
+    int commandCount;           // Number of draw commands recorded, draw calls required without sorting and merging
+    int drawCallCount;          // Number of draw calls submitted
+    int shaderChanges;          // Number of shader changes on render batches drawing
+    int blendChanges;           // Number of blending mode changes on render batches drawing
+} rlDrawCallStats;
+
+// rlVertexBatch type, direct access to vertex data reserved on current render batch
+// NOTE: Pointers are only valid until next render batch draw, vertex data is not transformed
+typedef struct rlVertexBatch {
+    int vertexCount;            // Number of vertex reserved
+    float depth;                // Current depth value, z coordinate for 2d vertex
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex)
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex)
+    float *normals;             // Vertex normal (XYZ - 3 components per vertex)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex)
+} rlVertexBatch;
+
+// Quad vertex type, packed 2d vertex data
+typedef struct rlQuadVertex {
+    float x, y;                 // Vertex position (XY)
+    float u, v;                 // Vertex texture coordinates (UV)
+    unsigned char r, g, b, a;   // Vertex color (RGBA)
+} rlQuadVertex;
+
+// Quad type, vertex in rlgl quads order: top-left, bottom-left, bottom-right, top-right
+typedef struct rlQuad {
+    rlQuadVertex vertices[4];   // Quad vertex data
+} rlQuad;
+
+// Sprite instance type, compact sprite data uploaded per instance (24 bytes)
+// NOTE: Sprite is drawn centered at position, size is frame size scaled
+typedef struct rlSpriteInstance {
+    float x, y;                 // Sprite center position
+    float rotation;             // Sprite rotation in degrees
+    float scale;                // Sprite scale
+    unsigned short frame;       // Sprite frame index (source rectangle)
+    unsigned char r, g, b, a;   // Sprite tint color
+} rlSpriteInstance;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -418,6 +518,15 @@ typedef enum {
     RL_OPENGL_ES_30             // OpenGL ES 3.0 (GLSL 300 es)
 } rlGlVersion;
 
+// Render batch vertex data streaming modes
+// NOTE: Vertex data is always accumulated on separate CPU arrays (rlVertexBuffer),
+// streaming mode defines how it is laid out and uploaded to GPU on rlDrawRenderBatch()
+typedef enum {
+    RL_BATCH_STREAM_SEPARATE = 0,   // One vertex buffer per attribute, updated with glBufferSubData() (default)
+    RL_BATCH_STREAM_INTERLEAVED,    // One interleaved vertex buffer, orphaned and updated with a single upload
+    RL_BATCH_STREAM_PERSISTENT      // One interleaved vertex buffer per batch buffer, persistent mapped (OpenGL 4.4 or GL_ARB_buffer_storage)
+} rlBatchStreamMode;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -701,15 +810,33 @@ RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader lo
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
+RLAPI void rlSetRenderBatchStreamMode(int mode);        // Set vertex data streaming mode for next loaded render batches (default batch: set before rlglInit())
+RLAPI int rlGetRenderBatchStreamMode(void);             // Get vertex data streaming mode of current render batch
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements); // Load a render batch system
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);    // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI rlVertexBatch rlReserveVertexBatch(int vertexCount); // Reserve vertex on current render batch draw, direct access to vertex data
+RLAPI void rlPushQuads(const rlQuad *quads, int count); // Push quads to current render batch draw, requires RL_QUADS mode
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Deferred draw mode, draw commands are sorted by state (layer, shader, blend mode, texture) and merged on render batch draw
+// NOTE: Shader and blend mode changes do not force a render batch draw, shader uniforms are applied on render batch draw
+RLAPI void rlEnableDeferredDraw(void);                  // Enable deferred draw mode (current render batch is drawn)
+RLAPI void rlDisableDeferredDraw(void);                 // Disable deferred draw mode (current render batch is drawn)
+RLAPI bool rlIsDeferredDrawEnabled(void);               // Check if deferred draw mode is enabled
+RLAPI void rlSetDrawLayer(int layer);                   // Set current draw layer, lower layers are drawn first (deferred draw mode)
+RLAPI int rlGetDrawLayer(void);                         // Get current draw layer
+
+// Rendering statistics (requires RLGL_ENABLE_FRAME_STATS)
+RLAPI rlFrameStats rlGetFrameStats(void);               // Get rendering statistics since last reset
+RLAPI void rlResetFrameStats(void);                     // Reset rendering statistics (called on frame drawing start)
+RLAPI rlDrawCallStats rlGetDrawCallStats(void);         // Get draw calls statistics since last reset (deprecated, use rlGetFrameStats())
+RLAPI void rlResetDrawCallStats(void);                  // Reset draw calls statistics (deprecated, use rlResetFrameStats())
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -718,6 +845,7 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic); // Load vertex buffer elements object
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset); // Update vertex buffer object data on GPU buffer
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset); // Update vertex buffer elements data on GPU buffer
+RLAPI bool rlIsVertexBufferDynamic(unsigned int id);   // Check if vertex buffer object was loaded as dynamic
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);     // Unload vertex array (vao)
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);    // Unload vertex buffer object
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset); // Set vertex attribute data configuration
@@ -727,6 +855,7 @@ RLAPI void rlDrawVertexArray(int offset, int count);    // Draw vertex array (cu
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer); // Draw vertex array elements
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances); // Draw vertex array (currently active vao) with instancing
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances); // Draw vertex array elements with instancing
+RLAPI bool rlDrawSpriteInstances(unsigned int textureId, int textureWidth, int textureHeight, const float *frames, int frameCount, const rlSpriteInstance *instances, int instanceCount); // Draw sprites with instancing, frames as source rectangles (x, y, width, height), returns false if not supported or custom shader active
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
@@ -810,7 +939,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_11)
-    #if defined(__APPLE__)
+    #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+        #define SW_MALLOC RL_MALLOC
+        #define SW_CALLOC RL_CALLOC
+        #define SW_REALLOC RL_REALLOC
+        #define SW_FREE RL_FREE
+
+        #define RLSW_IMPLEMENTATION
+        #include "rlsw.h"               // OpenGL 1.1 software renderer, OpenGL functions mapped to it
+    #elif defined(__APPLE__)
         #include <OpenGL/gl.h>          // OpenGL 1.1 library for OSX
         #include <OpenGL/glext.h>       // OpenGL extensions library
     #else
@@ -865,8 +1002,8 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #endif
 #endif
 
-#include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <stdlib.h>                     // Required for: malloc(), free(), qsort()
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
 //----------------------------------------------------------------------------------
@@ -882,6 +1019,26 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RAD2DEG (180.0f/PI)
 #endif
 
+// Rendering statistics counters update, not compiled if not enabled
+#if defined(RLGL_ENABLE_FRAME_STATS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define RL_FRAME_STATS_ADD(counter, value) RLGL.State.frameStats.counter += (value)
+    // Shader program bound, only counted as shader switch if bound program changed
+    #define RL_FRAME_STATS_PROGRAM(id) do { \
+        if (((id) != 0) && ((id) != RLGL.State.activeProgramId)) RLGL.State.frameStats.shaderSwitches++; \
+        RLGL.State.activeProgramId = (id); } while (0)
+#else
+    #define RL_FRAME_STATS_ADD(counter, value) ((void)0)
+    #define RL_FRAME_STATS_PROGRAM(id) ((void)0)
+#endif
+
+// Profiling zones hooks, empty if not externally provided
+#ifndef RLGL_PROFILE_ZONE_BEGIN
+    #define RLGL_PROFILE_ZONE_BEGIN(name) ((void)0)
+#endif
+#ifndef RLGL_PROFILE_ZONE_END
+    #define RLGL_PROFILE_ZONE_END() ((void)0)
+#endif
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -1006,6 +1163,36 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Render batch draw calls limits: allocated and current one (depends on deferred draw mode)
+#define RL_BATCH_DRAWCALLS_MAX ((RL_DEFAULT_BATCH_DEFERRED_DRAWCALLS > RL_DEFAULT_BATCH_DRAWCALLS)? RL_DEFAULT_BATCH_DEFERRED_DRAWCALLS : RL_DEFAULT_BATCH_DRAWCALLS)
+#define RL_BATCH_DRAWCALLS_LIMIT ((RLGL.Deferred.enabled)? RL_DEFAULT_BATCH_DEFERRED_DRAWCALLS : RL_DEFAULT_BATCH_DRAWCALLS)
+
+// Draw command sorting key, used on deferred draw mode
+typedef struct rlDrawCallKey {
+    int layer;                              // Draw layer
+    unsigned int shaderId;                  // Shader id
+    int *shaderLocs;                        // Shader locations
+    int blendMode;                          // Blending mode
+    unsigned int textureId;                 // Texture id
+    int mode;                               // Drawing mode: LINES, TRIANGLES, QUADS
+    int index;                              // Draw command index, keeps sorting stable
+    int vertexOffset;                       // Draw command vertex offset in batch vertex buffer
+    int vertexCount;                        // Draw command number of vertex
+} rlDrawCallKey;
+
+// Instanced sprites shader locations
+typedef enum {
+    RL_SPRITE_LOC_VERTEX_POSITION = 0,      // Vertex attribute: quad corner (unit square)
+    RL_SPRITE_LOC_INSTANCE_TRANSFORM,       // Instance attribute: position, rotation, scale
+    RL_SPRITE_LOC_INSTANCE_FRAME,           // Instance attribute: frame index
+    RL_SPRITE_LOC_INSTANCE_COLOR,           // Instance attribute: tint color
+    RL_SPRITE_LOC_MATRIX_MVP,               // Uniform: model-view-projection matrix
+    RL_SPRITE_LOC_TEXTURE_SIZE,             // Uniform: texture size in pixels
+    RL_SPRITE_LOC_FRAMES,                   // Uniform: frames array, source rectangles
+    RL_SPRITE_LOC_FRAME_COUNT,              // Uniform: frames count, instances with invalid frame are skipped
+    RL_SPRITE_LOC_TEXTURE                   // Uniform: texture sampler
+} rlSpriteLocation;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1040,6 +1227,7 @@ typedef struct rlglData {
 
         // Blending variables
         int currentBlendMode;               // Blending mode active
+        int activeBlendMode;                // Blending mode set on OpenGL, could differ from current one on deferred draw mode
         int glBlendSrcFactor;               // Blending source factor
         int glBlendDstFactor;               // Blending destination factor
         int glBlendEquation;                // Blending equation
@@ -1054,7 +1242,33 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        int batchStreamMode;                // Requested vertex data streaming mode for render batches loading (rlBatchStreamMode)
+
+        rlFrameStats frameStats;            // Rendering statistics since last reset (RLGL_ENABLE_FRAME_STATS)
+        unsigned int activeProgramId;       // Shader program bound on OpenGL, tracked for shader switches statistics
+
     } State;            // Renderer state
+    struct {
+        bool enabled;                       // Deferred draw mode enabled
+        int currentLayer;                   // Current draw layer
+
+        rlDrawCallKey *keys;                // Draw commands sorting keys
+        int keyCapacity;                    // Draw commands sorting keys capacity
+        float *vertices;                    // Sorted vertex position, scratch buffer
+        float *texcoords;                   // Sorted vertex texture coordinates, scratch buffer
+        float *normals;                     // Sorted vertex normals, scratch buffer
+        unsigned char *colors;              // Sorted vertex colors, scratch buffer
+        int vertexCapacity;                 // Scratch buffers vertex capacity
+
+    } Deferred;         // Deferred draw mode data
+    struct {
+        unsigned int shaderId;              // Instanced sprites shader program id
+        int locs[9];                        // Instanced sprites shader locations (rlSpriteLocation)
+        unsigned int vaoId;                 // Instanced sprites VAO id (if supported)
+        unsigned int vboId[2];              // Instanced sprites VBO ids: quad corners, instances data
+        bool failed;                        // Instanced sprites loading failed, not tried again
+
+    } Sprites;          // Instanced sprites drawing data
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -1072,6 +1286,7 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistent mapped buffers support (GL_ARB_buffer_storage, OpenGL 4.4)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1079,6 +1294,14 @@ typedef struct rlglData {
     } ExtSupported;     // Extensions supported flags
 } rlglData;
 
+// Render batch interleaved vertex, used on interleaved streaming modes
+typedef struct rlBatchVertex {
+    float position[3];                      // Vertex position (shader-location = 0)
+    float texcoord[2];                      // Vertex texture coordinates (shader-location = 1)
+    float normal[3];                        // Vertex normal (shader-location = 2)
+    unsigned char color[4];                 // Vertex color (shader-location = 3)
+} rlBatchVertex;
+
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1111,6 +1334,17 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static bool rlLoadSpriteInstancing(void);   // Load instanced sprites drawing shader and buffers
+static void rlUnloadSpriteInstancing(void); // Unload instanced sprites drawing shader and buffers
+static void rlSetSpriteInstancingAttribs(void); // Bind instanced sprites buffers and set vertex attributes
+static void rlSetVertexBufferStreamAttribs(rlVertexBuffer *buffer, int *locs); // Bind interleaved vertex buffer and set vertex attributes
+static void rlUpdateVertexBufferStream(rlVertexBuffer *buffer, int streamMode, int vertexCount); // Update interleaved vertex buffer with CPU vertex data
+static void rlApplyBlendMode(int mode);     // Set blending mode on OpenGL state
+static void rlSetDrawCallState(rlDrawCall *draw); // Set current state (shader, blend mode, layer) to draw call
+static void rlUpdateDrawCallState(void);    // Update current draw call state, starts a new draw call if state changed (deferred draw mode)
+static void rlSortRenderBatchDraws(rlRenderBatch *batch); // Sort render batch draw calls by state and merge them (deferred draw mode)
+static void rlDrawDeferredShaderDraws(void); // Draw recorded draws using bound shader before its uniforms change (deferred draw mode)
+static void rlSetRenderBatchShader(rlRenderBatch *batch, unsigned int shaderId, int *locs); // Set shader for render batch drawing: matrices, vertex attributes and default values
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1442,11 +1676,16 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_BATCH_DRAWCALLS_LIMIT)
+        {
+            RL_FRAME_STATS_ADD(batchOverflows, 1);
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        rlSetDrawCallState(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
     }
 }
 
@@ -1609,6 +1848,7 @@ void rlSetTexture(unsigned int id)
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
+            RL_FRAME_STATS_ADD(batchOverflows, 1);
             rlDrawRenderBatch(RLGL.currentBatch);
         }
 #endif
@@ -1639,10 +1879,15 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_BATCH_DRAWCALLS_LIMIT)
+            {
+                RL_FRAME_STATS_ADD(batchOverflows, 1);
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            rlSetDrawCallState(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
         }
 #endif
     }
@@ -1663,6 +1908,7 @@ void rlEnableTexture(unsigned int id)
     glEnable(GL_TEXTURE_2D);
 #endif
     glBindTexture(GL_TEXTURE_2D, id);
+    RL_FRAME_STATS_ADD(textureBinds, 1);
 }
 
 // Disable texture
@@ -1787,6 +2033,7 @@ void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(id);
+    RL_FRAME_STATS_PROGRAM(id);
 #endif
 }
 
@@ -1795,6 +2042,7 @@ void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(0);
+    RL_FRAME_STATS_PROGRAM(0);
 #endif
 }
 
@@ -2062,39 +2310,42 @@ void rlCheckErrors(void)
 }
 
 // Set blend mode
+// NOTE: On deferred draw mode blending mode is registered for next draws and set on render batch drawing,
+// custom blending modes always force a render batch draw (pending draws keep previous blending factors)
 void rlSetBlendMode(int mode)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
-
-        switch (mode)
+        if (!RLGL.Deferred.enabled || (mode == RL_BLEND_CUSTOM) || (mode == RL_BLEND_CUSTOM_SEPARATE))
         {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
-
-            } break;
-            case RL_BLEND_CUSTOM_SEPARATE:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
-
-            } break;
-            default: break;
+            rlDrawRenderBatch(RLGL.currentBatch);
+            rlApplyBlendMode(mode);
         }
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
+
+        rlUpdateDrawCallState();
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_11)
+    static bool unsupportedWarned = false;  // Unsupported blending mode warning already shown
+
+    // NOTE: Only blending factors are available, blending equation is always add
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+        case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break;
+        case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
+        case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); break;
+        default:
+        {
+            // NOTE: Blending mode is usually set every frame, warning is only shown once
+            if (!unsupportedWarned) TRACELOG(RL_LOG_WARNING, "GL: Blending mode not supported on OpenGL 1.1");
+            unsupportedWarned = true;
+        } break;
     }
 #endif
 }
@@ -2107,6 +2358,9 @@ void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
         (RLGL.State.glBlendDstFactor != glDstFactor) ||
         (RLGL.State.glBlendEquation != glEquation))
     {
+        // Pending draws on deferred draw mode could use custom blending mode with previous factors
+        if (RLGL.Deferred.enabled) rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.glBlendSrcFactor = glSrcFactor;
         RLGL.State.glBlendDstFactor = glDstFactor;
         RLGL.State.glBlendEquation = glEquation;
@@ -2127,6 +2381,9 @@ void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int g
         (RLGL.State.glBlendEquationRGB != glEqRGB) ||
         (RLGL.State.glBlendEquationAlpha != glEqAlpha))
     {
+        // Pending draws on deferred draw mode could use custom blending mode with previous factors
+        if (RLGL.Deferred.enabled) rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.glBlendSrcFactorRGB = glSrcRGB;
         RLGL.State.glBlendDestFactorRGB = glDstRGB;
         RLGL.State.glBlendSrcFactorAlpha = glSrcAlpha;
@@ -2206,6 +2463,12 @@ static void GLAPIENTRY rlDebugMessageCallback(GLenum source, GLenum type, GLuint
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // Init software renderer framebuffer, required before any OpenGL call
+    if (swInit(width, height)) TRACELOG(RL_LOG_INFO, "RLGL: Software renderer initialized successfully (%i x %i)", width, height);
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Failed to initialize software renderer");
+#endif
+
     // Enable OpenGL debug context if required
 #if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT) && defined(GRAPHICS_API_OPENGL_43)
     if ((glDebugMessageCallback != NULL) && (glDebugMessageControl != NULL))
@@ -2300,11 +2563,30 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload deferred draw mode sorting data
+    RL_FREE(RLGL.Deferred.keys);
+    RL_FREE(RLGL.Deferred.vertices);
+    RL_FREE(RLGL.Deferred.texcoords);
+    RL_FREE(RLGL.Deferred.normals);
+    RL_FREE(RLGL.Deferred.colors);
+    RLGL.Deferred.keys = NULL;
+    RLGL.Deferred.vertices = NULL;
+    RLGL.Deferred.texcoords = NULL;
+    RLGL.Deferred.normals = NULL;
+    RLGL.Deferred.colors = NULL;
+    RLGL.Deferred.keyCapacity = 0;
+    RLGL.Deferred.vertexCapacity = 0;
+
+    rlUnloadSpriteInstancing();       // Unload instanced sprites drawing data
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    swClose();      // Unload software renderer framebuffer and textures
+#endif
 }
 
 // Load OpenGL extensions
@@ -2362,6 +2644,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
     #endif
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glMapBufferRange != NULL) && (glFenceSync != NULL);
 
 #endif  // GRAPHICS_API_OPENGL_33
 
@@ -2571,6 +2854,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2668,24 +2952,75 @@ int *rlGetShaderLocsDefault(void)
 
 // Render batch management
 //------------------------------------------------------------------------------------------------
+// Set vertex data streaming mode for next loaded render batches
+// NOTE: Default render batch is loaded on rlglInit(), mode must be set before,
+// mode is checked on loading and unsupported modes fallback to a supported one
+void rlSetRenderBatchStreamMode(int mode)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((mode >= RL_BATCH_STREAM_SEPARATE) && (mode <= RL_BATCH_STREAM_PERSISTENT)) RLGL.State.batchStreamMode = mode;
+#endif
+}
+
+// Get vertex data streaming mode of current render batch
+int rlGetRenderBatchStreamMode(void)
+{
+    int mode = RL_BATCH_STREAM_SEPARATE;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentBatch != NULL) mode = RLGL.currentBatch->streamMode;
+#endif
+
+    return mode;
+}
+
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 {
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check requested vertex data streaming mode support, fallback to interleaved streaming if not supported
+    batch.streamMode = RLGL.State.batchStreamMode;
+
+    if ((batch.streamMode == RL_BATCH_STREAM_PERSISTENT) && !RLGL.ExtSupported.bufferStorage)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Persistent mapped buffers not supported, using interleaved vertex streaming");
+        batch.streamMode = RL_BATCH_STREAM_INTERLEAVED;
+    }
+
+    // NOTE: Persistent mapped buffers can not be written while GPU is reading them,
+    // multiple buffers are required to avoid waiting for the previous frame draw
+    if ((batch.streamMode == RL_BATCH_STREAM_PERSISTENT) && (numBuffers < RL_DEFAULT_BATCH_STREAM_BUFFERS)) numBuffers = RL_DEFAULT_BATCH_STREAM_BUFFERS;
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        // NOTE: On interleaved streaming modes vertex data is copied to GPU buffer on every draw,
+        // CPU vertex arrays (and staging memory) are shared by all buffers
+        if ((batch.streamMode != RL_BATCH_STREAM_SEPARATE) && (i > 0))
+        {
+            batch.vertexBuffer[i].vertices = batch.vertexBuffer[0].vertices;
+            batch.vertexBuffer[i].texcoords = batch.vertexBuffer[0].texcoords;
+            batch.vertexBuffer[i].normals = batch.vertexBuffer[0].normals;
+            batch.vertexBuffer[i].colors = batch.vertexBuffer[0].colors;
+            batch.vertexBuffer[i].streamData = batch.vertexBuffer[0].streamData;
+        }
+        else
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].normals = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));         // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));  // 4 float by color, 4 colors by quad
+
+            // Staging memory for interleaved vertex data, persistent mapped buffers are written directly
+            if (batch.streamMode == RL_BATCH_STREAM_INTERLEAVED) batch.vertexBuffer[i].streamData = (unsigned char *)RL_MALLOC(bufferElements*4*sizeof(rlBatchVertex));
+        }
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2693,11 +3028,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2730,34 +3060,62 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (batch.streamMode != RL_BATCH_STREAM_SEPARATE)
+        {
+            // Quads - Interleaved vertex buffer, all vertex attributes in a single buffer
+            int bufferSize = bufferElements*4*sizeof(rlBatchVertex);
+
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (batch.streamMode == RL_BATCH_STREAM_PERSISTENT)
+            {
+                // NOTE: Buffer is kept mapped, coherent mapping makes CPU writes visible to GPU without flushing
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(GL_ARRAY_BUFFER, bufferSize, NULL, flags);
+                batch.vertexBuffer[i].streamData = (unsigned char *)glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, flags);
+
+                if (batch.vertexBuffer[i].streamData == NULL) TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffer");
+            }
+            else
+#endif
+            {
+                glBufferData(GL_ARRAY_BUFFER, bufferSize, NULL, GL_STREAM_DRAW);
+            }
+
+            rlSetVertexBufferStreamAttribs(&batch.vertexBuffer[i], RLGL.State.currentShaderLocs);
+        }
+        else
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex normal buffer (shader-location = 2)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
@@ -2778,15 +3136,16 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
     // Init draw calls tracking system
     //--------------------------------------------------------------------------------------------
-    batch.draws = (rlDrawCall *)RL_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall));
+    // NOTE: Draw calls array is allocated for deferred draw mode limit, more draw calls are recorded in that mode
+    batch.draws = (rlDrawCall *)RL_MALLOC(RL_BATCH_DRAWCALLS_MAX*sizeof(rlDrawCall));
 
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    for (int i = 0; i < RL_BATCH_DRAWCALLS_MAX; i++)
     {
         batch.draws[i].mode = RL_QUADS;
         batch.draws[i].vertexCount = 0;
         batch.draws[i].vertexAlignment = 0;
         //batch.draws[i].vaoId = 0;
-        //batch.draws[i].shaderId = 0;
+        rlSetDrawCallState(&batch.draws[i]);
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
@@ -2823,6 +3182,18 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Unmap persistent mapped vertex buffer and delete pending sync object
+        if (batch.streamMode == RL_BATCH_STREAM_PERSISTENT)
+        {
+            if (batch.vertexBuffer[i].streamFence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].streamFence);
+
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            if (batch.vertexBuffer[i].streamData != NULL) glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+#endif
+
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
@@ -2834,10 +3205,15 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        // NOTE: On interleaved streaming modes vertex arrays are shared by all buffers
+        if ((batch.streamMode == RL_BATCH_STREAM_SEPARATE) || (i == 0))
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].normals);
+            RL_FREE(batch.vertexBuffer[i].colors);
+            if (batch.streamMode == RL_BATCH_STREAM_INTERLEAVED) RL_FREE(batch.vertexBuffer[i].streamData);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2852,6 +3228,21 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL_PROFILE_ZONE_BEGIN("rlDrawRenderBatch");
+
+    // Sort and merge draw calls by state (deferred draw mode)
+    //------------------------------------------------------------------------------------------------------------
+    if (RLGL.State.vertexCounter > 0)
+    {
+        RL_FRAME_STATS_ADD(batchFlushes, 1);
+#if defined(RLGL_ENABLE_FRAME_STATS)
+        for (int i = 0; i < batch->drawCounter; i++) if (batch->draws[i].vertexCount > 0) RL_FRAME_STATS_ADD(drawCommands, 1);
+#endif
+
+        if (RLGL.Deferred.enabled) rlSortRenderBatchDraws(batch);
+    }
+    //------------------------------------------------------------------------------------------------------------
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
@@ -2861,40 +3252,36 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+        if (batch->streamMode != RL_BATCH_STREAM_SEPARATE)
+        {
+            // Interleaved vertex buffer, all vertex data updated at once
+            rlUpdateVertexBufferStream(&batch->vertexBuffer[batch->currentBuffer], batch->streamMode, RLGL.State.vertexCounter);
+            RL_FRAME_STATS_ADD(uploadBytes, RLGL.State.vertexCounter*sizeof(rlBatchVertex));
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Normals buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+
+            RL_FRAME_STATS_ADD(uploadBytes, RLGL.State.vertexCounter*(8*sizeof(float) + 4*sizeof(unsigned char)));
+        }
 
         // Unbind the current VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2925,65 +3312,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Draw buffers
         if (RLGL.State.vertexCounter > 0)
         {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
-
-            // Create modelview-projection matrix and upload to shader
-            Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
-            }
-
-            // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
-            // transformations and rendering occur between rlPushMatrix and rlPopMatrix.
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
-            }
+            // NOTE: Shader is set for every draw call requiring a different one than previous draw call,
+            // only on deferred draw mode a render batch could contain draw calls with different shaders
+            unsigned int shaderId = 0;
+            int *shaderLocs = NULL;
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: normal (shader-location = 2)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
-            }
-
-            // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -2993,6 +3327,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 {
                     glActiveTexture(GL_TEXTURE0 + 1 + i);
                     glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    RL_FRAME_STATS_ADD(textureBinds, 1);
                 }
             }
 
@@ -3002,21 +3337,38 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
-
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                if (batch->draws[i].vertexCount > 0)
                 {
+                    // Set draw call shader and blending mode, only if changed
+                    if ((batch->draws[i].shaderId != shaderId) || (batch->draws[i].shaderLocs != shaderLocs))
+                    {
+                        shaderId = batch->draws[i].shaderId;
+                        shaderLocs = batch->draws[i].shaderLocs;
+                        rlSetRenderBatchShader(batch, shaderId, shaderLocs);
+                    }
+
+                    if (batch->draws[i].blendMode != RLGL.State.activeBlendMode) rlApplyBlendMode(batch->draws[i].blendMode);
+
+                    // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                    RL_FRAME_STATS_ADD(textureBinds, 1);
+
+                    if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                    else
+                    {
 #if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                        // We need to define the number of indices to be processed: elementCount*6
+                        // NOTE: The final parameter tells the GPU the offset in bytes from the
+                        // start of the index buffer to the location of the first index to process
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
 #endif
+                    }
+
+                    RL_FRAME_STATS_ADD(drawCalls, 1);
+                    RL_FRAME_STATS_ADD(vertexCount, batch->draws[i].vertexCount);
                 }
 
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
@@ -3034,10 +3386,22 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
 
         glUseProgram(0);    // Unbind shader program
+        RL_FRAME_STATS_PROGRAM(0);
     }
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    // Restore current blending mode, draw calls could set a different one (deferred draw mode)
+    if (RLGL.State.activeBlendMode != RLGL.State.currentBlendMode) rlApplyBlendMode(RLGL.State.currentBlendMode);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Insert a fence after draw commands, persistent mapped buffer is not written again until GPU is done with it
+    if ((batch->streamMode == RL_BATCH_STREAM_PERSISTENT) && (RLGL.State.vertexCounter > 0))
+    {
+        batch->vertexBuffer[batch->currentBuffer].streamFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -3053,11 +3417,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     RLGL.State.modelview = matModelView;
 
     // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    // NOTE: Only used draws are reset, new draws are initialized when registered
+    for (int i = 0; i < batch->drawCounter; i++)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        rlSetDrawCallState(&batch->draws[i]);
     }
 
     // Reset active texture units for next batch
@@ -3070,6 +3437,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+    RLGL_PROFILE_ZONE_END();
 #endif
 }
 
@@ -3081,6 +3450,8 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 
     if (batch != NULL) RLGL.currentBatch = batch;
     else RLGL.currentBatch = &RLGL.defaultBatch;
+
+    rlUpdateDrawCallState();
 #endif
 }
 
@@ -3103,6 +3474,7 @@ bool rlCheckRenderBatchLimit(int vCount)
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
     {
         overflow = true;
+        RL_FRAME_STATS_ADD(batchOverflows, 1);
 
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
@@ -3119,6 +3491,215 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Reserve vertex on current render batch draw, returns direct pointers to vertex data
+// NOTE: Render batch is drawn if required vertex do not fit, vertexCount must keep current
+// drawing mode aligned (multiple of 4 for RL_QUADS) and vertex data is not transformed
+rlVertexBatch rlReserveVertexBatch(int vertexCount)
+{
+    rlVertexBatch batch = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((vertexCount <= 0) || (vertexCount >= RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Vertex batch size not supported by render batch (%i vertex)", vertexCount);
+        return batch;
+    }
+
+    rlCheckRenderBatchLimit(vertexCount);
+
+    // NOTE: Current buffer could change if render batch was drawn
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+    batch.vertexCount = vertexCount;
+    batch.depth = RLGL.currentBatch->currentDepth;
+    batch.vertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+    batch.texcoords = buffer->texcoords + 2*RLGL.State.vertexCounter;
+    batch.normals = buffer->normals + 3*RLGL.State.vertexCounter;
+    batch.colors = buffer->colors + 4*RLGL.State.vertexCounter;
+
+    RLGL.State.vertexCounter += vertexCount;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += vertexCount;
+#endif
+
+    return batch;
+}
+
+// Push quads to current render batch draw, requires RL_QUADS mode
+// NOTE: Quads are split over multiple render batch draws if required,
+// current normal is used and transform matrix is applied if required
+void rlPushQuads(const rlQuad *quads, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    for (int i = 0; i < count; i++)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            const rlQuadVertex *vertex = &quads[i].vertices[k];
+
+            glColor4ub(vertex->r, vertex->g, vertex->b, vertex->a);
+            glTexCoord2f(vertex->u, vertex->v);
+            glVertex2f(vertex->x, vertex->y);
+        }
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    while (count > 0)
+    {
+        // Quads fitting in current batch buffer, batch is drawn if full
+        int quadCount = (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - RLGL.State.vertexCounter - 1)/4;
+
+        if (quadCount < 1)
+        {
+            rlCheckRenderBatchLimit(4);
+            quadCount = (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - RLGL.State.vertexCounter - 1)/4;
+            if (quadCount < 1) break;
+        }
+
+        if (quadCount > count) quadCount = count;
+
+        rlVertexBatch batch = rlReserveVertexBatch(quadCount*4);
+        Matrix transform = RLGL.State.transform;
+
+        for (int i = 0; i < batch.vertexCount; i++)
+        {
+            const rlQuadVertex *vertex = &quads[i/4].vertices[i%4];
+            float x = vertex->x;
+            float y = vertex->y;
+            float z = batch.depth;
+
+            // Transform vertex position if required
+            if (RLGL.State.transformRequired)
+            {
+                x = transform.m0*vertex->x + transform.m4*vertex->y + transform.m8*batch.depth + transform.m12;
+                y = transform.m1*vertex->x + transform.m5*vertex->y + transform.m9*batch.depth + transform.m13;
+                z = transform.m2*vertex->x + transform.m6*vertex->y + transform.m10*batch.depth + transform.m14;
+            }
+
+            batch.vertices[3*i] = x;
+            batch.vertices[3*i + 1] = y;
+            batch.vertices[3*i + 2] = z;
+
+            batch.texcoords[2*i] = vertex->u;
+            batch.texcoords[2*i + 1] = vertex->v;
+
+            batch.normals[3*i] = RLGL.State.normalx;
+            batch.normals[3*i + 1] = RLGL.State.normaly;
+            batch.normals[3*i + 2] = RLGL.State.normalz;
+
+            batch.colors[4*i] = vertex->r;
+            batch.colors[4*i + 1] = vertex->g;
+            batch.colors[4*i + 2] = vertex->b;
+            batch.colors[4*i + 3] = vertex->a;
+        }
+
+        quads += quadCount;
+        count -= quadCount;
+    }
+#endif
+}
+
+// Enable deferred draw mode
+// NOTE: Draw commands are recorded with their state (layer, shader, blend mode, texture) and
+// sorted and merged on render batch drawing, recording order is only kept between layers
+// and for draw commands with the same state
+void rlEnableDeferredDraw(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.Deferred.enabled)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.Deferred.enabled = true;
+    }
+#endif
+}
+
+// Disable deferred draw mode
+void rlDisableDeferredDraw(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Deferred.enabled)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.Deferred.enabled = false;
+    }
+#endif
+}
+
+// Check if deferred draw mode is enabled
+bool rlIsDeferredDrawEnabled(void)
+{
+    bool enabled = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    enabled = RLGL.Deferred.enabled;
+#endif
+    return enabled;
+}
+
+// Set current draw layer, lower layers are drawn first
+// NOTE: Draw layer is only considered on deferred draw mode
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Deferred.currentLayer != layer)
+    {
+        RLGL.Deferred.currentLayer = layer;
+
+        if (RLGL.Deferred.enabled) rlUpdateDrawCallState();
+    }
+#endif
+}
+
+// Get current draw layer
+int rlGetDrawLayer(void)
+{
+    int layer = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    layer = RLGL.Deferred.currentLayer;
+#endif
+    return layer;
+}
+
+// Get rendering statistics since last reset
+// NOTE: Statistics are reset by raylib on BeginDrawing(), querying them after EndDrawing() returns full frame values
+rlFrameStats rlGetFrameStats(void)
+{
+    rlFrameStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.State.frameStats;
+#endif
+    return stats;
+}
+
+// Reset rendering statistics
+void rlResetFrameStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.frameStats = (rlFrameStats){ 0 };
+#endif
+}
+
+// Get draw calls statistics since last reset
+// NOTE: Kept for compatibility, values taken from rendering statistics
+rlDrawCallStats rlGetDrawCallStats(void)
+{
+    rlFrameStats frameStats = rlGetFrameStats();
+    rlDrawCallStats stats = { 0 };
+
+    stats.batchCount = frameStats.batchFlushes;
+    stats.commandCount = frameStats.drawCommands;
+    stats.drawCallCount = frameStats.drawCalls;
+    stats.shaderChanges = frameStats.shaderSwitches;
+    stats.blendChanges = frameStats.blendSwitches;
+
+    return stats;
+}
+
+// Reset draw calls statistics
+void rlResetDrawCallStats(void)
+{
+    rlResetFrameStats();
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3199,6 +3780,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 #if !defined(GRAPHICS_API_OPENGL_11)
             else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
 #endif
+            if (dataPtr != NULL) RL_FRAME_STATS_ADD(uploadBytes, mipSize);
 
 #if defined(GRAPHICS_API_OPENGL_33)
             if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
@@ -3367,6 +3949,8 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
             {
                 if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
                 else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+
+                RL_FRAME_STATS_ADD(uploadBytes, dataSize);
             }
 
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -3418,6 +4002,7 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+        RL_FRAME_STATS_ADD(uploadBytes, rlGetPixelDataSize(width, height, format));
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
@@ -3756,6 +4341,7 @@ unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if (buffer != NULL) RL_FRAME_STATS_ADD(uploadBytes, size);
 #endif
 
     return id;
@@ -3770,6 +4356,7 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
     glGenBuffers(1, &id);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if (buffer != NULL) RL_FRAME_STATS_ADD(uploadBytes, size);
 #endif
 
     return id;
@@ -3814,6 +4401,7 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RL_FRAME_STATS_ADD(uploadBytes, dataSize);
 #endif
 }
 
@@ -3824,9 +4412,30 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RL_FRAME_STATS_ADD(uploadBytes, dataSize);
 #endif
 }
 
+// Check if vertex buffer object was loaded as dynamic
+bool rlIsVertexBufferDynamic(unsigned int id)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0)
+    {
+        int usage = 0;
+        glBindBuffer(GL_ARRAY_BUFFER, id);
+        glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_USAGE, &usage);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        result = (usage == GL_DYNAMIC_DRAW);
+    }
+#endif
+
+    return result;
+}
+
 // Enable vertex array object (VAO)
 bool rlEnableVertexArray(unsigned int vaoId)
 {
@@ -3869,6 +4478,9 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+
+    RL_FRAME_STATS_ADD(drawCalls, 1);
+    RL_FRAME_STATS_ADD(vertexCount, count);
 }
 
 // Draw vertex array elements
@@ -3879,6 +4491,9 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+
+    RL_FRAME_STATS_ADD(drawCalls, 1);
+    RL_FRAME_STATS_ADD(vertexCount, count);
 }
 
 // Draw vertex array instanced
@@ -3886,6 +4501,9 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+
+    RL_FRAME_STATS_ADD(drawCalls, 1);
+    RL_FRAME_STATS_ADD(vertexCount, count*instances);
 #endif
 }
 
@@ -3898,9 +4516,86 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+
+    RL_FRAME_STATS_ADD(drawCalls, 1);
+    RL_FRAME_STATS_ADD(vertexCount, count*instances);
 #endif
 }
 
+// Draw sprites with instancing, sprite quads are expanded on vertex shader
+// NOTE: Instances data is uploaded once per call (24 bytes per sprite), frames are source
+// rectangles in pixels (x, y, width, height), negative width/height flips the sprite,
+// instances with frame index not lower than frameCount are skipped (collapsed quad),
+// returns false if a custom shader is active, sprites must be drawn with it using render batch
+bool rlDrawSpriteInstances(unsigned int textureId, int textureWidth, int textureHeight, const float *frames, int frameCount, const rlSpriteInstance *instances, int instanceCount)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check instancing support, shader and buffers are loaded on first use
+    // NOTE: Internal sprites shader replaces current shader, only used if default shader is active
+    if (RLGL.ExtSupported.instancing && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) &&
+        (frameCount > 0) && (frameCount <= RL_MAX_SPRITE_FRAMES) &&
+        ((RLGL.Sprites.shaderId > 0) || (!RLGL.Sprites.failed && rlLoadSpriteInstancing())))
+    {
+        result = true;
+
+        if (instanceCount > 0)
+        {
+            // Draw current render batch, required to keep drawing order
+            rlDrawRenderBatchActive();
+
+            // Upload instances data, buffer storage is orphaned to avoid synchronization
+            glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, instanceCount*sizeof(rlSpriteInstance), instances, GL_STREAM_DRAW);
+            RL_FRAME_STATS_ADD(uploadBytes, instanceCount*sizeof(rlSpriteInstance));
+
+            glUseProgram(RLGL.Sprites.shaderId);
+            RL_FRAME_STATS_PROGRAM(RLGL.Sprites.shaderId);
+
+            // Create modelview-projection matrix, including current transform matrix (if required)
+            Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+            if (RLGL.State.transformRequired) matMVP = rlMatrixMultiply(RLGL.State.transform, matMVP);
+
+            glUniformMatrix4fv(RLGL.Sprites.locs[RL_SPRITE_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            glUniform2f(RLGL.Sprites.locs[RL_SPRITE_LOC_TEXTURE_SIZE], (float)textureWidth, (float)textureHeight);
+            glUniform4fv(RLGL.Sprites.locs[RL_SPRITE_LOC_FRAMES], frameCount, frames);
+            glUniform1i(RLGL.Sprites.locs[RL_SPRITE_LOC_FRAME_COUNT], frameCount);
+            glUniform1i(RLGL.Sprites.locs[RL_SPRITE_LOC_TEXTURE], 0);
+
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, textureId);
+            RL_FRAME_STATS_ADD(textureBinds, 1);
+
+            // Bind quad corners and instances buffers, attributes are kept on VAO (if supported)
+            if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.Sprites.vaoId);
+            else rlSetSpriteInstancingAttribs();
+
+            rlDrawVertexArrayInstanced(0, 6, instanceCount);
+
+            if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+            else
+            {
+                // Reset instance attributes divisors, attributes locations could be used by render batch
+                for (int i = RL_SPRITE_LOC_VERTEX_POSITION; i <= RL_SPRITE_LOC_INSTANCE_COLOR; i++)
+                {
+                    if (RLGL.Sprites.locs[i] == -1) continue;
+                    if (i != RL_SPRITE_LOC_VERTEX_POSITION) glVertexAttribDivisor(RLGL.Sprites.locs[i], 0);
+                    glDisableVertexAttribArray(RLGL.Sprites.locs[i]);
+                }
+            }
+
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            glUseProgram(0);
+            RL_FRAME_STATS_PROGRAM(0);
+        }
+    }
+#endif
+
+    return result;
+}
+
 #if defined(GRAPHICS_API_OPENGL_11)
 // Enable vertex state pointer
 void rlEnableStatePointer(int vertexAttribType, void *buffer)
@@ -4216,6 +4911,8 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawDeferredShaderDraws();
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4257,6 +4954,8 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
         mat.m8, mat.m9, mat.m10, mat.m11,
         mat.m12, mat.m13, mat.m14, mat.m15
     };
+
+    rlDrawDeferredShaderDraws();
     glUniformMatrix4fv(locIndex, 1, false, matfloat);
 #endif
 }
@@ -4265,6 +4964,8 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
 void rlSetUniformSampler(int locIndex, unsigned int textureId)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawDeferredShaderDraws();
+
     // Check if texture is already active
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
     {
@@ -4290,14 +4991,19 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
 }
 
 // Set shader currently active (id and locations)
+// NOTE: On deferred draw mode shader is registered for next draws and set on render batch drawing,
+// render batch is still drawn if extra textures are active, they are only bound for the shader that set them
 void rlSetShader(unsigned int id, int *locs)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        if (!RLGL.Deferred.enabled || (RLGL.State.activeTextureId[0] != 0)) rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
+
+        rlUpdateDrawCallState();
     }
 #endif
 }
@@ -4369,6 +5075,7 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
     glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
     if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);    // Clear buffer data to 0
+    else RL_FRAME_STATS_ADD(uploadBytes, size);
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 #endif
 
@@ -4389,6 +5096,7 @@ void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSi
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
     glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+    RL_FRAME_STATS_ADD(uploadBytes, dataSize);
 #endif
 }
 
@@ -4853,6 +5561,610 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load instanced sprites drawing shader and buffers
+// NOTE: Sprite quad corners are expanded from instance data on vertex shader,
+// frames array size is defined by RL_MAX_SPRITE_FRAMES (vertex shader uniform vectors)
+static bool rlLoadSpriteInstancing(void)
+{
+    #define RL_SPRITE_STRINGIFY(x) #x
+    #define RL_SPRITE_TOSTRING(x) RL_SPRITE_STRINGIFY(x)
+
+    // Vertex shader directly defined, no external file required
+    const char *spriteVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                           \n"
+    "attribute vec2 " RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION "; \n"
+    "attribute vec4 instanceTransform;      \n"
+    "attribute float instanceFrame;         \n"
+    "attribute vec4 instanceColor;          \n"
+    "varying vec2 fragTexCoord;             \n"
+    "varying vec4 fragColor;                \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                           \n"
+    "in vec2 " RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION "; \n"
+    "in vec4 instanceTransform;             \n"
+    "in float instanceFrame;                \n"
+    "in vec4 instanceColor;                 \n"
+    "out vec2 fragTexCoord;                 \n"
+    "out vec4 fragColor;                    \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                           \n"
+    "precision highp float;                 \n"     // Sprite positions in pixels, vertex shaders always support high precision
+    "attribute vec2 " RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION "; \n"
+    "attribute vec4 instanceTransform;      \n"
+    "attribute float instanceFrame;         \n"
+    "attribute vec4 instanceColor;          \n"
+    "varying vec2 fragTexCoord;             \n"
+    "varying vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                      \n"
+    "uniform vec2 textureSize;              \n"
+    "uniform vec4 frames[" RL_SPRITE_TOSTRING(RL_MAX_SPRITE_FRAMES) "]; \n"
+    "uniform int frameCount;                \n"
+    "void main()                            \n"
+    "{                                      \n"
+    "    int index = int(instanceFrame);    \n"
+    "    vec4 frame = (index < frameCount)? frames[index] : vec4(0.0); \n"   // Invalid frame, collapsed quad (skipped)
+    "    vec2 corner = (" RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION " - 0.5)*abs(frame.zw)*instanceTransform.w; \n"
+    "    float angle = radians(instanceTransform.z); \n"
+    "    float c = cos(angle);              \n"
+    "    float s = sin(angle);              \n"
+    "    vec2 position = instanceTransform.xy + vec2(corner.x*c - corner.y*s, corner.x*s + corner.y*c); \n"
+    "    fragTexCoord = (frame.xy + max(-frame.zw, 0.0) + " RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION "*frame.zw)/textureSize; \n"
+    "    fragColor = instanceColor;         \n"
+    "    gl_Position = mvp*vec4(position, 0.0, 1.0); \n"
+    "}                                      \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *spriteFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                           \n"
+    "varying vec2 fragTexCoord;             \n"
+    "varying vec4 fragColor;                \n"
+    "uniform sampler2D texture0;            \n"
+    "void main()                            \n"
+    "{                                      \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                      \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                           \n"
+    "in vec2 fragTexCoord;                  \n"
+    "in vec4 fragColor;                     \n"
+    "out vec4 finalColor;                   \n"
+    "uniform sampler2D texture0;            \n"
+    "void main()                            \n"
+    "{                                      \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                      \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                           \n"
+    "precision mediump float;               \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;             \n"
+    "varying vec4 fragColor;                \n"
+    "uniform sampler2D texture0;            \n"
+    "void main()                            \n"
+    "{                                      \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                      \n";
+#endif
+
+    #undef RL_SPRITE_STRINGIFY
+    #undef RL_SPRITE_TOSTRING
+
+    // NOTE: Shaders are compiled and linked directly, default shaders are not used as fallback
+    unsigned int vShaderId = rlCompileShader(spriteVShaderCode, GL_VERTEX_SHADER);
+    unsigned int fShaderId = rlCompileShader(spriteFShaderCode, GL_FRAGMENT_SHADER);
+
+    if ((vShaderId > 0) && (fShaderId > 0)) RLGL.Sprites.shaderId = rlLoadShaderProgram(vShaderId, fShaderId);
+
+    // Detach and delete shaders, not required once program is linked
+    if (RLGL.Sprites.shaderId > 0)
+    {
+        glDetachShader(RLGL.Sprites.shaderId, vShaderId);
+        glDetachShader(RLGL.Sprites.shaderId, fShaderId);
+    }
+    if (vShaderId > 0) glDeleteShader(vShaderId);
+    if (fShaderId > 0) glDeleteShader(fShaderId);
+
+    if (RLGL.Sprites.shaderId > 0)
+    {
+        // Set instanced sprites shader locations: attributes and uniforms
+        RLGL.Sprites.locs[RL_SPRITE_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.Sprites.shaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+        RLGL.Sprites.locs[RL_SPRITE_LOC_INSTANCE_TRANSFORM] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceTransform");
+        RLGL.Sprites.locs[RL_SPRITE_LOC_INSTANCE_FRAME] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceFrame");
+        RLGL.Sprites.locs[RL_SPRITE_LOC_INSTANCE_COLOR] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceColor");
+        RLGL.Sprites.locs[RL_SPRITE_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.Sprites.shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+        RLGL.Sprites.locs[RL_SPRITE_LOC_TEXTURE_SIZE] = glGetUniformLocation(RLGL.Sprites.shaderId, "textureSize");
+        RLGL.Sprites.locs[RL_SPRITE_LOC_FRAMES] = glGetUniformLocation(RLGL.Sprites.shaderId, "frames");
+        RLGL.Sprites.locs[RL_SPRITE_LOC_FRAME_COUNT] = glGetUniformLocation(RLGL.Sprites.shaderId, "frameCount");
+        RLGL.Sprites.locs[RL_SPRITE_LOC_TEXTURE] = glGetUniformLocation(RLGL.Sprites.shaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+        // Quad corners, two triangles in rlgl quads order: top-left, bottom-left, bottom-right, top-right
+        float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+        glGenBuffers(2, RLGL.Sprites.vboId);
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &RLGL.Sprites.vaoId);
+            glBindVertexArray(RLGL.Sprites.vaoId);
+            rlSetSpriteInstancingAttribs();
+            glBindVertexArray(0);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Instanced sprites shader loaded successfully", RLGL.Sprites.shaderId);
+    }
+    else
+    {
+        RLGL.Sprites.failed = true;
+
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load instanced sprites shader");
+    }
+
+    return (RLGL.Sprites.shaderId > 0);
+}
+
+// Unload instanced sprites drawing shader and buffers
+static void rlUnloadSpriteInstancing(void)
+{
+    if (RLGL.Sprites.shaderId > 0)
+    {
+        if (RLGL.Sprites.vaoId > 0) glDeleteVertexArrays(1, &RLGL.Sprites.vaoId);
+        glDeleteBuffers(2, RLGL.Sprites.vboId);
+        rlUnloadShaderProgram(RLGL.Sprites.shaderId);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Instanced sprites shader unloaded successfully", RLGL.Sprites.shaderId);
+    }
+
+    RLGL.Sprites.shaderId = 0;
+    RLGL.Sprites.vaoId = 0;
+    RLGL.Sprites.failed = false;
+}
+
+// Bind instanced sprites buffers and set vertex attributes
+// NOTE: Quad corners are read per vertex, instance data is read once per sprite (divisor = 1)
+static void rlSetSpriteInstancingAttribs(void)
+{
+    int *locs = RLGL.Sprites.locs;
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[0]);
+    glVertexAttribPointer(locs[RL_SPRITE_LOC_VERTEX_POSITION], 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(locs[RL_SPRITE_LOC_VERTEX_POSITION]);
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+
+    if (locs[RL_SPRITE_LOC_INSTANCE_TRANSFORM] != -1)
+    {
+        glVertexAttribPointer(locs[RL_SPRITE_LOC_INSTANCE_TRANSFORM], 4, GL_FLOAT, GL_FALSE, sizeof(rlSpriteInstance), (void *)0);
+        glVertexAttribDivisor(locs[RL_SPRITE_LOC_INSTANCE_TRANSFORM], 1);
+        glEnableVertexAttribArray(locs[RL_SPRITE_LOC_INSTANCE_TRANSFORM]);
+    }
+
+    if (locs[RL_SPRITE_LOC_INSTANCE_FRAME] != -1)
+    {
+        glVertexAttribPointer(locs[RL_SPRITE_LOC_INSTANCE_FRAME], 1, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(rlSpriteInstance), (void *)(4*sizeof(float)));
+        glVertexAttribDivisor(locs[RL_SPRITE_LOC_INSTANCE_FRAME], 1);
+        glEnableVertexAttribArray(locs[RL_SPRITE_LOC_INSTANCE_FRAME]);
+    }
+
+    if (locs[RL_SPRITE_LOC_INSTANCE_COLOR] != -1)
+    {
+        glVertexAttribPointer(locs[RL_SPRITE_LOC_INSTANCE_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlSpriteInstance), (void *)(4*sizeof(float) + sizeof(unsigned short)));
+        glVertexAttribDivisor(locs[RL_SPRITE_LOC_INSTANCE_COLOR], 1);
+        glEnableVertexAttribArray(locs[RL_SPRITE_LOC_INSTANCE_COLOR]);
+    }
+}
+
+// Bind interleaved vertex buffer and set vertex attributes for provided shader locations
+static void rlSetVertexBufferStreamAttribs(rlVertexBuffer *buffer, int *locs)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+
+    // Vertex attributes offsets in interleaved vertex: position, texcoord, normal, color
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)0);
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(5*sizeof(float)));
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(8*sizeof(float)));
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+
+// Update interleaved vertex buffer with CPU vertex data
+// NOTE: Vertex data is written sequentially, orphaned buffers are updated with a single upload
+// and persistent mapped buffers are written directly once GPU is done with previous data
+static void rlUpdateVertexBufferStream(rlVertexBuffer *buffer, int streamMode, int vertexCount)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((streamMode == RL_BATCH_STREAM_PERSISTENT) && (buffer->streamFence != NULL))
+    {
+        // Wait for GPU to finish reading previous vertex data from this buffer
+        // NOTE: Buffers are used in round-robin, usually fence is already signaled
+        GLenum result = glClientWaitSync((GLsync)buffer->streamFence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync((GLsync)buffer->streamFence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+        glDeleteSync((GLsync)buffer->streamFence);
+        buffer->streamFence = NULL;
+    }
+#endif
+
+    if (buffer->streamData == NULL) return;
+
+    rlBatchVertex *vertex = (rlBatchVertex *)buffer->streamData;
+
+    for (int i = 0; i < vertexCount; i++, vertex++)
+    {
+        vertex->position[0] = buffer->vertices[3*i];
+        vertex->position[1] = buffer->vertices[3*i + 1];
+        vertex->position[2] = buffer->vertices[3*i + 2];
+        vertex->texcoord[0] = buffer->texcoords[2*i];
+        vertex->texcoord[1] = buffer->texcoords[2*i + 1];
+        vertex->normal[0] = buffer->normals[3*i];
+        vertex->normal[1] = buffer->normals[3*i + 1];
+        vertex->normal[2] = buffer->normals[3*i + 2];
+        vertex->color[0] = buffer->colors[4*i];
+        vertex->color[1] = buffer->colors[4*i + 1];
+        vertex->color[2] = buffer->colors[4*i + 2];
+        vertex->color[3] = buffer->colors[4*i + 3];
+    }
+
+    if (streamMode == RL_BATCH_STREAM_INTERLEAVED)
+    {
+        // Orphan previous buffer storage, GPU could still be reading it, no implicit synchronization required
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*sizeof(rlBatchVertex), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount*sizeof(rlBatchVertex), buffer->streamData);
+    }
+}
+
+// Set blending mode on OpenGL state
+static void rlApplyBlendMode(int mode)
+{
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
+            glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
+            glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+
+        } break;
+        default: break;
+    }
+
+    RLGL.State.activeBlendMode = mode;
+    RL_FRAME_STATS_ADD(blendSwitches, 1);
+}
+
+// Set current state (shader, blend mode, layer) to draw call
+static void rlSetDrawCallState(rlDrawCall *draw)
+{
+    draw->shaderId = RLGL.State.currentShaderId;
+    draw->shaderLocs = RLGL.State.currentShaderLocs;
+    draw->blendMode = RLGL.State.currentBlendMode;
+    draw->layer = RLGL.Deferred.currentLayer;
+}
+
+// Update current draw call state, a new draw call is registered if current one has vertex data with a different state
+// NOTE: Shader and blend mode changes do not force a render batch draw on deferred draw mode
+static void rlUpdateDrawCallState(void)
+{
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if ((draw->vertexCount > 0) &&
+        ((draw->shaderId != RLGL.State.currentShaderId) ||
+         (draw->shaderLocs != RLGL.State.currentShaderLocs) ||
+         (draw->blendMode != RLGL.State.currentBlendMode) ||
+         (draw->layer != RLGL.Deferred.currentLayer)))
+    {
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlBegin())
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+
+        if (RLGL.currentBatch->drawCounter >= RL_BATCH_DRAWCALLS_LIMIT)
+        {
+            RL_FRAME_STATS_ADD(batchOverflows, 1);
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
+
+        // New draw keeps previous mode and texture
+        draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        draw->mode = mode;
+        draw->vertexCount = 0;
+        draw->textureId = textureId;
+    }
+
+    rlSetDrawCallState(draw);
+}
+
+// Compare draw command sorting keys: layer, shader, blend mode, texture, mode and recording order
+static int rlDrawCallKeyCompare(const void *a, const void *b)
+{
+    const rlDrawCallKey *keyA = (const rlDrawCallKey *)a;
+    const rlDrawCallKey *keyB = (const rlDrawCallKey *)b;
+
+    if (keyA->layer != keyB->layer) return (keyA->layer < keyB->layer)? -1 : 1;
+    if (keyA->shaderId != keyB->shaderId) return (keyA->shaderId < keyB->shaderId)? -1 : 1;
+    if (keyA->blendMode != keyB->blendMode) return (keyA->blendMode < keyB->blendMode)? -1 : 1;
+    if (keyA->textureId != keyB->textureId) return (keyA->textureId < keyB->textureId)? -1 : 1;
+    if (keyA->mode != keyB->mode) return (keyA->mode < keyB->mode)? -1 : 1;
+
+    // NOTE: Recording order is used as last key, sorting is stable
+    return (keyA->index < keyB->index)? -1 : ((keyA->index > keyB->index)? 1 : 0);
+}
+
+// Sort render batch draw calls by state and merge them (deferred draw mode)
+// NOTE: Vertex data is reordered in the batch vertex arrays, consecutive draw calls with the same
+// state are merged and every new draw call starts aligned to a multiple of 4 vertex (QUADS indexing),
+// recorded draws are kept if alignment vertex added to sorted draws do not fit in the batch buffer
+static void rlSortRenderBatchDraws(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    // Load sorting keys and scratch vertex arrays, only first time or if a bigger batch is drawn
+    if (RLGL.Deferred.keys == NULL)
+    {
+        RLGL.Deferred.keys = (rlDrawCallKey *)RL_MALLOC(RL_BATCH_DRAWCALLS_MAX*sizeof(rlDrawCallKey));
+        RLGL.Deferred.keyCapacity = RL_BATCH_DRAWCALLS_MAX;
+    }
+
+    if (RLGL.Deferred.vertexCapacity < buffer->elementCount*4)
+    {
+        RL_FREE(RLGL.Deferred.vertices);
+        RL_FREE(RLGL.Deferred.texcoords);
+        RL_FREE(RLGL.Deferred.normals);
+        RL_FREE(RLGL.Deferred.colors);
+
+        RLGL.Deferred.vertexCapacity = buffer->elementCount*4;
+        RLGL.Deferred.vertices = (float *)RL_MALLOC(RLGL.Deferred.vertexCapacity*3*sizeof(float));
+        RLGL.Deferred.texcoords = (float *)RL_MALLOC(RLGL.Deferred.vertexCapacity*2*sizeof(float));
+        RLGL.Deferred.normals = (float *)RL_MALLOC(RLGL.Deferred.vertexCapacity*3*sizeof(float));
+        RLGL.Deferred.colors = (unsigned char *)RL_MALLOC(RLGL.Deferred.vertexCapacity*4*sizeof(unsigned char));
+    }
+
+    // Get draw commands with vertex data
+    rlDrawCallKey *keys = RLGL.Deferred.keys;
+    int keyCount = 0;
+
+    for (int i = 0, vertexOffset = 0; (i < batch->drawCounter) && (keyCount < RLGL.Deferred.keyCapacity); i++)
+    {
+        if (batch->draws[i].vertexCount > 0)
+        {
+            keys[keyCount].layer = batch->draws[i].layer;
+            keys[keyCount].shaderId = batch->draws[i].shaderId;
+            keys[keyCount].shaderLocs = batch->draws[i].shaderLocs;
+            keys[keyCount].blendMode = batch->draws[i].blendMode;
+            keys[keyCount].textureId = batch->draws[i].textureId;
+            keys[keyCount].mode = batch->draws[i].mode;
+            keys[keyCount].index = i;
+            keys[keyCount].vertexOffset = vertexOffset;
+            keys[keyCount].vertexCount = batch->draws[i].vertexCount;
+            keyCount++;
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    if (keyCount == 0) return;
+
+    qsort(keys, keyCount, sizeof(rlDrawCallKey), rlDrawCallKeyCompare);
+
+    // Check if there is something to reorder or merge, recorded draws are kept otherwise
+    bool sorted = (keyCount == batch->drawCounter);
+
+    for (int i = 0; (i < keyCount) && sorted; i++)
+    {
+        if (keys[i].index != i) sorted = false;
+        else if ((i > 0) && (keys[i].shaderId == keys[i - 1].shaderId) && (keys[i].shaderLocs == keys[i - 1].shaderLocs) &&
+            (keys[i].blendMode == keys[i - 1].blendMode) && (keys[i].textureId == keys[i - 1].textureId) && (keys[i].mode == keys[i - 1].mode)) sorted = false;
+    }
+
+    if (sorted) return;
+
+    // Check sorted vertex data fits in batch buffer, an unaligned draw (last recorded one) sorted
+    // before other draws gets alignment vertex, required vertex could exceed recorded ones
+    int requiredVertexCount = 0;
+
+    for (int i = 0; i < keyCount; i++)
+    {
+        requiredVertexCount += keys[i].vertexCount;
+
+        if ((i < (keyCount - 1)) && ((keys[i + 1].shaderId != keys[i].shaderId) || (keys[i + 1].shaderLocs != keys[i].shaderLocs) ||
+            (keys[i + 1].blendMode != keys[i].blendMode) || (keys[i + 1].textureId != keys[i].textureId) || (keys[i + 1].mode != keys[i].mode)))
+        {
+            requiredVertexCount += (4 - requiredVertexCount%4)%4;
+        }
+    }
+
+    if (requiredVertexCount > buffer->elementCount*4) return;
+
+    // Copy vertex data in sorted order to scratch arrays, merging draws with the same state
+    // NOTE: Draw calls array is rewritten, keys keep the recorded draws data
+    int drawCounter = 0;
+    int vertexCounter = 0;
+
+    for (int i = 0; i < keyCount; i++)
+    {
+        rlDrawCall *draw = (drawCounter > 0)? &batch->draws[drawCounter - 1] : NULL;
+
+        if ((draw == NULL) || (draw->shaderId != keys[i].shaderId) || (draw->shaderLocs != keys[i].shaderLocs) ||
+            (draw->blendMode != keys[i].blendMode) || (draw->textureId != keys[i].textureId) || (draw->mode != keys[i].mode))
+        {
+            // Align previous draw to a multiple of 4 vertex, required to keep QUADS index processing aligned
+            if (draw != NULL)
+            {
+                draw->vertexAlignment = (4 - draw->vertexCount%4)%4;
+                vertexCounter += draw->vertexAlignment;
+            }
+
+            draw = &batch->draws[drawCounter];
+            draw->mode = keys[i].mode;
+            draw->vertexCount = 0;
+            draw->vertexAlignment = 0;
+            draw->shaderId = keys[i].shaderId;
+            draw->shaderLocs = keys[i].shaderLocs;
+            draw->blendMode = keys[i].blendMode;
+            draw->layer = keys[i].layer;
+            draw->textureId = keys[i].textureId;
+            drawCounter++;
+        }
+
+        memcpy(RLGL.Deferred.vertices + 3*vertexCounter, buffer->vertices + 3*keys[i].vertexOffset, keys[i].vertexCount*3*sizeof(float));
+        memcpy(RLGL.Deferred.texcoords + 2*vertexCounter, buffer->texcoords + 2*keys[i].vertexOffset, keys[i].vertexCount*2*sizeof(float));
+        memcpy(RLGL.Deferred.normals + 3*vertexCounter, buffer->normals + 3*keys[i].vertexOffset, keys[i].vertexCount*3*sizeof(float));
+        memcpy(RLGL.Deferred.colors + 4*vertexCounter, buffer->colors + 4*keys[i].vertexOffset, keys[i].vertexCount*4*sizeof(unsigned char));
+
+        draw->vertexCount += keys[i].vertexCount;
+        vertexCounter += keys[i].vertexCount;
+    }
+
+    // Copy sorted vertex data back to batch vertex arrays
+    memcpy(buffer->vertices, RLGL.Deferred.vertices, vertexCounter*3*sizeof(float));
+    memcpy(buffer->texcoords, RLGL.Deferred.texcoords, vertexCounter*2*sizeof(float));
+    memcpy(buffer->normals, RLGL.Deferred.normals, vertexCounter*3*sizeof(float));
+    memcpy(buffer->colors, RLGL.Deferred.colors, vertexCounter*4*sizeof(unsigned char));
+
+    batch->drawCounter = drawCounter;
+    RLGL.State.vertexCounter = vertexCounter;
+}
+
+
+// Draw recorded draws using bound shader before its uniforms change (deferred draw mode)
+// NOTE: Uniforms are set on bound shader program, draws already recorded with it must use previous values,
+// shader program and extra textures active are restored after render batch drawing
+static void rlDrawDeferredShaderDraws(void)
+{
+    if (!RLGL.Deferred.enabled || (RLGL.State.vertexCounter == 0)) return;
+
+    GLint programId = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &programId);
+
+    unsigned int shaderId = (unsigned int)programId;
+    bool pending = false;
+
+    for (int i = 0; (i < RLGL.currentBatch->drawCounter) && !pending; i++)
+    {
+        if ((RLGL.currentBatch->draws[i].vertexCount > 0) && (RLGL.currentBatch->draws[i].shaderId == shaderId)) pending = true;
+    }
+
+    if (pending)
+    {
+        unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS] = { 0 };
+        memcpy(activeTextureId, RLGL.State.activeTextureId, sizeof(activeTextureId));
+
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        memcpy(RLGL.State.activeTextureId, activeTextureId, sizeof(activeTextureId));
+        glUseProgram(shaderId);
+        RL_FRAME_STATS_PROGRAM(shaderId);
+    }
+}
+
+// Set shader for render batch drawing: matrices, vertex attributes and default values
+static void rlSetRenderBatchShader(rlRenderBatch *batch, unsigned int shaderId, int *locs)
+{
+    // Set shader and upload current MVP matrix
+    glUseProgram(shaderId);
+    RL_FRAME_STATS_PROGRAM(shaderId);
+
+    // Create modelview-projection matrix and upload to shader
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+
+    if (locs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+    }
+
+    // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
+    // transformations and rendering occur between rlPushMatrix and rlPopMatrix.
+
+    if (locs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+    }
+
+    // Bind vertex buffers and vertex attribs for shader locations
+    // NOTE: Vertex array object keeps vertex attribs bound for default shader locations
+    if (!RLGL.ExtSupported.vao)
+    {
+        if (batch->streamMode != RL_BATCH_STREAM_SEPARATE)
+        {
+            // Bind interleaved vertex buffer and vertex attribs
+            rlSetVertexBufferStreamAttribs(&batch->vertexBuffer[batch->currentBuffer], locs);
+
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+        }
+        else
+        {
+            // Bind vertex attrib: position (shader-location = 0)
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+            // Bind vertex attrib: texcoord (shader-location = 1)
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+            // Bind vertex attrib: normal (shader-location = 2)
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+
+            // Bind vertex attrib: color (shader-location = 3)
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+            glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+        }
+    }
+
+    // Setup some default shader values
+    glUniform4f(locs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(locs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -0,0 +1,2120 @@
+/**********************************************************************************************
+*
+*   rlsw v1.0 - OpenGL 1.1 software renderer, multi-threaded tile-based rasterizer
+*
+*   DESCRIPTION:
+*       Software implementation of the OpenGL 1.1 functions subset used by rlgl (GRAPHICS_API_OPENGL_11),
+*       all rendering is done by the CPU into an in-memory framebuffer (RGBA 8-bit color, 32-bit float depth),
+*       no GPU, graphics drivers or windowing system are required
+*
+*   FEATURES:
+*       - Immediate mode (glBegin()/glEnd()) and client vertex arrays (glDrawArrays()/glDrawElements())
+*       - Primitives: points, lines, triangles and quads, polygon modes: fill, line and point
+*       - Projection and modelview matrix stacks, primitives clipping against view frustum
+*       - Textures: luminance, luminance-alpha, RGB and RGBA formats, 8-bit and 16-bit packed pixel types
+*       - Texture filtering (nearest, bilinear) and wrapping (repeat, mirrored repeat, clamp)
+*       - Blending (glBlendFunc() factors), depth test, depth and color write masks, face culling, scissor test
+*       - Fragment color computed as rlgl default shader: texel color*vertex color, perspective correct
+*
+*   LIMITATIONS:
+*       - Only texture level 0 is stored and sampled, mipmaps are ignored
+*       - Texture matrix stack is kept but not applied to texture coordinates
+*       - No lighting, fog, alpha test, stencil or framebuffer objects (not used by rlgl on OpenGL 1.1)
+*
+*   IMPLEMENTATION:
+*       Primitives are transformed, clipped and set up as screen space triangles on submission,
+*       every triangle is binned into the framebuffer tiles it overlaps; on swFinish(), or when an
+*       operation requires framebuffer or textures data, tiles are rasterized in parallel, every tile
+*       processes its triangles in submission order, result does not depend on number of threads
+*
+*   CONFIGURATION:
+*       #define RLSW_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*       #define RLSW_PARALLEL_JOBS(job, data, count)
+*           Run job(data, index) for every index in [0..count), returning when all jobs are done,
+*           jobs can be run in parallel on multiple threads (i.e. raylib RunParallelJobs()),
+*           by default jobs are run sequentially on caller thread
+*
+*       rlsw capabilities could be customized defining some internal
+*       values before library inclusion (default values listed):
+*
+*       #define RLSW_TILE_SIZE                        64    // Framebuffer tile size (pixels), tiles are rasterized in parallel
+*       #define RLSW_MAX_BATCH_TRIANGLES           32768    // Maximum triangles pending rasterization, rasterized when full
+*       #define RLSW_MAX_MATRIX_STACK_SIZE            32    // Maximum matrix stack depth
+*
+*   DEPENDENCIES:
+*       - C standard library only
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLSW_H
+#define RLSW_H
+
+#define RLSW_VERSION  "1.0"
+
+// Allow custom memory allocators
+#ifndef SW_MALLOC
+    #define SW_MALLOC(sz)     malloc(sz)
+#endif
+#ifndef SW_CALLOC
+    #define SW_CALLOC(n,sz)   calloc(n,sz)
+#endif
+#ifndef SW_REALLOC
+    #define SW_REALLOC(n,sz)  realloc(n,sz)
+#endif
+#ifndef SW_FREE
+    #define SW_FREE(p)        free(p)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RLSW_TILE_SIZE
+    #define RLSW_TILE_SIZE                    64        // Framebuffer tile size (pixels)
+#endif
+#ifndef RLSW_MAX_BATCH_TRIANGLES
+    #define RLSW_MAX_BATCH_TRIANGLES       32768        // Maximum triangles pending rasterization
+#endif
+#ifndef RLSW_MAX_MATRIX_STACK_SIZE
+    #define RLSW_MAX_MATRIX_STACK_SIZE        32        // Maximum matrix stack depth
+#endif
+
+// OpenGL 1.1 types
+typedef unsigned int GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef void GLvoid;
+typedef signed char GLbyte;
+typedef short GLshort;
+typedef int GLint;
+typedef unsigned char GLubyte;
+typedef unsigned short GLushort;
+typedef unsigned int GLuint;
+typedef int GLsizei;
+typedef float GLfloat;
+typedef float GLclampf;
+typedef double GLdouble;
+typedef double GLclampd;
+
+// OpenGL 1.1 defines supported
+// NOTE: Values are the same as OpenGL ones
+#define GL_FALSE                            0
+#define GL_TRUE                             1
+
+#define GL_POINTS                           0x0000
+#define GL_LINES                            0x0001
+#define GL_TRIANGLES                        0x0004
+#define GL_QUADS                            0x0007
+
+#define GL_DEPTH_BUFFER_BIT                 0x00000100
+#define GL_COLOR_BUFFER_BIT                 0x00004000
+
+#define GL_NEVER                            0x0200
+#define GL_LESS                             0x0201
+#define GL_EQUAL                            0x0202
+#define GL_LEQUAL                           0x0203
+#define GL_GREATER                          0x0204
+#define GL_NOTEQUAL                         0x0205
+#define GL_GEQUAL                           0x0206
+#define GL_ALWAYS                           0x0207
+
+#define GL_ZERO                             0
+#define GL_ONE                              1
+#define GL_SRC_COLOR                        0x0300
+#define GL_ONE_MINUS_SRC_COLOR              0x0301
+#define GL_SRC_ALPHA                        0x0302
+#define GL_ONE_MINUS_SRC_ALPHA              0x0303
+#define GL_DST_ALPHA                        0x0304
+#define GL_ONE_MINUS_DST_ALPHA              0x0305
+#define GL_DST_COLOR                        0x0306
+#define GL_ONE_MINUS_DST_COLOR              0x0307
+#define GL_SRC_ALPHA_SATURATE               0x0308
+
+#define GL_FRONT                            0x0404
+#define GL_BACK                             0x0405
+#define GL_FRONT_AND_BACK                   0x0408
+#define GL_CW                               0x0900
+#define GL_CCW                              0x0901
+
+#define GL_POINT                            0x1B00
+#define GL_LINE                             0x1B01
+#define GL_FILL                             0x1B02
+
+#define GL_LINE_SMOOTH                      0x0B20
+#define GL_LINE_WIDTH                       0x0B21
+#define GL_CULL_FACE                        0x0B44
+#define GL_DEPTH_TEST                       0x0B71
+#define GL_MODELVIEW_MATRIX                 0x0BA6
+#define GL_PROJECTION_MATRIX                0x0BA7
+#define GL_TEXTURE_MATRIX                   0x0BA8
+#define GL_BLEND                            0x0BE2
+#define GL_SCISSOR_TEST                     0x0C11
+#define GL_PERSPECTIVE_CORRECTION_HINT      0x0C50
+#define GL_UNPACK_ALIGNMENT                 0x0CF5
+#define GL_PACK_ALIGNMENT                   0x0D05
+#define GL_TEXTURE_2D                       0x0DE1
+
+#define GL_VENDOR                           0x1F00
+#define GL_RENDERER                         0x1F01
+#define GL_VERSION                          0x1F02
+#define GL_EXTENSIONS                       0x1F03
+
+#define GL_DONT_CARE                        0x1100
+#define GL_FASTEST                          0x1101
+#define GL_NICEST                           0x1102
+
+#define GL_UNSIGNED_BYTE                    0x1401
+#define GL_UNSIGNED_SHORT                   0x1403
+#define GL_UNSIGNED_INT                     0x1405
+#define GL_FLOAT                            0x1406
+
+#define GL_MODELVIEW                        0x1700
+#define GL_PROJECTION                       0x1701
+#define GL_TEXTURE                          0x1702
+
+#define GL_ALPHA                            0x1906
+#define GL_RGB                              0x1907
+#define GL_RGBA                             0x1908
+#define GL_LUMINANCE                        0x1909
+#define GL_LUMINANCE_ALPHA                  0x190A
+
+#define GL_FLAT                             0x1D00
+#define GL_SMOOTH                           0x1D01
+
+#define GL_NEAREST                          0x2600
+#define GL_LINEAR                           0x2601
+#define GL_NEAREST_MIPMAP_NEAREST           0x2700
+#define GL_LINEAR_MIPMAP_NEAREST            0x2701
+#define GL_NEAREST_MIPMAP_LINEAR            0x2702
+#define GL_LINEAR_MIPMAP_LINEAR             0x2703
+#define GL_TEXTURE_MAG_FILTER               0x2800
+#define GL_TEXTURE_MIN_FILTER               0x2801
+#define GL_TEXTURE_WRAP_S                   0x2802
+#define GL_TEXTURE_WRAP_T                   0x2803
+#define GL_CLAMP                            0x2900
+#define GL_REPEAT                           0x2901
+
+#define GL_VERTEX_ARRAY                     0x8074
+#define GL_NORMAL_ARRAY                     0x8075
+#define GL_COLOR_ARRAY                      0x8076
+#define GL_TEXTURE_COORD_ARRAY              0x8078
+
+#define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
+#define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
+#define GL_UNSIGNED_SHORT_5_6_5             0x8363
+#define GL_CLAMP_TO_EDGE                    0x812F
+#define GL_MIRRORED_REPEAT                  0x8370
+
+// OpenGL 1.1 functions mapped to software renderer functions
+#define glEnable                swEnable
+#define glDisable               swDisable
+#define glClearColor            swClearColor
+#define glClearDepth            swClearDepth
+#define glClear                 swClear
+#define glViewport              swViewport
+#define glScissor               swScissor
+#define glColorMask             swColorMask
+#define glDepthMask             swDepthMask
+#define glDepthFunc             swDepthFunc
+#define glBlendFunc             swBlendFunc
+#define glCullFace              swCullFace
+#define glFrontFace             swFrontFace
+#define glPolygonMode           swPolygonMode
+#define glLineWidth             swLineWidth
+#define glHint                  swHint
+#define glShadeModel            swShadeModel
+#define glPixelStorei           swPixelStorei
+#define glGetFloatv             swGetFloatv
+#define glGetString             swGetString
+
+#define glMatrixMode            swMatrixMode
+#define glPushMatrix            swPushMatrix
+#define glPopMatrix             swPopMatrix
+#define glLoadIdentity          swLoadIdentity
+#define glMultMatrixf           swMultMatrixf
+#define glTranslatef            swTranslatef
+#define glRotatef               swRotatef
+#define glScalef                swScalef
+#define glOrtho                 swOrtho
+#define glFrustum               swFrustum
+
+#define glBegin                 swBegin
+#define glEnd                   swEnd
+#define glVertex2i              swVertex2i
+#define glVertex2f              swVertex2f
+#define glVertex3f              swVertex3f
+#define glTexCoord2f            swTexCoord2f
+#define glNormal3f              swNormal3f
+#define glColor3f               swColor3f
+#define glColor4f               swColor4f
+#define glColor4ub              swColor4ub
+
+#define glEnableClientState     swEnableClientState
+#define glDisableClientState    swDisableClientState
+#define glVertexPointer         swVertexPointer
+#define glTexCoordPointer       swTexCoordPointer
+#define glNormalPointer         swNormalPointer
+#define glColorPointer          swColorPointer
+#define glDrawArrays            swDrawArrays
+#define glDrawElements          swDrawElements
+
+#define glGenTextures           swGenTextures
+#define glDeleteTextures        swDeleteTextures
+#define glBindTexture           swBindTexture
+#define glTexImage2D            swTexImage2D
+#define glTexSubImage2D         swTexSubImage2D
+#define glTexParameteri         swTexParameteri
+#define glGetTexImage           swGetTexImage
+#define glReadPixels            swReadPixels
+
+//----------------------------------------------------------------------------------
+// Functions Declaration - Software renderer management
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+int swInit(int width, int height);                      // Initialize software renderer and framebuffer, returns 1 on success
+void swClose(void);                                     // Close software renderer, framebuffer and textures are unloaded
+int swResize(int width, int height);                    // Resize framebuffer, contents are cleared, returns 1 on success
+void swFinish(void);                                    // Rasterize all pending primitives into framebuffer
+void *swGetColorBuffer(int *width, int *height);        // Get framebuffer color data (RGBA 8-bit, bottom-up rows), pending primitives are rasterized
+
+//----------------------------------------------------------------------------------
+// Functions Declaration - OpenGL 1.1 functions subset
+//----------------------------------------------------------------------------------
+void swEnable(GLenum cap);
+void swDisable(GLenum cap);
+void swClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+void swClearDepth(GLclampd depth);
+void swClear(GLbitfield mask);
+void swViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void swScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void swColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void swDepthMask(GLboolean flag);
+void swDepthFunc(GLenum func);
+void swBlendFunc(GLenum sfactor, GLenum dfactor);
+void swCullFace(GLenum mode);
+void swFrontFace(GLenum mode);
+void swPolygonMode(GLenum face, GLenum mode);
+void swLineWidth(GLfloat width);
+void swHint(GLenum target, GLenum mode);
+void swShadeModel(GLenum mode);
+void swPixelStorei(GLenum pname, GLint param);
+void swGetFloatv(GLenum pname, GLfloat *params);
+const GLubyte *swGetString(GLenum name);
+
+void swMatrixMode(GLenum mode);
+void swPushMatrix(void);
+void swPopMatrix(void);
+void swLoadIdentity(void);
+void swMultMatrixf(const GLfloat *m);
+void swTranslatef(GLfloat x, GLfloat y, GLfloat z);
+void swRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+void swScalef(GLfloat x, GLfloat y, GLfloat z);
+void swOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble znear, GLdouble zfar);
+void swFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble znear, GLdouble zfar);
+
+void swBegin(GLenum mode);
+void swEnd(void);
+void swVertex2i(GLint x, GLint y);
+void swVertex2f(GLfloat x, GLfloat y);
+void swVertex3f(GLfloat x, GLfloat y, GLfloat z);
+void swTexCoord2f(GLfloat s, GLfloat t);
+void swNormal3f(GLfloat nx, GLfloat ny, GLfloat nz);
+void swColor3f(GLfloat red, GLfloat green, GLfloat blue);
+void swColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void swColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha);
+
+void swEnableClientState(GLenum array);
+void swDisableClientState(GLenum array);
+void swVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void swTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void swNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer);
+void swColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void swDrawArrays(GLenum mode, GLint first, GLsizei count);
+void swDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices);
+
+void swGenTextures(GLsizei n, GLuint *textures);
+void swDeleteTextures(GLsizei n, const GLuint *textures);
+void swBindTexture(GLenum target, GLuint texture);
+void swTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels);
+void swTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels);
+void swTexParameteri(GLenum target, GLenum pname, GLint param);
+void swGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels);
+void swReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLSW_H
+
+/***********************************************************************************
+*
+*   RLSW IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLSW_IMPLEMENTATION)
+
+#include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>                 // Required for: memcpy(), memset()
+#include <math.h>                   // Required for: sqrtf(), sinf(), cosf(), floorf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Run jobs sequentially on caller thread if no parallel jobs runner provided
+#ifndef RLSW_PARALLEL_JOBS
+    #define RLSW_PARALLEL_JOBS(job, data, count) for (int swJobIndex = 0; swJobIndex < (count); swJobIndex++) (job)((data), swJobIndex)
+#endif
+
+#define SW_SUBPIXEL_BITS                8       // Vertex position subpixel precision bits, edge functions are fixed-point
+#define SW_SUBPIXEL_SIZE              256       // Subpixel steps per pixel (1 << SW_SUBPIXEL_BITS)
+#define SW_MAX_CLIP_VERTICES           16       // Maximum vertices of a polygon clipped against frustum planes
+#define SW_ATTRIB_COUNT                 8       // Interpolated attributes: depth, 1/w, texcoord (u, v), color (r, g, b, a)
+
+// Clip codes, one bit per frustum plane
+#define SW_CLIP_LEFT                 0x01
+#define SW_CLIP_RIGHT                0x02
+#define SW_CLIP_BOTTOM               0x04
+#define SW_CLIP_TOP                  0x08
+#define SW_CLIP_NEAR                 0x10
+#define SW_CLIP_FAR                  0x20
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Texture data, pixels stored as RGBA 8-bit
+typedef struct swTexture {
+    unsigned char *pixels;          // Texture level 0 pixels (RGBA 8-bit)
+    int width;                      // Texture width
+    int height;                     // Texture height
+    int filter;                     // Texture filter: GL_NEAREST or GL_LINEAR (magnification filter)
+    int wrapS;                      // Texture wrap mode on S coordinate
+    int wrapT;                      // Texture wrap mode on T coordinate
+    int used;                       // Texture id generated and not deleted
+} swTexture;
+
+// Vertex data, position in clip space
+typedef struct swVertex {
+    float position[4];              // Vertex position (clip space)
+    float texcoord[2];              // Vertex texture coordinates
+    float color[4];                 // Vertex color (normalized)
+} swVertex;
+
+// Vertex data, position in window space
+typedef struct swScreenVertex {
+    float x, y, z;                  // Vertex position (pixels), depth [0..1]
+    float invW;                     // Vertex clip space 1/w
+    float texcoord[2];              // Vertex texture coordinates
+    float color[4];                 // Vertex color (normalized)
+} swScreenVertex;
+
+// Raster state, captured for every triangle submitted
+typedef struct swRasterState {
+    unsigned int texture;           // Texture id sampled, 0 if texturing disabled
+    int blend;                      // Blending enabled
+    int srcFactor;                  // Blending source factor
+    int dstFactor;                  // Blending destination factor
+    int depthTest;                  // Depth test enabled
+    int depthWrite;                 // Depth buffer writes enabled
+    int depthFunc;                  // Depth test function
+    unsigned char colorMask[4];     // Color buffer channels writes enabled
+} swRasterState;
+
+// Triangle set up for rasterization
+// NOTE: Edge functions E(x, y) = A*x + B*y + C are evaluated in fixed-point on pixel centers,
+// attributes are interpolated as planes: value = origin + dx*(x - x0) + dy*(y - y0)
+typedef struct swTriangle {
+    long long edges[3][3];          // Edge functions coefficients (A, B, C), subpixel units
+    float planes[SW_ATTRIB_COUNT][3]; // Attributes planes: value at origin, x gradient, y gradient
+    float x0, y0;                   // Attributes planes origin (pixels)
+    int minX, minY;                 // Bounding box min pixel (inclusive)
+    int maxX, maxY;                 // Bounding box max pixel (exclusive)
+    int state;                      // Raster state index
+    int perspective;                // Attributes require perspective correction (divided by w)
+} swTriangle;
+
+// Tile triangles list, triangles indices in submission order
+typedef struct swTile {
+    int *triangles;                 // Triangles indices overlapping tile
+    int count;                      // Triangles count
+    int capacity;                   // Triangles indices capacity
+} swTile;
+
+// Client vertex array
+typedef struct swVertexArray {
+    int enabled;                    // Array enabled (glEnableClientState())
+    int size;                       // Components per vertex
+    int type;                       // Components type: GL_FLOAT or GL_UNSIGNED_BYTE
+    int stride;                     // Bytes between consecutive vertices
+    const unsigned char *pointer;   // Array data
+} swVertexArray;
+
+// Software renderer global state
+typedef struct swContext {
+    struct {
+        unsigned char *color;       // Color buffer (RGBA 8-bit, bottom-up rows)
+        float *depth;               // Depth buffer
+        int width;                  // Framebuffer width
+        int height;                 // Framebuffer height
+    } framebuffer;
+
+    struct {
+        swTile *tiles;              // Framebuffer tiles
+        int tilesX;                 // Tiles per row
+        int tilesY;                 // Tiles per column
+        swTriangle *triangles;      // Triangles pending rasterization
+        int triangleCount;          // Triangles pending rasterization count
+        swRasterState *states;      // Raster states referenced by pending triangles
+        int stateCount;             // Raster states count
+        int stateCapacity;          // Raster states capacity
+        int currentState;           // Current state index in states array, -1 if state changed
+    } batch;
+
+    struct {
+        swRasterState raster;       // Current raster state
+        float clearColor[4];        // Clear color
+        float clearDepth;           // Clear depth
+        int viewport[4];            // Viewport (x, y, width, height)
+        int scissor[4];             // Scissor rectangle (x, y, width, height)
+        int scissorTest;            // Scissor test enabled
+        int cullFace;               // Face culling enabled
+        int cullMode;               // Faces culled: GL_FRONT, GL_BACK or GL_FRONT_AND_BACK
+        int frontFace;              // Front face winding: GL_CCW or GL_CW
+        int polygonMode;            // Polygon rasterization: GL_FILL, GL_LINE or GL_POINT
+        float lineWidth;            // Lines width (pixels)
+        int texture2D;              // Texturing enabled
+        unsigned int boundTexture;  // Texture bound
+    } state;
+
+    struct {
+        float stacks[3][RLSW_MAX_MATRIX_STACK_SIZE][16];    // Matrix stacks: modelview, projection, texture
+        int depths[3];              // Matrix stacks current depth
+        int mode;                   // Current matrix stack index
+        float mvp[16];              // Modelview-projection matrix
+        int mvpDirty;               // Modelview-projection matrix requires update
+    } matrix;
+
+    struct {
+        int mode;                   // Primitive mode, -1 if outside glBegin()/glEnd()
+        swVertex vertices[4];       // Primitive vertices
+        int vertexCount;            // Primitive vertices count
+        float texcoord[2];          // Current texture coordinates
+        float color[4];             // Current color
+    } immediate;
+
+    struct {
+        swVertexArray position;     // Vertex positions array
+        swVertexArray texcoord;     // Vertex texture coordinates array
+        swVertexArray color;        // Vertex colors array
+        swVertex *vertices;         // Transformed vertices (indexed drawing)
+        int vertexCapacity;         // Transformed vertices capacity
+    } arrays;
+
+    swTexture *textures;            // Textures, indexed by id - 1
+    int textureCapacity;            // Textures capacity
+} swContext;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static swContext RLSW = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void swFlush(void);                                                              // Rasterize pending triangles if any
+static void swRasterTile(void *data, int index);                                        // Rasterize tile triangles (parallel job)
+static void swProcessPrimitive(const swVertex *vertices, int count);                    // Process primitive: points (1), lines (2), triangles (3) or quads (4)
+static void swProcessPolygon(const swVertex *vertices, int count);                      // Clip polygon and submit its triangles
+static void swProcessLine(const swVertex *v0, const swVertex *v1);                      // Clip line and submit it as a quad
+static void swProcessPoint(const swVertex *v);                                          // Clip point and submit it as a quad
+static void swSubmitTriangle(const swScreenVertex *v0, const swScreenVertex *v1, const swScreenVertex *v2);  // Set up and bin triangle
+static void swMatrixMultiply(float *result, const float *left, const float *right);    // Multiply matrices (column-major), result = left*right
+static void swUnpackPixels(const unsigned char *src, int count, int format, int type, unsigned char *dst);   // Convert pixels to RGBA 8-bit
+static void swPackPixels(const unsigned char *src, int count, int format, int type, unsigned char *dst);     // Convert RGBA 8-bit pixels to format
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Software renderer management
+//----------------------------------------------------------------------------------
+// Initialize software renderer and framebuffer
+int swInit(int width, int height)
+{
+    memset(&RLSW, 0, sizeof(swContext));
+
+    RLSW.batch.triangles = (swTriangle *)SW_MALLOC(RLSW_MAX_BATCH_TRIANGLES*sizeof(swTriangle));
+    if (RLSW.batch.triangles == NULL) return 0;
+    RLSW.batch.currentState = -1;
+
+    if (!swResize(width, height))
+    {
+        swClose();
+        return 0;
+    }
+
+    // Default OpenGL state
+    RLSW.state.raster.blend = 0;
+    RLSW.state.raster.srcFactor = GL_ONE;
+    RLSW.state.raster.dstFactor = GL_ZERO;
+    RLSW.state.raster.depthWrite = 1;
+    RLSW.state.raster.depthFunc = GL_LESS;
+    for (int i = 0; i < 4; i++) RLSW.state.raster.colorMask[i] = 1;
+
+    RLSW.state.clearDepth = 1.0f;
+    RLSW.state.viewport[2] = width;
+    RLSW.state.viewport[3] = height;
+    RLSW.state.scissor[2] = width;
+    RLSW.state.scissor[3] = height;
+    RLSW.state.cullMode = GL_BACK;
+    RLSW.state.frontFace = GL_CCW;
+    RLSW.state.polygonMode = GL_FILL;
+    RLSW.state.lineWidth = 1.0f;
+
+    for (int i = 0; i < 3; i++)
+    {
+        float *identity = RLSW.matrix.stacks[i][0];
+        for (int k = 0; k < 16; k++) identity[k] = ((k%5) == 0)? 1.0f : 0.0f;
+    }
+    RLSW.matrix.mvpDirty = 1;
+
+    RLSW.immediate.mode = -1;
+    for (int i = 0; i < 4; i++) RLSW.immediate.color[i] = 1.0f;
+
+    return 1;
+}
+
+// Close software renderer, framebuffer and textures are unloaded
+void swClose(void)
+{
+    for (int i = 0; i < RLSW.textureCapacity; i++) SW_FREE(RLSW.textures[i].pixels);
+    SW_FREE(RLSW.textures);
+
+    for (int i = 0; i < RLSW.batch.tilesX*RLSW.batch.tilesY; i++) SW_FREE(RLSW.batch.tiles[i].triangles);
+    SW_FREE(RLSW.batch.tiles);
+    SW_FREE(RLSW.batch.triangles);
+    SW_FREE(RLSW.batch.states);
+
+    SW_FREE(RLSW.arrays.vertices);
+    SW_FREE(RLSW.framebuffer.color);
+    SW_FREE(RLSW.framebuffer.depth);
+
+    memset(&RLSW, 0, sizeof(swContext));
+}
+
+// Resize framebuffer, contents are cleared
+// NOTE: Viewport and scissor are not modified, same as a window resize on OpenGL
+int swResize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return 0;
+
+    swFlush();
+
+    unsigned char *color = (unsigned char *)SW_CALLOC(width*height, 4);
+    float *depth = (float *)SW_MALLOC(width*height*sizeof(float));
+    int tilesX = (width + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+    int tilesY = (height + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+    swTile *tiles = (swTile *)SW_CALLOC(tilesX*tilesY, sizeof(swTile));
+
+    if ((color == NULL) || (depth == NULL) || (tiles == NULL))
+    {
+        SW_FREE(color);
+        SW_FREE(depth);
+        SW_FREE(tiles);
+        return 0;
+    }
+
+    for (int i = 0; i < width*height; i++) depth[i] = 1.0f;
+
+    for (int i = 0; i < RLSW.batch.tilesX*RLSW.batch.tilesY; i++) SW_FREE(RLSW.batch.tiles[i].triangles);
+    SW_FREE(RLSW.batch.tiles);
+    SW_FREE(RLSW.framebuffer.color);
+    SW_FREE(RLSW.framebuffer.depth);
+
+    RLSW.framebuffer.color = color;
+    RLSW.framebuffer.depth = depth;
+    RLSW.framebuffer.width = width;
+    RLSW.framebuffer.height = height;
+    RLSW.batch.tiles = tiles;
+    RLSW.batch.tilesX = tilesX;
+    RLSW.batch.tilesY = tilesY;
+
+    return 1;
+}
+
+// Rasterize all pending primitives into framebuffer
+void swFinish(void)
+{
+    swFlush();
+}
+
+// Get framebuffer color data (RGBA 8-bit, bottom-up rows)
+void *swGetColorBuffer(int *width, int *height)
+{
+    swFlush();
+
+    if (width != NULL) *width = RLSW.framebuffer.width;
+    if (height != NULL) *height = RLSW.framebuffer.height;
+
+    return RLSW.framebuffer.color;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - OpenGL 1.1 state
+//----------------------------------------------------------------------------------
+void swEnable(GLenum cap)
+{
+    switch (cap)
+    {
+        case GL_TEXTURE_2D: RLSW.state.texture2D = 1; break;
+        case GL_BLEND: RLSW.state.raster.blend = 1; break;
+        case GL_DEPTH_TEST: RLSW.state.raster.depthTest = 1; break;
+        case GL_CULL_FACE: RLSW.state.cullFace = 1; break;
+        case GL_SCISSOR_TEST: RLSW.state.scissorTest = 1; break;
+        default: break;
+    }
+
+    RLSW.batch.currentState = -1;
+}
+
+void swDisable(GLenum cap)
+{
+    switch (cap)
+    {
+        case GL_TEXTURE_2D: RLSW.state.texture2D = 0; break;
+        case GL_BLEND: RLSW.state.raster.blend = 0; break;
+        case GL_DEPTH_TEST: RLSW.state.raster.depthTest = 0; break;
+        case GL_CULL_FACE: RLSW.state.cullFace = 0; break;
+        case GL_SCISSOR_TEST: RLSW.state.scissorTest = 0; break;
+        default: break;
+    }
+
+    RLSW.batch.currentState = -1;
+}
+
+void swClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+    RLSW.state.clearColor[0] = red;
+    RLSW.state.clearColor[1] = green;
+    RLSW.state.clearColor[2] = blue;
+    RLSW.state.clearColor[3] = alpha;
+}
+
+void swClearDepth(GLclampd depth)
+{
+    RLSW.state.clearDepth = (float)depth;
+}
+
+// Clear framebuffer, scissor test and color mask are applied
+void swClear(GLbitfield mask)
+{
+    swFlush();
+
+    int minX = 0, minY = 0;
+    int maxX = RLSW.framebuffer.width, maxY = RLSW.framebuffer.height;
+
+    if (RLSW.state.scissorTest)
+    {
+        if (RLSW.state.scissor[0] > minX) minX = RLSW.state.scissor[0];
+        if (RLSW.state.scissor[1] > minY) minY = RLSW.state.scissor[1];
+        if ((RLSW.state.scissor[0] + RLSW.state.scissor[2]) < maxX) maxX = RLSW.state.scissor[0] + RLSW.state.scissor[2];
+        if ((RLSW.state.scissor[1] + RLSW.state.scissor[3]) < maxY) maxY = RLSW.state.scissor[1] + RLSW.state.scissor[3];
+    }
+
+    if ((minX >= maxX) || (minY >= maxY)) return;
+
+    if (mask & GL_COLOR_BUFFER_BIT)
+    {
+        unsigned char color[4] = { 0 };
+        for (int i = 0; i < 4; i++)
+        {
+            float value = RLSW.state.clearColor[i];
+            color[i] = (unsigned char)(((value < 0.0f)? 0.0f : (value > 1.0f)? 1.0f : value)*255.0f + 0.5f);
+        }
+
+        const unsigned char *colorMask = RLSW.state.raster.colorMask;
+
+        for (int y = minY; y < maxY; y++)
+        {
+            unsigned char *pixel = RLSW.framebuffer.color + 4*(y*RLSW.framebuffer.width + minX);
+
+            for (int x = minX; x < maxX; x++, pixel += 4)
+            {
+                for (int i = 0; i < 4; i++) if (colorMask[i]) pixel[i] = color[i];
+            }
+        }
+    }
+
+    if ((mask & GL_DEPTH_BUFFER_BIT) && RLSW.state.raster.depthWrite)
+    {
+        for (int y = minY; y < maxY; y++)
+        {
+            float *depth = RLSW.framebuffer.depth + y*RLSW.framebuffer.width;
+            for (int x = minX; x < maxX; x++) depth[x] = RLSW.state.clearDepth;
+        }
+    }
+}
+
+void swViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RLSW.state.viewport[0] = x;
+    RLSW.state.viewport[1] = y;
+    RLSW.state.viewport[2] = width;
+    RLSW.state.viewport[3] = height;
+}
+
+void swScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RLSW.state.scissor[0] = x;
+    RLSW.state.scissor[1] = y;
+    RLSW.state.scissor[2] = width;
+    RLSW.state.scissor[3] = height;
+}
+
+void swColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    RLSW.state.raster.colorMask[0] = red? 1 : 0;
+    RLSW.state.raster.colorMask[1] = green? 1 : 0;
+    RLSW.state.raster.colorMask[2] = blue? 1 : 0;
+    RLSW.state.raster.colorMask[3] = alpha? 1 : 0;
+    RLSW.batch.currentState = -1;
+}
+
+void swDepthMask(GLboolean flag)
+{
+    RLSW.state.raster.depthWrite = flag? 1 : 0;
+    RLSW.batch.currentState = -1;
+}
+
+void swDepthFunc(GLenum func)
+{
+    RLSW.state.raster.depthFunc = func;
+    RLSW.batch.currentState = -1;
+}
+
+void swBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    RLSW.state.raster.srcFactor = sfactor;
+    RLSW.state.raster.dstFactor = dfactor;
+    RLSW.batch.currentState = -1;
+}
+
+void swCullFace(GLenum mode) { RLSW.state.cullMode = mode; }
+void swFrontFace(GLenum mode) { RLSW.state.frontFace = mode; }
+
+// NOTE: Front and back faces use the same polygon mode
+void swPolygonMode(GLenum face, GLenum mode)
+{
+    (void)face;
+    RLSW.state.polygonMode = mode;
+}
+
+void swLineWidth(GLfloat width) { RLSW.state.lineWidth = (width > 0.0f)? width : 1.0f; }
+
+// NOTE: Attributes are always interpolated perspective correct, smooth shaded
+void swHint(GLenum target, GLenum mode) { (void)target; (void)mode; }
+void swShadeModel(GLenum mode) { (void)mode; }
+
+// NOTE: Pixels data rows are considered tightly packed
+void swPixelStorei(GLenum pname, GLint param) { (void)pname; (void)param; }
+
+void swGetFloatv(GLenum pname, GLfloat *params)
+{
+    switch (pname)
+    {
+        case GL_MODELVIEW_MATRIX: memcpy(params, RLSW.matrix.stacks[0][RLSW.matrix.depths[0]], 16*sizeof(float)); break;
+        case GL_PROJECTION_MATRIX: memcpy(params, RLSW.matrix.stacks[1][RLSW.matrix.depths[1]], 16*sizeof(float)); break;
+        case GL_TEXTURE_MATRIX: memcpy(params, RLSW.matrix.stacks[2][RLSW.matrix.depths[2]], 16*sizeof(float)); break;
+        case GL_LINE_WIDTH: params[0] = RLSW.state.lineWidth; break;
+        default: break;
+    }
+}
+
+const GLubyte *swGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"rlsw " RLSW_VERSION " (software rasterizer)";
+        case GL_VERSION: return (const GLubyte *)"1.1 rlsw " RLSW_VERSION;
+        case GL_EXTENSIONS: return (const GLubyte *)"";
+        default: return NULL;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - OpenGL 1.1 matrix stacks
+//----------------------------------------------------------------------------------
+void swMatrixMode(GLenum mode)
+{
+    switch (mode)
+    {
+        case GL_MODELVIEW: RLSW.matrix.mode = 0; break;
+        case GL_PROJECTION: RLSW.matrix.mode = 1; break;
+        case GL_TEXTURE: RLSW.matrix.mode = 2; break;
+        default: break;
+    }
+}
+
+void swPushMatrix(void)
+{
+    int mode = RLSW.matrix.mode;
+
+    if (RLSW.matrix.depths[mode] < (RLSW_MAX_MATRIX_STACK_SIZE - 1))
+    {
+        memcpy(RLSW.matrix.stacks[mode][RLSW.matrix.depths[mode] + 1], RLSW.matrix.stacks[mode][RLSW.matrix.depths[mode]], 16*sizeof(float));
+        RLSW.matrix.depths[mode]++;
+    }
+}
+
+void swPopMatrix(void)
+{
+    int mode = RLSW.matrix.mode;
+
+    if (RLSW.matrix.depths[mode] > 0)
+    {
+        RLSW.matrix.depths[mode]--;
+        RLSW.matrix.mvpDirty = 1;
+    }
+}
+
+void swLoadIdentity(void)
+{
+    float *current = RLSW.matrix.stacks[RLSW.matrix.mode][RLSW.matrix.depths[RLSW.matrix.mode]];
+
+    for (int k = 0; k < 16; k++) current[k] = ((k%5) == 0)? 1.0f : 0.0f;
+    RLSW.matrix.mvpDirty = 1;
+}
+
+void swMultMatrixf(const GLfloat *m)
+{
+    float *current = RLSW.matrix.stacks[RLSW.matrix.mode][RLSW.matrix.depths[RLSW.matrix.mode]];
+    float result[16] = { 0 };
+
+    swMatrixMultiply(result, current, m);
+    memcpy(current, result, 16*sizeof(float));
+    RLSW.matrix.mvpDirty = 1;
+}
+
+void swTranslatef(GLfloat x, GLfloat y, GLfloat z)
+{
+    float m[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, x, y, z, 1.0f };
+    swMultMatrixf(m);
+}
+
+// NOTE: Angle in degrees, same as OpenGL
+void swRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    float length = sqrtf(x*x + y*y + z*z);
+    if (length == 0.0f) return;
+
+    x /= length;
+    y /= length;
+    z /= length;
+
+    float radians = angle*3.14159265358979323846f/180.0f;
+    float s = sinf(radians);
+    float c = cosf(radians);
+    float t = 1.0f - c;
+
+    float m[16] = {
+        x*x*t + c, y*x*t + z*s, z*x*t - y*s, 0.0f,
+        x*y*t - z*s, y*y*t + c, z*y*t + x*s, 0.0f,
+        x*z*t + y*s, y*z*t - x*s, z*z*t + c, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    swMultMatrixf(m);
+}
+
+void swScalef(GLfloat x, GLfloat y, GLfloat z)
+{
+    float m[16] = { x, 0.0f, 0.0f, 0.0f, 0.0f, y, 0.0f, 0.0f, 0.0f, 0.0f, z, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    swMultMatrixf(m);
+}
+
+void swOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble znear, GLdouble zfar)
+{
+    float m[16] = { 0 };
+
+    m[0] = (float)(2.0/(right - left));
+    m[5] = (float)(2.0/(top - bottom));
+    m[10] = (float)(-2.0/(zfar - znear));
+    m[12] = (float)(-(right + left)/(right - left));
+    m[13] = (float)(-(top + bottom)/(top - bottom));
+    m[14] = (float)(-(zfar + znear)/(zfar - znear));
+    m[15] = 1.0f;
+
+    swMultMatrixf(m);
+}
+
+void swFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble znear, GLdouble zfar)
+{
+    float m[16] = { 0 };
+
+    m[0] = (float)(2.0*znear/(right - left));
+    m[5] = (float)(2.0*znear/(top - bottom));
+    m[8] = (float)((right + left)/(right - left));
+    m[9] = (float)((top + bottom)/(top - bottom));
+    m[10] = (float)(-(zfar + znear)/(zfar - znear));
+    m[11] = -1.0f;
+    m[14] = (float)(-2.0*zfar*znear/(zfar - znear));
+
+    swMultMatrixf(m);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - OpenGL 1.1 immediate mode
+//----------------------------------------------------------------------------------
+// NOTE: Supported modes: GL_POINTS, GL_LINES, GL_TRIANGLES and GL_QUADS
+void swBegin(GLenum mode)
+{
+    RLSW.immediate.mode = mode;
+    RLSW.immediate.vertexCount = 0;
+
+    if (RLSW.matrix.mvpDirty)
+    {
+        swMatrixMultiply(RLSW.matrix.mvp, RLSW.matrix.stacks[1][RLSW.matrix.depths[1]], RLSW.matrix.stacks[0][RLSW.matrix.depths[0]]);
+        RLSW.matrix.mvpDirty = 0;
+    }
+}
+
+void swEnd(void)
+{
+    RLSW.immediate.mode = -1;
+    RLSW.immediate.vertexCount = 0;
+}
+
+void swVertex2i(GLint x, GLint y) { swVertex3f((float)x, (float)y, 0.0f); }
+void swVertex2f(GLfloat x, GLfloat y) { swVertex3f(x, y, 0.0f); }
+
+// Add vertex to current primitive, primitive is processed when complete
+void swVertex3f(GLfloat x, GLfloat y, GLfloat z)
+{
+    int primitiveSize = 0;
+
+    switch (RLSW.immediate.mode)
+    {
+        case GL_POINTS: primitiveSize = 1; break;
+        case GL_LINES: primitiveSize = 2; break;
+        case GL_TRIANGLES: primitiveSize = 3; break;
+        case GL_QUADS: primitiveSize = 4; break;
+        default: return;
+    }
+
+    const float *mvp = RLSW.matrix.mvp;
+    swVertex *vertex = &RLSW.immediate.vertices[RLSW.immediate.vertexCount];
+
+    vertex->position[0] = mvp[0]*x + mvp[4]*y + mvp[8]*z + mvp[12];
+    vertex->position[1] = mvp[1]*x + mvp[5]*y + mvp[9]*z + mvp[13];
+    vertex->position[2] = mvp[2]*x + mvp[6]*y + mvp[10]*z + mvp[14];
+    vertex->position[3] = mvp[3]*x + mvp[7]*y + mvp[11]*z + mvp[15];
+    vertex->texcoord[0] = RLSW.immediate.texcoord[0];
+    vertex->texcoord[1] = RLSW.immediate.texcoord[1];
+    memcpy(vertex->color, RLSW.immediate.color, 4*sizeof(float));
+
+    RLSW.immediate.vertexCount++;
+
+    if (RLSW.immediate.vertexCount == primitiveSize)
+    {
+        swProcessPrimitive(RLSW.immediate.vertices, primitiveSize);
+        RLSW.immediate.vertexCount = 0;
+    }
+}
+
+void swTexCoord2f(GLfloat s, GLfloat t)
+{
+    RLSW.immediate.texcoord[0] = s;
+    RLSW.immediate.texcoord[1] = t;
+}
+
+// NOTE: Normals are not used, no lighting support
+void swNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { (void)nx; (void)ny; (void)nz; }
+
+void swColor3f(GLfloat red, GLfloat green, GLfloat blue) { swColor4f(red, green, blue, 1.0f); }
+
+void swColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    RLSW.immediate.color[0] = red;
+    RLSW.immediate.color[1] = green;
+    RLSW.immediate.color[2] = blue;
+    RLSW.immediate.color[3] = alpha;
+}
+
+void swColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+    swColor4f((float)red/255.0f, (float)green/255.0f, (float)blue/255.0f, (float)alpha/255.0f);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - OpenGL 1.1 vertex arrays
+//----------------------------------------------------------------------------------
+void swEnableClientState(GLenum array)
+{
+    switch (array)
+    {
+        case GL_VERTEX_ARRAY: RLSW.arrays.position.enabled = 1; break;
+        case GL_TEXTURE_COORD_ARRAY: RLSW.arrays.texcoord.enabled = 1; break;
+        case GL_COLOR_ARRAY: RLSW.arrays.color.enabled = 1; break;
+        default: break;
+    }
+}
+
+void swDisableClientState(GLenum array)
+{
+    switch (array)
+    {
+        case GL_VERTEX_ARRAY: RLSW.arrays.position.enabled = 0; break;
+        case GL_TEXTURE_COORD_ARRAY: RLSW.arrays.texcoord.enabled = 0; break;
+        case GL_COLOR_ARRAY: RLSW.arrays.color.enabled = 0; break;
+        default: break;
+    }
+}
+
+// NOTE: Supported vertex positions type: GL_FLOAT
+void swVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    RLSW.arrays.position = (swVertexArray){ RLSW.arrays.position.enabled, size, (int)type, (stride > 0)? stride : size*(int)sizeof(float), (const unsigned char *)pointer };
+}
+
+// NOTE: Supported texture coordinates type: GL_FLOAT
+void swTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    RLSW.arrays.texcoord = (swVertexArray){ RLSW.arrays.texcoord.enabled, size, (int)type, (stride > 0)? stride : size*(int)sizeof(float), (const unsigned char *)pointer };
+}
+
+// NOTE: Normals are not used, no lighting support
+void swNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer) { (void)type; (void)stride; (void)pointer; }
+
+// NOTE: Supported colors types: GL_UNSIGNED_BYTE and GL_FLOAT
+void swColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    int componentSize = (type == GL_FLOAT)? (int)sizeof(float) : 1;
+    RLSW.arrays.color = (swVertexArray){ RLSW.arrays.color.enabled, size, (int)type, (stride > 0)? stride : size*componentSize, (const unsigned char *)pointer };
+}
+
+// Fetch vertex from enabled client arrays and transform it
+static void swFetchVertex(int index, swVertex *vertex)
+{
+    const float *mvp = RLSW.matrix.mvp;
+    float position[3] = { 0 };
+
+    const float *source = (const float *)(RLSW.arrays.position.pointer + index*RLSW.arrays.position.stride);
+    for (int i = 0; (i < RLSW.arrays.position.size) && (i < 3); i++) position[i] = source[i];
+
+    vertex->position[0] = mvp[0]*position[0] + mvp[4]*position[1] + mvp[8]*position[2] + mvp[12];
+    vertex->position[1] = mvp[1]*position[0] + mvp[5]*position[1] + mvp[9]*position[2] + mvp[13];
+    vertex->position[2] = mvp[2]*position[0] + mvp[6]*position[1] + mvp[10]*position[2] + mvp[14];
+    vertex->position[3] = mvp[3]*position[0] + mvp[7]*position[1] + mvp[11]*position[2] + mvp[15];
+
+    if (RLSW.arrays.texcoord.enabled && (RLSW.arrays.texcoord.pointer != NULL))
+    {
+        const float *texcoord = (const float *)(RLSW.arrays.texcoord.pointer + index*RLSW.arrays.texcoord.stride);
+        vertex->texcoord[0] = texcoord[0];
+        vertex->texcoord[1] = texcoord[1];
+    }
+    else
+    {
+        vertex->texcoord[0] = RLSW.immediate.texcoord[0];
+        vertex->texcoord[1] = RLSW.immediate.texcoord[1];
+    }
+
+    if (RLSW.arrays.color.enabled && (RLSW.arrays.color.pointer != NULL))
+    {
+        const unsigned char *color = RLSW.arrays.color.pointer + index*RLSW.arrays.color.stride;
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (i >= RLSW.arrays.color.size) vertex->color[i] = 1.0f;
+            else if (RLSW.arrays.color.type == GL_FLOAT) vertex->color[i] = ((const float *)color)[i];
+            else vertex->color[i] = (float)color[i]/255.0f;
+        }
+    }
+    else memcpy(vertex->color, RLSW.immediate.color, 4*sizeof(float));
+}
+
+void swDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    if (!RLSW.arrays.position.enabled || (RLSW.arrays.position.pointer == NULL) || (RLSW.arrays.position.type != GL_FLOAT)) return;
+
+    int primitiveSize = (mode == GL_POINTS)? 1 : (mode == GL_LINES)? 2 : (mode == GL_TRIANGLES)? 3 : (mode == GL_QUADS)? 4 : 0;
+    if (primitiveSize == 0) return;
+
+    swBegin(mode);
+
+    swVertex primitive[4] = { 0 };
+    for (int i = first; (i + primitiveSize) <= (first + count); i += primitiveSize)
+    {
+        for (int k = 0; k < primitiveSize; k++) swFetchVertex(i + k, &primitive[k]);
+        swProcessPrimitive(primitive, primitiveSize);
+    }
+
+    swEnd();
+}
+
+// NOTE: Referenced vertices are fetched and transformed once, shared by primitives
+void swDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices)
+{
+    if (!RLSW.arrays.position.enabled || (RLSW.arrays.position.pointer == NULL) || (RLSW.arrays.position.type != GL_FLOAT) || (indices == NULL)) return;
+
+    int primitiveSize = (mode == GL_POINTS)? 1 : (mode == GL_LINES)? 2 : (mode == GL_TRIANGLES)? 3 : (mode == GL_QUADS)? 4 : 0;
+    if ((primitiveSize == 0) || (count <= 0)) return;
+
+    int maxIndex = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int index = (type == GL_UNSIGNED_INT)? (int)((const unsigned int *)indices)[i] : (type == GL_UNSIGNED_SHORT)? ((const unsigned short *)indices)[i] : ((const unsigned char *)indices)[i];
+        if (index > maxIndex) maxIndex = index;
+    }
+
+    if ((maxIndex + 1) > RLSW.arrays.vertexCapacity)
+    {
+        swVertex *vertices = (swVertex *)SW_REALLOC(RLSW.arrays.vertices, (maxIndex + 1)*sizeof(swVertex));
+        if (vertices == NULL) return;
+
+        RLSW.arrays.vertices = vertices;
+        RLSW.arrays.vertexCapacity = maxIndex + 1;
+    }
+
+    swBegin(mode);
+    for (int i = 0; i <= maxIndex; i++) swFetchVertex(i, &RLSW.arrays.vertices[i]);
+
+    swVertex primitive[4] = { 0 };
+    for (int i = 0; (i + primitiveSize) <= count; i += primitiveSize)
+    {
+        for (int k = 0; k < primitiveSize; k++)
+        {
+            int index = (type == GL_UNSIGNED_INT)? (int)((const unsigned int *)indices)[i + k] : (type == GL_UNSIGNED_SHORT)? ((const unsigned short *)indices)[i + k] : ((const unsigned char *)indices)[i + k];
+            primitive[k] = RLSW.arrays.vertices[index];
+        }
+
+        swProcessPrimitive(primitive, primitiveSize);
+    }
+    swEnd();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - OpenGL 1.1 textures
+//----------------------------------------------------------------------------------
+void swGenTextures(GLsizei n, GLuint *textures)
+{
+    for (int i = 0; i < n; i++)
+    {
+        textures[i] = 0;
+
+        int id = 0;
+        while ((id < RLSW.textureCapacity) && RLSW.textures[id].used) id++;
+
+        if (id == RLSW.textureCapacity)
+        {
+            int capacity = (RLSW.textureCapacity > 0)? RLSW.textureCapacity*2 : 64;
+            swTexture *textures = (swTexture *)SW_REALLOC(RLSW.textures, capacity*sizeof(swTexture));
+            if (textures == NULL) return;
+
+            memset(textures + RLSW.textureCapacity, 0, (capacity - RLSW.textureCapacity)*sizeof(swTexture));
+            RLSW.textures = textures;
+            RLSW.textureCapacity = capacity;
+        }
+
+        // Default OpenGL texture parameters
+        RLSW.textures[id] = (swTexture){ NULL, 0, 0, GL_LINEAR, GL_REPEAT, GL_REPEAT, 1 };
+        textures[i] = id + 1;
+    }
+}
+
+void swDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    swFlush();
+
+    for (int i = 0; i < n; i++)
+    {
+        unsigned int id = textures[i];
+        if ((id == 0) || ((int)id > RLSW.textureCapacity)) continue;
+
+        SW_FREE(RLSW.textures[id - 1].pixels);
+        memset(&RLSW.textures[id - 1], 0, sizeof(swTexture));
+
+        if (RLSW.state.boundTexture == id) RLSW.state.boundTexture = 0;
+    }
+
+    RLSW.batch.currentState = -1;
+}
+
+void swBindTexture(GLenum target, GLuint texture)
+{
+    if (target != GL_TEXTURE_2D) return;
+
+    RLSW.state.boundTexture = texture;
+    RLSW.batch.currentState = -1;
+}
+
+// Get bound texture, NULL if no valid texture bound
+static swTexture *swGetBoundTexture(void)
+{
+    unsigned int id = RLSW.state.boundTexture;
+    if ((id == 0) || ((int)id > RLSW.textureCapacity) || !RLSW.textures[id - 1].used) return NULL;
+
+    return &RLSW.textures[id - 1];
+}
+
+// NOTE: Only level 0 is stored, mipmap levels are ignored
+void swTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    (void)internalFormat;
+    (void)border;
+
+    swTexture *texture = swGetBoundTexture();
+    if ((target != GL_TEXTURE_2D) || (level != 0) || (texture == NULL) || (width <= 0) || (height <= 0)) return;
+
+    swFlush();
+
+    unsigned char *data = (unsigned char *)SW_CALLOC(width*height, 4);
+    if (data == NULL) return;
+
+    if (pixels != NULL) swUnpackPixels((const unsigned char *)pixels, width*height, format, type, data);
+
+    SW_FREE(texture->pixels);
+    texture->pixels = data;
+    texture->width = width;
+    texture->height = height;
+}
+
+void swTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    swTexture *texture = swGetBoundTexture();
+    if ((target != GL_TEXTURE_2D) || (level != 0) || (texture == NULL) || (texture->pixels == NULL) || (pixels == NULL)) return;
+    if ((xoffset < 0) || (yoffset < 0) || ((xoffset + width) > texture->width) || ((yoffset + height) > texture->height)) return;
+
+    swFlush();
+
+    int bytesPerPixel = 4;
+    if ((type == GL_UNSIGNED_SHORT_5_6_5) || (type == GL_UNSIGNED_SHORT_5_5_5_1) || (type == GL_UNSIGNED_SHORT_4_4_4_4)) bytesPerPixel = 2;
+    else if (format == GL_RGB) bytesPerPixel = 3;
+    else if (format == GL_LUMINANCE_ALPHA) bytesPerPixel = 2;
+    else if ((format == GL_LUMINANCE) || (format == GL_ALPHA)) bytesPerPixel = 1;
+
+    for (int y = 0; y < height; y++)
+    {
+        swUnpackPixels((const unsigned char *)pixels + y*width*bytesPerPixel, width, format, type, texture->pixels + 4*((yoffset + y)*texture->width + xoffset));
+    }
+}
+
+// NOTE: Texture minification filter is not used, no mipmaps available
+void swTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    swTexture *texture = swGetBoundTexture();
+    if ((target != GL_TEXTURE_2D) || (texture == NULL)) return;
+
+    swFlush();
+
+    switch (pname)
+    {
+        case GL_TEXTURE_MAG_FILTER: texture->filter = param; break;
+        case GL_TEXTURE_WRAP_S: texture->wrapS = param; break;
+        case GL_TEXTURE_WRAP_T: texture->wrapT = param; break;
+        default: break;
+    }
+}
+
+void swGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels)
+{
+    swTexture *texture = swGetBoundTexture();
+    if ((target != GL_TEXTURE_2D) || (level != 0) || (texture == NULL) || (texture->pixels == NULL) || (pixels == NULL)) return;
+
+    swPackPixels(texture->pixels, texture->width*texture->height, format, type, (unsigned char *)pixels);
+}
+
+// NOTE: Pixels rows are returned bottom-up, same as OpenGL
+void swReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels)
+{
+    if ((pixels == NULL) || (x < 0) || (y < 0) || ((x + width) > RLSW.framebuffer.width) || ((y + height) > RLSW.framebuffer.height)) return;
+
+    swFlush();
+
+    int bytesPerPixel = (format == GL_RGB)? 3 : 4;
+
+    for (int row = 0; row < height; row++)
+    {
+        swPackPixels(RLSW.framebuffer.color + 4*((y + row)*RLSW.framebuffer.width + x), width, format, type, (unsigned char *)pixels + row*width*bytesPerPixel);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Geometry processing
+//----------------------------------------------------------------------------------
+// Multiply matrices (column-major), result = left*right
+static void swMatrixMultiply(float *result, const float *left, const float *right)
+{
+    for (int c = 0; c < 4; c++)
+    {
+        for (int r = 0; r < 4; r++)
+        {
+            result[c*4 + r] = left[r]*right[c*4] + left[4 + r]*right[c*4 + 1] + left[8 + r]*right[c*4 + 2] + left[12 + r]*right[c*4 + 3];
+        }
+    }
+}
+
+// Get vertex clip codes, bit set for every frustum plane vertex is outside of
+static inline int swClipCode(const swVertex *v)
+{
+    const float *p = v->position;
+    int code = 0;
+
+    if (p[0] < -p[3]) code |= SW_CLIP_LEFT;
+    if (p[0] > p[3]) code |= SW_CLIP_RIGHT;
+    if (p[1] < -p[3]) code |= SW_CLIP_BOTTOM;
+    if (p[1] > p[3]) code |= SW_CLIP_TOP;
+    if (p[2] < -p[3]) code |= SW_CLIP_NEAR;
+    if (p[2] > p[3]) code |= SW_CLIP_FAR;
+
+    return code;
+}
+
+// Get vertex signed distance to frustum plane, positive inside
+static inline float swClipDistance(const swVertex *v, int plane)
+{
+    const float *p = v->position;
+
+    switch (plane)
+    {
+        case SW_CLIP_LEFT: return p[3] + p[0];
+        case SW_CLIP_RIGHT: return p[3] - p[0];
+        case SW_CLIP_BOTTOM: return p[3] + p[1];
+        case SW_CLIP_TOP: return p[3] - p[1];
+        case SW_CLIP_NEAR: return p[3] + p[2];
+        case SW_CLIP_FAR: return p[3] - p[2];
+        default: return 0.0f;
+    }
+}
+
+// Interpolate vertices attributes
+static inline void swLerpVertex(swVertex *result, const swVertex *v0, const swVertex *v1, float t)
+{
+    for (int i = 0; i < 4; i++) result->position[i] = v0->position[i] + (v1->position[i] - v0->position[i])*t;
+    for (int i = 0; i < 2; i++) result->texcoord[i] = v0->texcoord[i] + (v1->texcoord[i] - v0->texcoord[i])*t;
+    for (int i = 0; i < 4; i++) result->color[i] = v0->color[i] + (v1->color[i] - v0->color[i])*t;
+}
+
+// Clip polygon against frustum planes (Sutherland-Hodgman), returns resulting vertices count
+static int swClipPolygon(swVertex *vertices, int count, int planes)
+{
+    swVertex temp[SW_MAX_CLIP_VERTICES] = { 0 };
+
+    for (int plane = SW_CLIP_LEFT; plane <= SW_CLIP_FAR; plane <<= 1)
+    {
+        if (!(planes & plane)) continue;
+
+        int resultCount = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            const swVertex *current = &vertices[i];
+            const swVertex *next = &vertices[(i + 1)%count];
+            float currentDistance = swClipDistance(current, plane);
+            float nextDistance = swClipDistance(next, plane);
+
+            if (currentDistance >= 0.0f) temp[resultCount++] = *current;
+            if ((currentDistance >= 0.0f) != (nextDistance >= 0.0f))
+            {
+                swLerpVertex(&temp[resultCount++], current, next, currentDistance/(currentDistance - nextDistance));
+            }
+        }
+
+        count = resultCount;
+        if (count < 3) return 0;
+
+        memcpy(vertices, temp, count*sizeof(swVertex));
+    }
+
+    return count;
+}
+
+// Project vertex from clip space to window space
+static inline void swProjectVertex(const swVertex *v, swScreenVertex *result)
+{
+    const int *viewport = RLSW.state.viewport;
+    float invW = 1.0f/v->position[3];
+
+    result->x = (float)viewport[0] + (v->position[0]*invW + 1.0f)*0.5f*(float)viewport[2];
+    result->y = (float)viewport[1] + (v->position[1]*invW + 1.0f)*0.5f*(float)viewport[3];
+    result->z = (v->position[2]*invW + 1.0f)*0.5f;
+    result->invW = invW;
+    result->texcoord[0] = v->texcoord[0];
+    result->texcoord[1] = v->texcoord[1];
+    memcpy(result->color, v->color, 4*sizeof(float));
+}
+
+// Process primitive: points (1), lines (2), triangles (3) or quads (4)
+static void swProcessPrimitive(const swVertex *vertices, int count)
+{
+    switch (count)
+    {
+        case 1: swProcessPoint(&vertices[0]); break;
+        case 2: swProcessLine(&vertices[0], &vertices[1]); break;
+        default:
+        {
+            // Face culling, facing computed from homogeneous coordinates (x, y, w), valid before clipping
+            // NOTE: Quads facing is defined by its first three vertices
+            if (RLSW.state.cullFace)
+            {
+                const float *p0 = vertices[0].position;
+                const float *p1 = vertices[1].position;
+                const float *p2 = vertices[2].position;
+
+                float det = p0[0]*(p1[1]*p2[3] - p2[1]*p1[3]) - p1[0]*(p0[1]*p2[3] - p2[1]*p0[3]) + p2[0]*(p0[1]*p1[3] - p1[1]*p0[3]);
+                int front = (RLSW.state.frontFace == GL_CCW)? (det > 0.0f) : (det < 0.0f);
+
+                if (RLSW.state.cullMode == GL_FRONT_AND_BACK) return;
+                if (front && (RLSW.state.cullMode == GL_FRONT)) return;
+                if (!front && (RLSW.state.cullMode == GL_BACK)) return;
+            }
+
+            if (RLSW.state.polygonMode == GL_LINE)
+            {
+                for (int i = 0; i < count; i++) swProcessLine(&vertices[i], &vertices[(i + 1)%count]);
+            }
+            else if (RLSW.state.polygonMode == GL_POINT)
+            {
+                for (int i = 0; i < count; i++) swProcessPoint(&vertices[i]);
+            }
+            else swProcessPolygon(vertices, count);
+
+        } break;
+    }
+}
+
+// Clip polygon and submit its triangles, polygon is triangulated as a fan
+static void swProcessPolygon(const swVertex *vertices, int count)
+{
+    int codeAnd = 0x3f;
+    int codeOr = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int code = swClipCode(&vertices[i]);
+        codeAnd &= code;
+        codeOr |= code;
+    }
+
+    // Polygon completely outside one of the frustum planes
+    if (codeAnd != 0) return;
+
+    swScreenVertex screen[SW_MAX_CLIP_VERTICES] = { 0 };
+
+    if (codeOr == 0)
+    {
+        for (int i = 0; i < count; i++) swProjectVertex(&vertices[i], &screen[i]);
+    }
+    else
+    {
+        swVertex clipped[SW_MAX_CLIP_VERTICES] = { 0 };
+        memcpy(clipped, vertices, count*sizeof(swVertex));
+
+        count = swClipPolygon(clipped, count, codeOr);
+        for (int i = 0; i < count; i++) swProjectVertex(&clipped[i], &screen[i]);
+    }
+
+    for (int i = 1; i < (count - 1); i++) swSubmitTriangle(&screen[0], &screen[i], &screen[i + 1]);
+}
+
+// Clip line and submit it as a quad, line width expanded in window space
+static void swProcessLine(const swVertex *v0, const swVertex *v1)
+{
+    int code0 = swClipCode(v0);
+    int code1 = swClipCode(v1);
+
+    if ((code0 & code1) != 0) return;
+
+    swVertex clipped[2] = { *v0, *v1 };
+
+    // Clip line against frustum planes (Liang-Barsky)
+    if ((code0 | code1) != 0)
+    {
+        float t0 = 0.0f, t1 = 1.0f;
+
+        for (int plane = SW_CLIP_LEFT; plane <= SW_CLIP_FAR; plane <<= 1)
+        {
+            float d0 = swClipDistance(v0, plane);
+            float d1 = swClipDistance(v1, plane);
+
+            if ((d0 < 0.0f) && (d1 < 0.0f)) return;
+            if (d0 < 0.0f) { float t = d0/(d0 - d1); if (t > t0) t0 = t; }
+            else if (d1 < 0.0f) { float t = d0/(d0 - d1); if (t < t1) t1 = t; }
+        }
+
+        if (t0 > t1) return;
+
+        swLerpVertex(&clipped[0], v0, v1, t0);
+        swLerpVertex(&clipped[1], v0, v1, t1);
+    }
+
+    swScreenVertex p0 = { 0 }, p1 = { 0 };
+    swProjectVertex(&clipped[0], &p0);
+    swProjectVertex(&clipped[1], &p1);
+
+    float dx = p1.x - p0.x;
+    float dy = p1.y - p0.y;
+    float length = sqrtf(dx*dx + dy*dy);
+    if (length == 0.0f) return;
+
+    float nx = -dy/length*RLSW.state.lineWidth*0.5f;
+    float ny = dx/length*RLSW.state.lineWidth*0.5f;
+
+    swScreenVertex quad[4] = { p0, p0, p1, p1 };
+    quad[0].x += nx; quad[0].y += ny;
+    quad[1].x -= nx; quad[1].y -= ny;
+    quad[2].x -= nx; quad[2].y -= ny;
+    quad[3].x += nx; quad[3].y += ny;
+
+    swSubmitTriangle(&quad[0], &quad[1], &quad[2]);
+    swSubmitTriangle(&quad[0], &quad[2], &quad[3]);
+}
+
+// Clip point and submit it as a one pixel quad
+static void swProcessPoint(const swVertex *v)
+{
+    if (swClipCode(v) != 0) return;
+
+    swScreenVertex p = { 0 };
+    swProjectVertex(v, &p);
+
+    swScreenVertex quad[4] = { p, p, p, p };
+    quad[0].x -= 0.5f; quad[0].y -= 0.5f;
+    quad[1].x += 0.5f; quad[1].y -= 0.5f;
+    quad[2].x += 0.5f; quad[2].y += 0.5f;
+    quad[3].x -= 0.5f; quad[3].y += 0.5f;
+
+    swSubmitTriangle(&quad[0], &quad[1], &quad[2]);
+    swSubmitTriangle(&quad[0], &quad[2], &quad[3]);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Triangle setup and binning
+//----------------------------------------------------------------------------------
+// Get current raster state index, state is added to batch states if changed
+static int swGetRasterState(void)
+{
+    if (RLSW.batch.currentState >= 0) return RLSW.batch.currentState;
+
+    swRasterState state = RLSW.state.raster;
+    swTexture *texture = swGetBoundTexture();
+    state.texture = (RLSW.state.texture2D && (texture != NULL) && (texture->pixels != NULL))? RLSW.state.boundTexture : 0;
+
+    if ((RLSW.batch.stateCount > 0) && (memcmp(&RLSW.batch.states[RLSW.batch.stateCount - 1], &state, sizeof(swRasterState)) == 0))
+    {
+        RLSW.batch.currentState = RLSW.batch.stateCount - 1;
+        return RLSW.batch.currentState;
+    }
+
+    if (RLSW.batch.stateCount == RLSW.batch.stateCapacity)
+    {
+        int capacity = (RLSW.batch.stateCapacity > 0)? RLSW.batch.stateCapacity*2 : 64;
+        swRasterState *states = (swRasterState *)SW_REALLOC(RLSW.batch.states, capacity*sizeof(swRasterState));
+        if (states == NULL) return -1;
+
+        RLSW.batch.states = states;
+        RLSW.batch.stateCapacity = capacity;
+    }
+
+    RLSW.batch.states[RLSW.batch.stateCount] = state;
+    RLSW.batch.currentState = RLSW.batch.stateCount++;
+
+    return RLSW.batch.currentState;
+}
+
+// Set up triangle edge functions and attributes planes, triangle is binned into tiles it overlaps
+// NOTE: Triangle is rasterized counter-clockwise, facing has been already resolved
+static void swSubmitTriangle(const swScreenVertex *v0, const swScreenVertex *v1, const swScreenVertex *v2)
+{
+    // Snap vertices positions to subpixel grid
+    long long x[3] = { (long long)floorf(v0->x*SW_SUBPIXEL_SIZE + 0.5f), (long long)floorf(v1->x*SW_SUBPIXEL_SIZE + 0.5f), (long long)floorf(v2->x*SW_SUBPIXEL_SIZE + 0.5f) };
+    long long y[3] = { (long long)floorf(v0->y*SW_SUBPIXEL_SIZE + 0.5f), (long long)floorf(v1->y*SW_SUBPIXEL_SIZE + 0.5f), (long long)floorf(v2->y*SW_SUBPIXEL_SIZE + 0.5f) };
+
+    long long area = (x[1] - x[0])*(y[2] - y[0]) - (x[2] - x[0])*(y[1] - y[0]);
+    if (area == 0) return;
+
+    const swScreenVertex *v[3] = { v0, v1, v2 };
+
+    if (area < 0)
+    {
+        long long tx = x[1]; x[1] = x[2]; x[2] = tx;
+        long long ty = y[1]; y[1] = y[2]; y[2] = ty;
+        v[1] = v2;
+        v[2] = v1;
+        area = -area;
+    }
+
+    // Bounding box covering pixels centers inside triangle, clamped to framebuffer and scissor
+    long long minX = x[0], maxX = x[0], minY = y[0], maxY = y[0];
+    for (int i = 1; i < 3; i++)
+    {
+        if (x[i] < minX) minX = x[i];
+        if (x[i] > maxX) maxX = x[i];
+        if (y[i] < minY) minY = y[i];
+        if (y[i] > maxY) maxY = y[i];
+    }
+
+    int bounds[4] = { 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height };
+    if (RLSW.state.scissorTest)
+    {
+        if (RLSW.state.scissor[0] > bounds[0]) bounds[0] = RLSW.state.scissor[0];
+        if (RLSW.state.scissor[1] > bounds[1]) bounds[1] = RLSW.state.scissor[1];
+        if ((RLSW.state.scissor[0] + RLSW.state.scissor[2]) < bounds[2]) bounds[2] = RLSW.state.scissor[0] + RLSW.state.scissor[2];
+        if ((RLSW.state.scissor[1] + RLSW.state.scissor[3]) < bounds[3]) bounds[3] = RLSW.state.scissor[1] + RLSW.state.scissor[3];
+    }
+
+    const long long half = SW_SUBPIXEL_SIZE/2;
+    long long bminX = (minX - half + SW_SUBPIXEL_SIZE - 1) >> SW_SUBPIXEL_BITS;
+    long long bminY = (minY - half + SW_SUBPIXEL_SIZE - 1) >> SW_SUBPIXEL_BITS;
+    long long bmaxX = ((maxX - half) >> SW_SUBPIXEL_BITS) + 1;
+    long long bmaxY = ((maxY - half) >> SW_SUBPIXEL_BITS) + 1;
+
+    if (bminX < bounds[0]) bminX = bounds[0];
+    if (bminY < bounds[1]) bminY = bounds[1];
+    if (bmaxX > bounds[2]) bmaxX = bounds[2];
+    if (bmaxY > bounds[3]) bmaxY = bounds[3];
+
+    if ((bminX >= bmaxX) || (bminY >= bmaxY)) return;
+
+    if (RLSW.batch.triangleCount == RLSW_MAX_BATCH_TRIANGLES) swFlush();
+
+    int state = swGetRasterState();
+    if (state < 0) return;
+
+    swTriangle *triangle = &RLSW.batch.triangles[RLSW.batch.triangleCount];
+
+    // Edge functions, E(x, y) = A*x + B*y + C, positive inside
+    // NOTE: Top-left fill rule, pixels on right and bottom edges are not covered
+    for (int i = 0; i < 3; i++)
+    {
+        int a = i;
+        int b = (i + 1)%3;
+
+        long long A = -(y[b] - y[a]);
+        long long B = x[b] - x[a];
+        long long C = -A*x[a] - B*y[a];
+
+        int topLeft = (y[b] < y[a]) || ((y[b] == y[a]) && (x[b] < x[a]));
+        if (!topLeft) C -= 1;
+
+        triangle->edges[i][0] = A;
+        triangle->edges[i][1] = B;
+        triangle->edges[i][2] = C;
+    }
+
+    // Attributes planes, computed from snapped positions
+    float fx[3], fy[3];
+    for (int i = 0; i < 3; i++)
+    {
+        fx[i] = (float)x[i]/SW_SUBPIXEL_SIZE;
+        fy[i] = (float)y[i]/SW_SUBPIXEL_SIZE;
+    }
+
+    // NOTE: Perspective correction is not required if all vertices have the same w (i.e. 2d drawing)
+    int perspective = (v[0]->invW != v[1]->invW) || (v[0]->invW != v[2]->invW);
+    float values[3][SW_ATTRIB_COUNT] = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        float w = perspective? v[i]->invW : 1.0f;
+
+        values[i][0] = v[i]->z;
+        values[i][1] = v[i]->invW;
+        values[i][2] = v[i]->texcoord[0]*w;
+        values[i][3] = v[i]->texcoord[1]*w;
+        for (int k = 0; k < 4; k++) values[i][4 + k] = v[i]->color[k]*w;
+    }
+
+    float d1x = fx[1] - fx[0], d1y = fy[1] - fy[0];
+    float d2x = fx[2] - fx[0], d2y = fy[2] - fy[0];
+    float invArea = 1.0f/(d1x*d2y - d2x*d1y);
+
+    for (int k = 0; k < SW_ATTRIB_COUNT; k++)
+    {
+        float da1 = values[1][k] - values[0][k];
+        float da2 = values[2][k] - values[0][k];
+
+        triangle->planes[k][0] = values[0][k];
+        triangle->planes[k][1] = (da1*d2y - da2*d1y)*invArea;
+        triangle->planes[k][2] = (da2*d1x - da1*d2x)*invArea;
+    }
+
+    triangle->x0 = fx[0];
+    triangle->y0 = fy[0];
+    triangle->minX = (int)bminX;
+    triangle->minY = (int)bminY;
+    triangle->maxX = (int)bmaxX;
+    triangle->maxY = (int)bmaxY;
+    triangle->state = state;
+    triangle->perspective = perspective;
+
+    // Bin triangle into tiles
+    int index = RLSW.batch.triangleCount++;
+
+    for (int ty = triangle->minY/RLSW_TILE_SIZE; ty <= (triangle->maxY - 1)/RLSW_TILE_SIZE; ty++)
+    {
+        for (int tx = triangle->minX/RLSW_TILE_SIZE; tx <= (triangle->maxX - 1)/RLSW_TILE_SIZE; tx++)
+        {
+            swTile *tile = &RLSW.batch.tiles[ty*RLSW.batch.tilesX + tx];
+
+            if (tile->count == tile->capacity)
+            {
+                int capacity = (tile->capacity > 0)? tile->capacity*2 : 256;
+                int *triangles = (int *)SW_REALLOC(tile->triangles, capacity*sizeof(int));
+                if (triangles == NULL) continue;
+
+                tile->triangles = triangles;
+                tile->capacity = capacity;
+            }
+
+            tile->triangles[tile->count++] = index;
+        }
+    }
+}
+
+// Rasterize pending triangles if any
+static void swFlush(void)
+{
+    if (RLSW.batch.triangleCount == 0) return;
+
+    RLSW_PARALLEL_JOBS(swRasterTile, NULL, RLSW.batch.tilesX*RLSW.batch.tilesY);
+
+    for (int i = 0; i < RLSW.batch.tilesX*RLSW.batch.tilesY; i++) RLSW.batch.tiles[i].count = 0;
+
+    RLSW.batch.triangleCount = 0;
+    RLSW.batch.stateCount = 0;
+    RLSW.batch.currentState = -1;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Rasterization
+//----------------------------------------------------------------------------------
+// Get texture coordinate wrapped
+static inline int swWrapCoord(int coord, int size, int wrap)
+{
+    switch (wrap)
+    {
+        case GL_REPEAT:
+        {
+            coord %= size;
+            if (coord < 0) coord += size;
+        } break;
+        case GL_MIRRORED_REPEAT:
+        {
+            coord %= 2*size;
+            if (coord < 0) coord += 2*size;
+            if (coord >= size) coord = 2*size - 1 - coord;
+        } break;
+        default:
+        {
+            if (coord < 0) coord = 0;
+            else if (coord >= size) coord = size - 1;
+        } break;
+    }
+
+    return coord;
+}
+
+// Sample texture color at texture coordinates, color is multiplied by sampled texel
+static inline void swSampleTexture(const swTexture *texture, float u, float v, float *color)
+{
+    const unsigned char *pixels = texture->pixels;
+    int width = texture->width;
+    int height = texture->height;
+
+    // NOTE: Texture coordinates are clamped to avoid integer overflow on wrapping
+    float fu = u*width;
+    float fv = v*height;
+    if (fu < -1e6f) fu = -1e6f; else if (fu > 1e6f) fu = 1e6f;
+    if (fv < -1e6f) fv = -1e6f; else if (fv > 1e6f) fv = 1e6f;
+
+    if (texture->filter == GL_NEAREST)
+    {
+        int x = swWrapCoord((int)floorf(fu), width, texture->wrapS);
+        int y = swWrapCoord((int)floorf(fv), height, texture->wrapT);
+        const unsigned char *texel = pixels + 4*(y*width + x);
+
+        for (int i = 0; i < 4; i++) color[i] *= (float)texel[i]*(1.0f/255.0f);
+    }
+    else
+    {
+        fu -= 0.5f;
+        fv -= 0.5f;
+
+        float x0f = floorf(fu);
+        float y0f = floorf(fv);
+        float tx = fu - x0f;
+        float ty = fv - y0f;
+
+        int x0 = swWrapCoord((int)x0f, width, texture->wrapS);
+        int x1 = swWrapCoord((int)x0f + 1, width, texture->wrapS);
+        int y0 = swWrapCoord((int)y0f, height, texture->wrapT);
+        int y1 = swWrapCoord((int)y0f + 1, height, texture->wrapT);
+
+        const unsigned char *t00 = pixels + 4*(y0*width + x0);
+        const unsigned char *t10 = pixels + 4*(y0*width + x1);
+        const unsigned char *t01 = pixels + 4*(y1*width + x0);
+        const unsigned char *t11 = pixels + 4*(y1*width + x1);
+
+        for (int i = 0; i < 4; i++)
+        {
+            float top = t00[i] + (t10[i] - t00[i])*tx;
+            float bottom = t01[i] + (t11[i] - t01[i])*tx;
+            color[i] *= (top + (bottom - top)*ty)*(1.0f/255.0f);
+        }
+    }
+}
+
+// Get blending factor for every color channel
+static inline void swBlendFactor(int factor, const float *src, const float *dst, float *result)
+{
+    switch (factor)
+    {
+        case GL_ZERO: for (int i = 0; i < 4; i++) result[i] = 0.0f; break;
+        case GL_ONE: for (int i = 0; i < 4; i++) result[i] = 1.0f; break;
+        case GL_SRC_COLOR: for (int i = 0; i < 4; i++) result[i] = src[i]; break;
+        case GL_ONE_MINUS_SRC_COLOR: for (int i = 0; i < 4; i++) result[i] = 1.0f - src[i]; break;
+        case GL_SRC_ALPHA: for (int i = 0; i < 4; i++) result[i] = src[3]; break;
+        case GL_ONE_MINUS_SRC_ALPHA: for (int i = 0; i < 4; i++) result[i] = 1.0f - src[3]; break;
+        case GL_DST_ALPHA: for (int i = 0; i < 4; i++) result[i] = dst[3]; break;
+        case GL_ONE_MINUS_DST_ALPHA: for (int i = 0; i < 4; i++) result[i] = 1.0f - dst[3]; break;
+        case GL_DST_COLOR: for (int i = 0; i < 4; i++) result[i] = dst[i]; break;
+        case GL_ONE_MINUS_DST_COLOR: for (int i = 0; i < 4; i++) result[i] = 1.0f - dst[i]; break;
+        case GL_SRC_ALPHA_SATURATE:
+        {
+            float f = (src[3] < (1.0f - dst[3]))? src[3] : (1.0f - dst[3]);
+            for (int i = 0; i < 3; i++) result[i] = f;
+            result[3] = 1.0f;
+        } break;
+        default: for (int i = 0; i < 4; i++) result[i] = 1.0f; break;
+    }
+}
+
+// Check depth test function
+static inline int swDepthTest(int func, float depth, float stored)
+{
+    switch (func)
+    {
+        case GL_NEVER: return 0;
+        case GL_LESS: return (depth < stored);
+        case GL_EQUAL: return (depth == stored);
+        case GL_LEQUAL: return (depth <= stored);
+        case GL_GREATER: return (depth > stored);
+        case GL_NOTEQUAL: return (depth != stored);
+        case GL_GEQUAL: return (depth >= stored);
+        default: return 1;
+    }
+}
+
+// Rasterize triangle pixels inside tile rectangle
+static void swRasterTriangle(const swTriangle *triangle, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY)
+{
+    int minX = (triangle->minX > tileMinX)? triangle->minX : tileMinX;
+    int minY = (triangle->minY > tileMinY)? triangle->minY : tileMinY;
+    int maxX = (triangle->maxX < tileMaxX)? triangle->maxX : tileMaxX;
+    int maxY = (triangle->maxY < tileMaxY)? triangle->maxY : tileMaxY;
+
+    if ((minX >= maxX) || (minY >= maxY)) return;
+
+    const swRasterState *state = &RLSW.batch.states[triangle->state];
+    const swTexture *texture = (state->texture != 0)? &RLSW.textures[state->texture - 1] : NULL;
+    const int fullMask = state->colorMask[0] && state->colorMask[1] && state->colorMask[2] && state->colorMask[3];
+    const int width = RLSW.framebuffer.width;
+
+    const long long (*edges)[3] = triangle->edges;
+    const float (*planes)[3] = triangle->planes;
+
+    for (int y = minY; y < maxY; y++)
+    {
+        // Edge functions and attributes values at row first pixel center
+        long long px = (long long)minX*SW_SUBPIXEL_SIZE + SW_SUBPIXEL_SIZE/2;
+        long long py = (long long)y*SW_SUBPIXEL_SIZE + SW_SUBPIXEL_SIZE/2;
+
+        long long e0 = edges[0][0]*px + edges[0][1]*py + edges[0][2];
+        long long e1 = edges[1][0]*px + edges[1][1]*py + edges[1][2];
+        long long e2 = edges[2][0]*px + edges[2][1]*py + edges[2][2];
+
+        const long long step0 = edges[0][0]*SW_SUBPIXEL_SIZE;
+        const long long step1 = edges[1][0]*SW_SUBPIXEL_SIZE;
+        const long long step2 = edges[2][0]*SW_SUBPIXEL_SIZE;
+
+        float dx = (float)minX + 0.5f - triangle->x0;
+        float dy = (float)y + 0.5f - triangle->y0;
+
+        float attribs[SW_ATTRIB_COUNT];
+        for (int k = 0; k < SW_ATTRIB_COUNT; k++) attribs[k] = planes[k][0] + planes[k][1]*dx + planes[k][2]*dy;
+
+        unsigned char *pixel = RLSW.framebuffer.color + 4*(y*width + minX);
+        float *depth = RLSW.framebuffer.depth + y*width + minX;
+
+        for (int x = minX; x < maxX; x++, pixel += 4, depth++)
+        {
+            if ((e0 | e1 | e2) >= 0)
+            {
+                float z = attribs[0];
+
+                if (!state->depthTest || swDepthTest(state->depthFunc, z, *depth))
+                {
+                    if (state->depthTest && state->depthWrite) *depth = z;
+
+                    float w = triangle->perspective? 1.0f/attribs[1] : 1.0f;
+                    float color[4] = { attribs[4]*w, attribs[5]*w, attribs[6]*w, attribs[7]*w };
+
+                    if (texture != NULL) swSampleTexture(texture, attribs[2]*w, attribs[3]*w, color);
+
+                    for (int i = 0; i < 4; i++) color[i] = (color[i] < 0.0f)? 0.0f : (color[i] > 1.0f)? 1.0f : color[i];
+
+                    if (state->blend)
+                    {
+                        float dst[4] = { pixel[0]/255.0f, pixel[1]/255.0f, pixel[2]/255.0f, pixel[3]/255.0f };
+                        float srcFactor[4], dstFactor[4];
+
+                        swBlendFactor(state->srcFactor, color, dst, srcFactor);
+                        swBlendFactor(state->dstFactor, color, dst, dstFactor);
+
+                        for (int i = 0; i < 4; i++)
+                        {
+                            float value = color[i]*srcFactor[i] + dst[i]*dstFactor[i];
+                            color[i] = (value > 1.0f)? 1.0f : value;
+                        }
+                    }
+
+                    if (fullMask)
+                    {
+                        for (int i = 0; i < 4; i++) pixel[i] = (unsigned char)(color[i]*255.0f + 0.5f);
+                    }
+                    else
+                    {
+                        for (int i = 0; i < 4; i++) if (state->colorMask[i]) pixel[i] = (unsigned char)(color[i]*255.0f + 0.5f);
+                    }
+                }
+            }
+
+            e0 += step0;
+            e1 += step1;
+            e2 += step2;
+            for (int k = 0; k < SW_ATTRIB_COUNT; k++) attribs[k] += planes[k][1];
+        }
+    }
+}
+
+// Rasterize tile triangles in submission order (parallel job)
+static void swRasterTile(void *data, int index)
+{
+    (void)data;
+
+    const swTile *tile = &RLSW.batch.tiles[index];
+    if (tile->count == 0) return;
+
+    int minX = (index%RLSW.batch.tilesX)*RLSW_TILE_SIZE;
+    int minY = (index/RLSW.batch.tilesX)*RLSW_TILE_SIZE;
+    int maxX = (minX + RLSW_TILE_SIZE < RLSW.framebuffer.width)? minX + RLSW_TILE_SIZE : RLSW.framebuffer.width;
+    int maxY = (minY + RLSW_TILE_SIZE < RLSW.framebuffer.height)? minY + RLSW_TILE_SIZE : RLSW.framebuffer.height;
+
+    for (int i = 0; i < tile->count; i++) swRasterTriangle(&RLSW.batch.triangles[tile->triangles[i]], minX, minY, maxX, maxY);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Pixel formats conversion
+//----------------------------------------------------------------------------------
+// Convert pixels to RGBA 8-bit
+static void swUnpackPixels(const unsigned char *src, int count, int format, int type, unsigned char *dst)
+{
+    for (int i = 0; i < count; i++, dst += 4)
+    {
+        if (type == GL_UNSIGNED_SHORT_5_6_5)
+        {
+            unsigned short pixel = ((const unsigned short *)src)[i];
+            dst[0] = (unsigned char)(((pixel >> 11) & 0x1f)*255/31);
+            dst[1] = (unsigned char)(((pixel >> 5) & 0x3f)*255/63);
+            dst[2] = (unsigned char)((pixel & 0x1f)*255/31);
+            dst[3] = 255;
+        }
+        else if (type == GL_UNSIGNED_SHORT_5_5_5_1)
+        {
+            unsigned short pixel = ((const unsigned short *)src)[i];
+            dst[0] = (unsigned char)(((pixel >> 11) & 0x1f)*255/31);
+            dst[1] = (unsigned char)(((pixel >> 6) & 0x1f)*255/31);
+            dst[2] = (unsigned char)(((pixel >> 1) & 0x1f)*255/31);
+            dst[3] = (pixel & 0x1)? 255 : 0;
+        }
+        else if (type == GL_UNSIGNED_SHORT_4_4_4_4)
+        {
+            unsigned short pixel = ((const unsigned short *)src)[i];
+            dst[0] = (unsigned char)(((pixel >> 12) & 0xf)*17);
+            dst[1] = (unsigned char)(((pixel >> 8) & 0xf)*17);
+            dst[2] = (unsigned char)(((pixel >> 4) & 0xf)*17);
+            dst[3] = (unsigned char)((pixel & 0xf)*17);
+        }
+        else
+        {
+            switch (format)
+            {
+                case GL_LUMINANCE: dst[0] = dst[1] = dst[2] = src[i]; dst[3] = 255; break;
+                case GL_ALPHA: dst[0] = dst[1] = dst[2] = 0; dst[3] = src[i]; break;
+                case GL_LUMINANCE_ALPHA: dst[0] = dst[1] = dst[2] = src[2*i]; dst[3] = src[2*i + 1]; break;
+                case GL_RGB: dst[0] = src[3*i]; dst[1] = src[3*i + 1]; dst[2] = src[3*i + 2]; dst[3] = 255; break;
+                default: memcpy(dst, src + 4*i, 4); break;
+            }
+        }
+    }
+}
+
+// Convert RGBA 8-bit pixels to format
+// NOTE: Luminance is taken from red channel, same as OpenGL
+static void swPackPixels(const unsigned char *src, int count, int format, int type, unsigned char *dst)
+{
+    for (int i = 0; i < count; i++, src += 4)
+    {
+        if (type == GL_UNSIGNED_SHORT_5_6_5)
+        {
+            ((unsigned short *)dst)[i] = (unsigned short)(((src[0]*31 + 127)/255 << 11) | ((src[1]*63 + 127)/255 << 5) | ((src[2]*31 + 127)/255));
+        }
+        else if (type == GL_UNSIGNED_SHORT_5_5_5_1)
+        {
+            ((unsigned short *)dst)[i] = (unsigned short)(((src[0]*31 + 127)/255 << 11) | ((src[1]*31 + 127)/255 << 6) | ((src[2]*31 + 127)/255 << 1) | ((src[3] > 127)? 1 : 0));
+        }
+        else if (type == GL_UNSIGNED_SHORT_4_4_4_4)
+        {
+            ((unsigned short *)dst)[i] = (unsigned short)(((src[0]*15 + 127)/255 << 12) | ((src[1]*15 + 127)/255 << 8) | ((src[2]*15 + 127)/255 << 4) | ((src[3]*15 + 127)/255));
+        }
+        else
+        {
+            switch (format)
+            {
+                case GL_LUMINANCE: dst[i] = src[0]; break;
+                case GL_ALPHA: dst[i] = src[3]; break;
+                case GL_LUMINANCE_ALPHA: dst[2*i] = src[0]; dst[2*i + 1] = src[3]; break;
+                case GL_RGB: dst[3*i] = src[0]; dst[3*i + 1] = src[1]; dst[3*i + 2] = src[2]; break;
+                default: memcpy(dst + 4*i, src, 4); break;
+            }
+        }
+    }
+}
+
+#endif  // RLSW_IMPLEMENTATION
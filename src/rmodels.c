@@ -18,6 +18,15 @@
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define RMODELS_NO_SIMD
+*           Disable SIMD intrinsics on mesh skinning, scalar code is used.
+*           By default SSE2 is used on x86-64 and NEON on ARM64
+*
+*       #define SUPPORT_GLTF_ANIMATION_KEYFRAMES
+*           Keep only keyframes poses for glTF animations, instead of resampling them at fixed rate,
+*           poses in-between keyframes are interpolated by UpdateModelAnimationEx()
+*           WARNING: Frames are unevenly spaced in time, check ModelAnimation.frameTimes
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -56,7 +65,33 @@
 #include <stdio.h>          // Required for: sprintf()
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
-#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf(), fminf(), fmaxf()
+
+// SIMD intrinsics used by mesh skinning
+// NOTE: Scalar code is used on other architectures or if RMODELS_NO_SIMD is defined
+#if !defined(RMODELS_NO_SIMD) && !defined(__TINYC__)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RMODELS_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in UpdateModelAnimation()]
+
+        typedef __m128 SkinVector;
+        #define SKIN_ZERO()                 _mm_setzero_ps()
+        #define SKIN_LOAD(ptr)              _mm_loadu_ps(ptr)
+        #define SKIN_STORE(ptr, v)          _mm_storeu_ps(ptr, v)
+        #define SKIN_MUL(v, s)              _mm_mul_ps(v, _mm_set1_ps(s))
+        #define SKIN_MADD(acc, v, s)        _mm_add_ps(acc, _mm_mul_ps(v, _mm_set1_ps(s)))
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define RMODELS_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in UpdateModelAnimation()]
+
+        typedef float32x4_t SkinVector;
+        #define SKIN_ZERO()                 vdupq_n_f32(0.0f)
+        #define SKIN_LOAD(ptr)              vld1q_f32(ptr)
+        #define SKIN_STORE(ptr, v)          vst1q_f32(ptr, v)
+        #define SKIN_MUL(v, s)              vmulq_n_f32(v, s)
+        #define SKIN_MADD(acc, v, s)        vmlaq_n_f32(acc, v, s)
+    #endif
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -132,11 +167,32 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MESH_BVH_MAX_LEAF_TRIANGLES
+    #define MESH_BVH_MAX_LEAF_TRIANGLES  4    // Maximum triangles per mesh BVH leaf node
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH          48    // Maximum mesh BVH depth, also limits traversal stack size
+#endif
+#ifndef MESH_VERTEX_CACHE_SIZE
+    #define MESH_VERTEX_CACHE_SIZE      32    // Post-transform vertex cache size considered for mesh triangles reordering
+#endif
+#ifndef ANIMATION_SKINNING_JOB_VERTICES
+    #define ANIMATION_SKINNING_JOB_VERTICES  8192   // Vertices skinned per parallel job, smaller meshes are skinned in a single job
+#endif
+#ifndef RAY_COLLISION_MESH_TRIANGLES
+    #define RAY_COLLISION_MESH_TRIANGLES    128   // Triangles transformed per block on ray-mesh collision (stack memory)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Skinning job data, one mesh vertex range per job
+typedef struct SkinningJobData {
+    Mesh mesh;                      // Mesh to skin (animVertices and animNormals are written)
+    const float *boneMatrices;      // Bones skinning matrices, 4 columns of 4 floats (last float padding)
+    const float *boneRotations;     // Bones normal rotation matrices, 3 columns of 4 floats (last float padding)
+    bool *updated;                  // Jobs updated flags, set if any bone transformation was applied
+} SkinningJobData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -156,6 +212,9 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_GLTF)
 static Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount);  // Load GLTF animation data
+#if defined(SUPPORT_GLTF_ANIMATION_KEYFRAMES)
+static int CompareKeyframeTimesGLTF(const void *a, const void *b);                      // Compare keyframes times (qsort callback)
+#endif
 #endif
 #if defined(SUPPORT_FILEFORMAT_VOX)
 static Model LoadVOX(const char *filename);     // Load VOX mesh data
@@ -167,6 +226,17 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *a, Vector3 *b, Vector3 *c);  // Get mesh triangle vertices (mesh space)
+static float GetRayBoxDistanceBVH(Vector3 origin, Vector3 invDirection, BoundingBox box, float maxDistance); // Get ray-box entry distance, -1.0f on miss
+static void UpdateModelAnimationPose(Model model, const Transform *pose, int boneCount);    // Update model meshes animated vertex data from bones pose
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms);   // Build pose from parent joints (model space pose from local pose)
+static void GetLocalPoseFromParentJoints(BoneInfo *bones, int boneCount, const Transform *transforms, Transform *localTransforms); // Get local pose from model space pose
+static void SkinMeshVerticesJob(void *data, int jobIndex);      // Skin a range of mesh vertices (parallel job)
+static void UploadMeshData(Mesh *mesh, bool dynamic, unsigned int compression);    // Upload mesh vertex data, compressed as required by flags
+static unsigned int LoadMeshVertexBuffer(const Mesh *mesh, int buffer, const float *data, int components, bool dynamic); // Load mesh vertex buffer, compressed if required
+static void SetMeshVertexAttribute(unsigned int compression, int buffer, int location);     // Set mesh vertex buffer attribute format
+static float GetVertexCacheScore(int cachePosition, int valence);                          // Get vertex score for triangles reordering
+static void OptimizeMeshVertexCache(unsigned int *indices, int indexCount, int vertexCount); // Reorder triangles for post-transform vertex cache
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1185,126 +1255,46 @@ BoundingBox GetModelBoundingBox(Model model)
 }
 
 // Upload vertex data into a VAO (if supported) and VBO
+// NOTE: Vertex data is uploaded uncompressed, mesh compression flags are cleared
 void UploadMesh(Mesh *mesh, bool dynamic)
 {
-    if (mesh->vaoId > 0)
-    {
-        // Check if mesh has already been loaded in GPU
-        TRACELOG(LOG_WARNING, "VAO: [ID %i] Trying to re-load an already loaded mesh", mesh->vaoId);
-        return;
-    }
-
-    mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
-
-    mesh->vaoId = 0;        // Vertex Array Object
-    mesh->vboId[0] = 0;     // Vertex buffer: positions
-    mesh->vboId[1] = 0;     // Vertex buffer: texcoords
-    mesh->vboId[2] = 0;     // Vertex buffer: normals
-    mesh->vboId[3] = 0;     // Vertex buffer: colors
-    mesh->vboId[4] = 0;     // Vertex buffer: tangents
-    mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
-    mesh->vboId[6] = 0;     // Vertex buffer: indices
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mesh->vaoId = rlLoadVertexArray();
-    rlEnableVertexArray(mesh->vaoId);
-
-    // NOTE: Vertex attributes must be uploaded considering default locations points and available vertex data
-
-    // Enable vertex attributes: position (shader-location = 0)
-    void *vertices = (mesh->animVertices != NULL)? mesh->animVertices : mesh->vertices;
-    mesh->vboId[0] = rlLoadVertexBuffer(vertices, mesh->vertexCount*3*sizeof(float), dynamic);
-    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, 0, 0, 0);
-    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
-
-    // Enable vertex attributes: texcoords (shader-location = 1)
-    mesh->vboId[1] = rlLoadVertexBuffer(mesh->texcoords, mesh->vertexCount*2*sizeof(float), dynamic);
-    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, 0, 0, 0);
-    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
-
-    // WARNING: When setting default vertex attribute values, the values for each generic vertex attribute
-    // is part of current state, and it is maintained even if a different program object is used
-
-    if (mesh->normals != NULL)
-    {
-        // Enable vertex attributes: normals (shader-location = 2)
-        void *normals = (mesh->animNormals != NULL)? mesh->animNormals : mesh->normals;
-        mesh->vboId[2] = rlLoadVertexBuffer(normals, mesh->vertexCount*3*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
-    }
-    else
-    {
-        // Default vertex attribute: normal
-        // WARNING: Default value provided to shader if location available
-        float value[3] = { 1.0f, 1.0f, 1.0f };
-        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, value, SHADER_ATTRIB_VEC3, 3);
-        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
-    }
-
-    if (mesh->colors != NULL)
-    {
-        // Enable vertex attribute: color (shader-location = 3)
-        mesh->vboId[3] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-    }
-    else
-    {
-        // Default vertex attribute: color
-        // WARNING: Default value provided to shader if location available
-        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
-        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, value, SHADER_ATTRIB_VEC4, 4);
-        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-    }
-
-    if (mesh->tangents != NULL)
-    {
-        // Enable vertex attribute: tangent (shader-location = 4)
-        mesh->vboId[4] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
-    }
-    else
-    {
-        // Default vertex attribute: tangent
-        // WARNING: Default value provided to shader if location available
-        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, value, SHADER_ATTRIB_VEC4, 4);
-        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
-    }
+    UploadMeshData(mesh, dynamic, 0);
+}
 
-    if (mesh->texcoords2 != NULL)
-    {
-        // Enable vertex attribute: texcoord2 (shader-location = 5)
-        mesh->vboId[5] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
-    }
-    else
+// Upload mesh vertex data in GPU using compact vertex formats
+// NOTE: Compressed mesh vertex data is static, already uploaded mesh is uploaded again
+void UploadMeshCompressed(Mesh *mesh, unsigned int flags)
+{
+    if (mesh->vboId != NULL)
     {
-        // Default vertex attribute: texcoord2
-        // WARNING: Default value provided to shader if location available
-        float value[2] = { 0.0f, 0.0f };
-        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, value, SHADER_ATTRIB_VEC2, 2);
-        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
-    }
+        // Unload current mesh GPU data
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
 
-    if (mesh->indices != NULL)
-    {
-        mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
+        mesh->vaoId = 0;
+        mesh->vboId = NULL;
     }
 
-    if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
-    else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
-
-    rlDisableVertexArray();
-#endif
+    UploadMeshData(mesh, false, flags);
 }
 
 // Update mesh vertex data in GPU for a specific buffer index
+// NOTE: Compressed vertex buffers store quantized data, they can not be updated with float data
 void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
 {
+    unsigned int compressed = 0;
+    if (index == 0) compressed = mesh.compression & MESH_COMPRESS_POSITIONS;
+    else if (index == 1) compressed = mesh.compression & MESH_COMPRESS_TEXCOORDS;
+    else if (index == 2) compressed = mesh.compression & MESH_COMPRESS_NORMALS;
+    else if (index == 4) compressed = mesh.compression & MESH_COMPRESS_TANGENTS;
+
+    if (compressed)
+    {
+        TRACELOG(LOG_WARNING, "VBO: [ID %i] Mesh vertex buffer %i is compressed, it can not be updated", mesh.vboId[index], index);
+        return;
+    }
+
     rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
 }
 
@@ -1389,8 +1379,14 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
+    // Compressed vertex positions are dequantized into mesh space with the model transformation
+    // NOTE: Normal matrix is computed from provided transform, not affected by dequantization
+    Matrix matMesh = transform;
+    if (mesh.compression & MESH_COMPRESS_POSITIONS) matMesh = MatrixMultiply(MatrixMultiply(MatrixScale(mesh.quantization.w, mesh.quantization.w, mesh.quantization.w),
+        MatrixTranslate(mesh.quantization.x, mesh.quantization.y, mesh.quantization.z)), transform);
+
     // Model transformation matrix is sent to shader uniform location: SHADER_LOC_MATRIX_MODEL
-    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], transform);
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], matMesh);
 
     // Accumulate several model transformations:
     //    transform: model transformation provided (includes DrawModel() params combined with model.transform)
@@ -1398,7 +1394,7 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     matModel = MatrixMultiply(transform, rlGetMatrixTransform());
 
     // Get model-view matrix
-    matModelView = MatrixMultiply(matModel, matView);
+    matModelView = MatrixMultiply(MatrixMultiply(matMesh, rlGetMatrixTransform()), matView);
 
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
@@ -1430,19 +1426,19 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     {
         // Bind mesh VBO data: vertex position (shader-location = 0)
         rlEnableVertexBuffer(mesh.vboId[0]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(mesh.compression, 0, material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
 
         // Bind mesh VBO data: vertex texcoords (shader-location = 1)
         rlEnableVertexBuffer(mesh.vboId[1]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(mesh.compression, 1, material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
 
         if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
         {
             // Bind mesh VBO data: vertex normals (shader-location = 2)
             rlEnableVertexBuffer(mesh.vboId[2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(mesh.compression, 2, material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
         }
 
@@ -1469,7 +1465,7 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[4]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(mesh.compression, 4, material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
         }
 
@@ -1594,7 +1590,15 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
 
     // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+    // NOTE: Compressed vertex positions are dequantized into mesh space with instances transformations
+    if (mesh.compression & MESH_COMPRESS_POSITIONS)
+    {
+        Matrix matDequantize = MatrixMultiply(MatrixScale(mesh.quantization.w, mesh.quantization.w, mesh.quantization.w),
+            MatrixTranslate(mesh.quantization.x, mesh.quantization.y, mesh.quantization.z));
+
+        for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(MatrixMultiply(matDequantize, transforms[i]));
+    }
+    else for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
 
     // Enable mesh VAO to attach new buffer
     rlEnableVertexArray(mesh.vaoId);
@@ -1648,19 +1652,19 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     {
         // Bind mesh VBO data: vertex position (shader-location = 0)
         rlEnableVertexBuffer(mesh.vboId[0]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(mesh.compression, 0, material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
 
         // Bind mesh VBO data: vertex texcoords (shader-location = 1)
         rlEnableVertexBuffer(mesh.vboId[1]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(mesh.compression, 1, material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
 
         if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
         {
             // Bind mesh VBO data: vertex normals (shader-location = 2)
             rlEnableVertexBuffer(mesh.vboId[2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(mesh.compression, 2, material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
         }
 
@@ -1687,7 +1691,7 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[4]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(mesh.compression, 4, material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
         }
 
@@ -2108,100 +2112,129 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
+        PROFILE_ZONE_BEGIN("UpdateModelAnimation");
+
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        for (int m = 0; m < model.meshCount; m++)
+        // NOTE: Mesh bone ids index model bones, animation must provide a pose for every model bone
+        if (anim.boneCount != model.boneCount) TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Animation bones count does not match model");
+        else UpdateModelAnimationPose(model, anim.framePoses[frame], anim.boneCount);
+
+        PROFILE_ZONE_END();
+    }
+}
+
+// Update model animation pose, sampled at time and blended between multiple animations
+// NOTE: Time is expected in seconds, animations are looped; for animations without
+// frameTimes data (i.e. user generated), time is considered as a fractional frame position
+void UpdateModelAnimationEx(Model model, ModelAnimation *anims, const float *weights, int count, float time)
+{
+    if ((anims == NULL) || (weights == NULL) || (count <= 0) || (model.boneCount <= 0)) return;
+
+    PROFILE_ZONE_BEGIN("UpdateModelAnimationEx");
+
+    // Blended pose only requires data per bone, no intermediate per-vertex data
+    // NOTE: Animation poses are stored in model space, interpolating them per bone does not keep
+    // bones length, so neighbouring frames local poses (relative to parent) are interpolated and
+    // blended, blended pose is converted back to model space
+    Transform *pose = (Transform *)RL_CALLOC(model.boneCount*3, sizeof(Transform));
+    Transform *framePose = pose + model.boneCount;
+    Transform *nextFramePose = framePose + model.boneCount;
+    float totalWeight = 0.0f;
+
+    for (int a = 0; a < count; a++)
+    {
+        ModelAnimation anim = anims[a];
+
+        if ((weights[a] <= 0.0f) || (anim.frameCount <= 0) || (anim.framePoses == NULL)) continue;
+        if (anim.boneCount != model.boneCount)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimationEx(): Animation %i bones count does not match model", a);
+            continue;
+        }
+
+        // Get neighbouring frames and interpolation factor for provided time
+        int frame = 0;
+        int nextFrame = 0;
+        float factor = 0.0f;
+
+        if (anim.frameTimes != NULL)
         {
-            Mesh mesh = model.meshes[m];
+            float duration = anim.frameTimes[anim.frameCount - 1];
+            float animTime = (duration > 0.0f)? fmodf(time, duration) : 0.0f;
+            if (animTime < 0.0f) animTime += duration;
 
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+            // Animation channels could start after time 0, first keyframe pose is kept until then
+            if (animTime < anim.frameTimes[0]) animTime = anim.frameTimes[0];
+
+            // Binary search last frame with time lower or equal than animation time
+            int low = 0;
+            int high = anim.frameCount - 1;
+
+            while (low < high)
             {
-                TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Mesh %i has no connection to bones", m);
-                continue;
+                int mid = (low + high + 1)/2;
+                if (anim.frameTimes[mid] <= animTime) low = mid;
+                else high = mid - 1;
             }
 
-            bool updated = false;           // Flag to check when anim vertex information is updated
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
+            frame = low;
+            nextFrame = (frame < (anim.frameCount - 1))? frame + 1 : frame;
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
+            float frameDuration = anim.frameTimes[nextFrame] - anim.frameTimes[frame];
+            factor = (frameDuration > 0.0f)? (animTime - anim.frameTimes[frame])/frameDuration : 0.0f;
+        }
+        else
+        {
+            float position = fmodf(time, (float)anim.frameCount);
+            if (position < 0.0f) position += (float)anim.frameCount;
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+            frame = (int)position;
+            if (frame >= anim.frameCount) frame = anim.frameCount - 1;
+            nextFrame = (frame + 1)%anim.frameCount;
+            factor = position - (float)frame;
+        }
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
+        GetLocalPoseFromParentJoints(model.bones, model.boneCount, anim.framePoses[frame], framePose);
+        GetLocalPoseFromParentJoints(model.bones, model.boneCount, anim.framePoses[nextFrame], nextFramePose);
 
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-            {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
+        // Interpolate neighbouring frame local poses and accumulate weighted pose
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            Transform in = framePose[i];
+            Transform out = nextFramePose[i];
 
-                if (mesh.animNormals != NULL)
-                {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
-                }
+            Vector3 translation = Vector3Lerp(in.translation, out.translation, factor);
+            Quaternion rotation = QuaternionSlerp(in.rotation, out.rotation, factor);
+            Vector3 scale = Vector3Lerp(in.scale, out.scale, factor);
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
-
-                    // Early stop when no transformation will be applied
-                    if (boneWeight == 0.0f) continue;
-
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
-                }
-            }
+            // Keep rotations on the same hemisphere before accumulating them
+            if ((totalWeight > 0.0f) && (Vector4DotProduct(pose[i].rotation, rotation) < 0.0f)) rotation = Vector4Negate(rotation);
 
-            // Upload new vertex data to GPU for model drawing
-            // NOTE: Only update data when values changed
-            if (updated)
-            {
-                rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
-            }
+            pose[i].translation = Vector3Add(pose[i].translation, Vector3Scale(translation, weights[a]));
+            pose[i].rotation = QuaternionAdd(pose[i].rotation, QuaternionScale(rotation, weights[a]));
+            pose[i].scale = Vector3Add(pose[i].scale, Vector3Scale(scale, weights[a]));
+        }
+
+        totalWeight += weights[a];
+    }
+
+    if (totalWeight > 0.0f)
+    {
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            pose[i].translation = Vector3Scale(pose[i].translation, 1.0f/totalWeight);
+            pose[i].rotation = QuaternionNormalize(pose[i].rotation);
+            pose[i].scale = Vector3Scale(pose[i].scale, 1.0f/totalWeight);
         }
+
+        BuildPoseFromParentJoints(model.bones, model.boneCount, pose);
+        UpdateModelAnimationPose(model, pose, model.boneCount);
     }
+
+    RL_FREE(pose);
+
+    PROFILE_ZONE_END();
 }
 
 // Unload animation array data
@@ -2218,6 +2251,7 @@ void UnloadModelAnimation(ModelAnimation anim)
 
     RL_FREE(anim.bones);
     RL_FREE(anim.framePoses);
+    RL_FREE(anim.frameTimes);
 }
 
 // Check model animation skeleton match
@@ -2912,7 +2946,8 @@ Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
     int mapX = heightmap.width;
     int mapZ = heightmap.height;
 
-    Color *pixels = LoadImageColors(heightmap);
+    // NOTE: RGBA 8-bit image data is read directly, other formats are converted
+    Color *pixels = (heightmap.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (Color *)heightmap.data : LoadImageColors(heightmap);
 
     // NOTE: One vertex per pixel
     mesh.triangleCount = (mapX - 1)*(mapZ - 1)*2;    // One quad every four pixels
@@ -3025,7 +3060,7 @@ Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
         }
     }
 
-    UnloadImageColors(pixels);  // Unload pixels color data
+    if (pixels != heightmap.data) UnloadImageColors(pixels);  // Unload pixels color data
 
     // Upload vertex data to GPU (static mesh)
     UploadMesh(&mesh, false);
@@ -3041,7 +3076,8 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 
     Mesh mesh = { 0 };
 
-    Color *pixels = LoadImageColors(cubicmap);
+    // NOTE: RGBA 8-bit image data is read directly, other formats are converted
+    Color *pixels = (cubicmap.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (Color *)cubicmap.data : LoadImageColors(cubicmap);
 
     // NOTE: Max possible number of triangles numCubes*(12 triangles by cube)
     int maxTriangles = cubicmap.width*cubicmap.height*12;
@@ -3373,7 +3409,7 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
     RL_FREE(mapNormals);
     RL_FREE(mapTexcoords);
 
-    UnloadImageColors(pixels);   // Unload pixels color data
+    if (pixels != cubicmap.data) UnloadImageColors(pixels);   // Unload pixels color data
 
     // Upload vertex data to GPU (static mesh)
     UploadMesh(&mesh, false);
@@ -3390,17 +3426,7 @@ BoundingBox GetMeshBoundingBox(Mesh mesh)
     Vector3 minVertex = { 0 };
     Vector3 maxVertex = { 0 };
 
-    if (mesh.vertices != NULL)
-    {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-        }
-    }
+    if (mesh.vertices != NULL) Vector3MinMaxArray((Vector3 *)mesh.vertices, mesh.vertexCount, &minVertex, &maxVertex);
 
     // Create the bounding box
     BoundingBox box = { 0 };
@@ -3498,19 +3524,20 @@ void GenMeshTangents(Mesh *mesh)
 
     if (mesh->vboId != NULL)
     {
-        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
+        if ((mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0) && !(mesh->compression & MESH_COMPRESS_TANGENTS))
         {
             // Update existing vertex buffer
             rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], mesh->tangents, mesh->vertexCount*4*sizeof(float), 0);
         }
         else
         {
-            // Load a new tangent attributes buffer
-            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+            // Load a new tangent attributes buffer (compressed if required)
+            rlUnloadVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT]);
+            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = LoadMeshVertexBuffer(mesh, SHADER_LOC_VERTEX_TANGENT, mesh->tangents, 4, false);
         }
 
         rlEnableVertexArray(mesh->vaoId);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(mesh->compression, SHADER_LOC_VERTEX_TANGENT, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
         rlDisableVertexArray();
     }
@@ -3518,6 +3545,170 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Optimize mesh vertex data for GPU rendering
+// NOTE: Duplicated vertices are welded and mesh is indexed, triangles are reordered
+// for post-transform vertex cache locality and vertices for fetch locality
+// WARNING: Mesh vertex order changes, mesh BVH must be rebuilt, mesh already uploaded is uploaded again,
+// keeping buffers usage (static or dynamic) and vertex data compression
+void OptimizeMesh(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->vertexCount <= 0) || (mesh->triangleCount <= 0)) return;
+
+    int vertexCount = mesh->vertexCount;
+    int indexCount = mesh->triangleCount*3;
+
+    if ((mesh->indices == NULL) && (indexCount > vertexCount))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to optimize mesh, not enough vertex data for triangles");
+        return;
+    }
+
+    // Mesh vertex data streams, all vertex attributes are welded and reordered together
+    void **streams[10] = {
+        (void **)&mesh->vertices, (void **)&mesh->texcoords, (void **)&mesh->texcoords2, (void **)&mesh->normals,
+        (void **)&mesh->tangents, (void **)&mesh->colors, (void **)&mesh->animVertices, (void **)&mesh->animNormals,
+        (void **)&mesh->boneIds, (void **)&mesh->boneWeights
+    };
+    const int streamSizes[10] = {
+        3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float),
+        4*sizeof(float), 4*sizeof(unsigned char), 3*sizeof(float), 3*sizeof(float),
+        4*sizeof(unsigned char), 4*sizeof(float)
+    };
+
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    for (int i = 0; i < indexCount; i++) indices[i] = (mesh->indices != NULL)? mesh->indices[i] : (unsigned int)i;
+
+    // Weld duplicated vertices: all vertex attributes must be equal
+    // NOTE: Vertices are compared through an open addressing hash table
+    //------------------------------------------------------------------------------------------------------
+    unsigned int *remap = (unsigned int *)RL_MALLOC(vertexCount*sizeof(unsigned int));
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize *= 2;
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    int uniqueCount = 0;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        // Vertex hash (FNV-1a) from all available vertex attributes data
+        unsigned int hash = 2166136261u;
+        for (int s = 0; s < 10; s++)
+        {
+            if (*streams[s] == NULL) continue;
+
+            const unsigned char *bytes = (const unsigned char *)(*streams[s]) + v*streamSizes[s];
+            for (int b = 0; b < streamSizes[s]; b++) hash = (hash ^ bytes[b])*16777619u;
+        }
+
+        int slot = hash & (tableSize - 1);
+
+        while (true)
+        {
+            int other = table[slot];
+
+            if (other == -1)
+            {
+                table[slot] = v;
+                remap[v] = v;
+                uniqueCount++;
+                break;
+            }
+
+            bool equal = true;
+            for (int s = 0; equal && (s < 10); s++)
+            {
+                if (*streams[s] == NULL) continue;
+
+                const unsigned char *data = (const unsigned char *)(*streams[s]);
+                equal = (memcmp(data + v*streamSizes[s], data + other*streamSizes[s], streamSizes[s]) == 0);
+            }
+
+            if (equal)
+            {
+                remap[v] = other;
+                break;
+            }
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+    }
+
+    RL_FREE(table);
+
+    for (int i = 0; i < indexCount; i++) indices[i] = remap[indices[i]];
+    //------------------------------------------------------------------------------------------------------
+
+    if (uniqueCount > 65536)
+    {
+        // NOTE: Mesh indices are 16-bit, mesh can not be indexed
+        TRACELOG(LOG_WARNING, "MESH: Failed to optimize mesh, welded vertex count (%i) exceeds 16-bit indices limit", uniqueCount);
+        RL_FREE(remap);
+        RL_FREE(indices);
+        return;
+    }
+
+    // Reorder triangles for post-transform vertex cache
+    OptimizeMeshVertexCache(indices, indexCount, vertexCount);
+
+    // Reorder vertices for fetch locality: vertices sorted by first use on triangles,
+    // unreferenced vertices are removed
+    //------------------------------------------------------------------------------------------------------
+    for (int v = 0; v < vertexCount; v++) remap[v] = 0xffffffff;
+
+    int newVertexCount = 0;
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] == 0xffffffff) remap[indices[i]] = newVertexCount++;
+        indices[i] = remap[indices[i]];
+    }
+
+    for (int s = 0; s < 10; s++)
+    {
+        if (*streams[s] == NULL) continue;
+
+        const unsigned char *data = (const unsigned char *)(*streams[s]);
+        unsigned char *newData = (unsigned char *)RL_MALLOC(newVertexCount*streamSizes[s]);
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            if (remap[v] != 0xffffffff) memcpy(newData + remap[v]*streamSizes[s], data + v*streamSizes[s], streamSizes[s]);
+        }
+
+        RL_FREE(*streams[s]);
+        *streams[s] = newData;
+    }
+
+    RL_FREE(mesh->indices);
+    mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    for (int i = 0; i < indexCount; i++) mesh->indices[i] = (unsigned short)indices[i];
+
+    mesh->vertexCount = newVertexCount;
+    //------------------------------------------------------------------------------------------------------
+
+    RL_FREE(remap);
+    RL_FREE(indices);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh optimized, vertex count: %i -> %i", vertexCount, newVertexCount);
+
+    // Upload optimized vertex data, keeping mesh buffers usage and vertex data compression
+    // NOTE: Dynamic meshes are not compressed, they are uploaded again as dynamic
+    if (mesh->vboId != NULL)
+    {
+        bool dynamic = rlIsVertexBufferDynamic(mesh->vboId[0]);
+        unsigned int compression = mesh->compression;
+
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
+
+        mesh->vaoId = 0;
+        mesh->vboId = NULL;
+
+        UploadMeshData(mesh, dynamic, compression);
+    }
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -3883,37 +4074,32 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     // Check if mesh vertex data on CPU for testing
     if (mesh.vertices != NULL)
     {
-        int triangleCount = mesh.triangleCount;
+        // Triangles vertices are transformed by blocks into stack memory, no memory allocation required
+        // NOTE: Indexed meshes triangles vertices are gathered first and transformed in place
+        Vector3 vertices[RAY_COLLISION_MESH_TRIANGLES*3];
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        for (int first = 0; first < mesh.triangleCount; first += RAY_COLLISION_MESH_TRIANGLES)
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            int count = mesh.triangleCount - first;
+            if (count > RAY_COLLISION_MESH_TRIANGLES) count = RAY_COLLISION_MESH_TRIANGLES;
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
+            if (mesh.indices != NULL)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                for (int i = 0; i < count; i++) GetMeshTriangle(mesh, first + i, &vertices[i*3], &vertices[i*3 + 1], &vertices[i*3 + 2]);
+                Vector3TransformArray(vertices, vertices, count*3, transform);
             }
+            else Vector3TransformArray(vertices, (Vector3 *)mesh.vertices + first*3, count*3, transform);
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
-
-            if (triHitInfo.hit)
+            // Test against block triangles
+            for (int i = 0; i < count; i++)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                RayCollision triHitInfo = GetRayCollisionTriangle(ray, vertices[i*3], vertices[i*3 + 1], vertices[i*3 + 2]);
+
+                if (triHitInfo.hit)
+                {
+                    // Save the closest hit triangle
+                    if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                }
             }
         }
     }
@@ -3921,18 +4107,244 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     return collision;
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+// Build mesh bounding volume hierarchy for ray-casting
+// NOTE: Hierarchy is built in mesh space from CPU vertex data, it must be rebuilt if mesh vertices change
+MeshBVH BuildMeshBVH(Mesh mesh)
 {
-    #define EPSILON 0.000001f        // A small number
+    MeshBVH bvh = { 0 };
 
-    RayCollision collision = { 0 };
-    Vector3 edge1 = { 0 };
-    Vector3 edge2 = { 0 };
-    Vector3 p, q, tv;
-    float det, invDet, u, v, t;
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: BVH generation requires vertex data on CPU");
+        return bvh;
+    }
+
+    int triangleCount = mesh.triangleCount;
+
+    // Precompute triangles bounds and centroids, they are accessed multiple times on partitioning
+    BoundingBox *triBounds = (BoundingBox *)RL_MALLOC(triangleCount*sizeof(BoundingBox));
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+
+    bvh.triangleCount = triangleCount;
+    bvh.triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    bvh.nodes = (MeshBVHNode *)RL_CALLOC(2*triangleCount - 1, sizeof(MeshBVHNode));   // Worst case, binary tree with single triangle leaves
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a, b, c;
+        GetMeshTriangle(mesh, i, &a, &b, &c);
+
+        triBounds[i].min = Vector3Min(Vector3Min(a, b), c);
+        triBounds[i].max = Vector3Max(Vector3Max(a, b), c);
+        centroids[i] = Vector3Scale(Vector3Add(triBounds[i].min, triBounds[i].max), 0.5f);
+        bvh.triangles[i] = i;
+    }
+
+    // Root node contains all triangles
+    bvh.nodes[0].first = 0;
+    bvh.nodes[0].count = triangleCount;
+    bvh.nodeCount = 1;
+
+    // Nodes are split depth-first, using an explicit stack of node indices and depths
+    int stack[MESH_BVH_MAX_DEPTH + 1][2] = { 0 };
+    int stackSize = 1;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        int nodeIndex = stack[stackSize][0];
+        int depth = stack[stackSize][1];
+        MeshBVHNode *node = &bvh.nodes[nodeIndex];
+
+        // Compute node bounds and centroids bounds
+        BoundingBox centroidBounds = { centroids[bvh.triangles[node->first]], centroids[bvh.triangles[node->first]] };
+        node->bounds = triBounds[bvh.triangles[node->first]];
+
+        for (int i = node->first + 1; i < node->first + node->count; i++)
+        {
+            int t = bvh.triangles[i];
+            node->bounds.min = Vector3Min(node->bounds.min, triBounds[t].min);
+            node->bounds.max = Vector3Max(node->bounds.max, triBounds[t].max);
+            centroidBounds.min = Vector3Min(centroidBounds.min, centroids[t]);
+            centroidBounds.max = Vector3Max(centroidBounds.max, centroids[t]);
+        }
+
+        if ((node->count <= MESH_BVH_MAX_LEAF_TRIANGLES) || (depth >= MESH_BVH_MAX_DEPTH)) continue;
+
+        // Split along the largest axis of the centroids bounds, at its midpoint
+        Vector3 extent = Vector3Subtract(centroidBounds.max, centroidBounds.min);
+        int axis = 0;
+        if (extent.y > extent.x) axis = 1;
+        if (extent.z > ((axis == 0)? extent.x : extent.y)) axis = 2;
+
+        float axisExtent = (axis == 0)? extent.x : ((axis == 1)? extent.y : extent.z);
+        if (axisExtent <= 0.0f) continue;   // All centroids overlap, keep as leaf
+
+        float splitPos = ((axis == 0)? centroidBounds.min.x : ((axis == 1)? centroidBounds.min.y : centroidBounds.min.z)) + axisExtent*0.5f;
+
+        int i = node->first;
+        int j = node->first + node->count - 1;
+
+        while (i <= j)
+        {
+            Vector3 centroid = centroids[bvh.triangles[i]];
+            float value = (axis == 0)? centroid.x : ((axis == 1)? centroid.y : centroid.z);
+
+            if (value < splitPos) i++;
+            else
+            {
+                int temp = bvh.triangles[i];
+                bvh.triangles[i] = bvh.triangles[j];
+                bvh.triangles[j] = temp;
+                j--;
+            }
+        }
+
+        int leftCount = i - node->first;
+        if ((leftCount == 0) || (leftCount == node->count)) leftCount = node->count/2;
+
+        // Create child nodes, consecutive in the nodes array
+        int left = bvh.nodeCount;
+        bvh.nodes[left].first = node->first;
+        bvh.nodes[left].count = leftCount;
+        bvh.nodes[left + 1].first = node->first + leftCount;
+        bvh.nodes[left + 1].count = node->count - leftCount;
+        bvh.nodeCount += 2;
+
+        node->first = left;
+        node->count = 0;
+
+        stack[stackSize][0] = left;
+        stack[stackSize][1] = depth + 1;
+        stack[stackSize + 1][0] = left + 1;
+        stack[stackSize + 1][1] = depth + 1;
+        stackSize += 2;
+    }
+
+    // Release unused nodes memory
+    bvh.nodes = (MeshBVHNode *)RL_REALLOC(bvh.nodes, bvh.nodeCount*sizeof(MeshBVHNode));
+
+    RL_FREE(triBounds);
+    RL_FREE(centroids);
+
+    TRACELOG(LOG_INFO, "MESH: BVH built successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy data
+void UnloadMeshBVH(MeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.triangles);
+}
+
+// Get collision info between ray and mesh, accelerated by mesh BVH
+// NOTE: Ray is transformed into mesh space, instead of transforming all mesh triangles
+RayCollision GetRayCollisionMeshBVH(Ray ray, Mesh mesh, MeshBVH bvh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    if (mesh.vertices == NULL) return collision;
+
+    // Fallback to brute-force test if no valid hierarchy provided
+    if ((bvh.nodes == NULL) || (bvh.nodeCount <= 0)) return GetRayCollisionMesh(ray, mesh, transform);
+
+    // Transform ray into mesh space, direction is not normalized
+    // so the ray parameter (distance) is the same in both spaces
+    Matrix invTransform = MatrixInvert(transform);
+    Ray localRay = { 0 };
+    localRay.position = Vector3Transform(ray.position, invTransform);
+    localRay.direction.x = invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z;
+    localRay.direction.y = invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z;
+    localRay.direction.z = invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z;
+
+    Vector3 invDirection = { 1.0f/localRay.direction.x, 1.0f/localRay.direction.y, 1.0f/localRay.direction.z };
+
+    float closestDistance = 340282346638528859811704183484516925440.0f;     // FLT_MAX
+    int closestTriangle = -1;
+
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackSize = 0;
+
+    if (GetRayBoxDistanceBVH(localRay.position, invDirection, bvh.nodes[0].bounds, closestDistance) >= 0.0f) stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        MeshBVHNode node = bvh.nodes[stack[--stackSize]];
+
+        if (node.count > 0)
+        {
+            // Leaf node, test contained triangles
+            for (int i = node.first; i < node.first + node.count; i++)
+            {
+                Vector3 a, b, c;
+                GetMeshTriangle(mesh, bvh.triangles[i], &a, &b, &c);
+
+                RayCollision triHitInfo = GetRayCollisionTriangle(localRay, a, b, c);
+
+                if (triHitInfo.hit && (triHitInfo.distance < closestDistance))
+                {
+                    closestDistance = triHitInfo.distance;
+                    closestTriangle = bvh.triangles[i];
+                }
+            }
+        }
+        else
+        {
+            // Inner node, visit nearest child first (pushed last)
+            float leftDistance = GetRayBoxDistanceBVH(localRay.position, invDirection, bvh.nodes[node.first].bounds, closestDistance);
+            float rightDistance = GetRayBoxDistanceBVH(localRay.position, invDirection, bvh.nodes[node.first + 1].bounds, closestDistance);
+
+            if ((leftDistance >= 0.0f) && (rightDistance >= 0.0f))
+            {
+                if (leftDistance < rightDistance)
+                {
+                    stack[stackSize++] = node.first + 1;
+                    stack[stackSize++] = node.first;
+                }
+                else
+                {
+                    stack[stackSize++] = node.first;
+                    stack[stackSize++] = node.first + 1;
+                }
+            }
+            else if (leftDistance >= 0.0f) stack[stackSize++] = node.first;
+            else if (rightDistance >= 0.0f) stack[stackSize++] = node.first + 1;
+        }
+    }
+
+    if (closestTriangle >= 0)
+    {
+        // Compute hit point and normal in world space
+        Vector3 a, b, c;
+        GetMeshTriangle(mesh, closestTriangle, &a, &b, &c);
+
+        a = Vector3Transform(a, transform);
+        b = Vector3Transform(b, transform);
+        c = Vector3Transform(c, transform);
+
+        collision.hit = true;
+        collision.distance = closestDistance;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, closestDistance));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    RayCollision collision = { 0 };
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
 
     // Find vectors for two edges sharing V1
     edge1 = Vector3Subtract(p2, p1);
@@ -3997,9 +4409,638 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Get mesh triangle vertices (mesh space), considering indexed and non-indexed meshes
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *a, Vector3 *b, Vector3 *c)
+{
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    if (mesh.indices)
+    {
+        *a = vertdata[mesh.indices[index*3 + 0]];
+        *b = vertdata[mesh.indices[index*3 + 1]];
+        *c = vertdata[mesh.indices[index*3 + 2]];
+    }
+    else
+    {
+        *a = vertdata[index*3 + 0];
+        *b = vertdata[index*3 + 1];
+        *c = vertdata[index*3 + 2];
+    }
+}
+
+// Get ray-box entry distance (slab test), -1.0f on miss or if box is further than maxDistance
+// NOTE: Ray direction is provided inverted, it is precomputed once per ray
+static float GetRayBoxDistanceBVH(Vector3 origin, Vector3 invDirection, BoundingBox box, float maxDistance)
+{
+    float t1 = (box.min.x - origin.x)*invDirection.x;
+    float t2 = (box.max.x - origin.x)*invDirection.x;
+    float tmin = fminf(t1, t2);
+    float tmax = fmaxf(t1, t2);
+
+    t1 = (box.min.y - origin.y)*invDirection.y;
+    t2 = (box.max.y - origin.y)*invDirection.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    t1 = (box.min.z - origin.z)*invDirection.z;
+    t2 = (box.max.z - origin.z)*invDirection.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    if ((tmax < 0.0f) || (tmin > tmax) || (tmin > maxDistance)) return -1.0f;
+
+    return (tmin > 0.0f)? tmin : 0.0f;
+}
+
+// Update model meshes animated vertex data from bones pose (model space)
+// NOTE: One skinning matrix is precomputed per bone, instead of recomputing bone
+// transformation for every vertex bone influence. Vertex transformation is:
+// (rotation*(scale*(vertex - bindTranslation))) + translation
+// where rotation = poseRotation*inverse(bindRotation), normals are only rotated
+static void UpdateModelAnimationPose(Model model, const Transform *pose, int boneCount)
+{
+    float *boneMatrices = (float *)RL_MALLOC(boneCount*16*sizeof(float));
+    float *boneRotations = (float *)RL_MALLOC(boneCount*12*sizeof(float));
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        Vector3 inTranslation = model.bindPose[i].translation;
+        Quaternion inRotation = model.bindPose[i].rotation;
+        Vector3 outTranslation = pose[i].translation;
+        Quaternion outRotation = pose[i].rotation;
+        Vector3 outScale = pose[i].scale;
+
+        Matrix rotation = QuaternionToMatrix(QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+        float r[9] = { rotation.m0, rotation.m1, rotation.m2, rotation.m4, rotation.m5, rotation.m6, rotation.m8, rotation.m9, rotation.m10 };
+        float scale[3] = { outScale.x, outScale.y, outScale.z };
+        float *bone = &boneMatrices[i*16];
+        float *boneRotation = &boneRotations[i*12];
+
+        // Rotation and scale columns, translation column: outTranslation - (rotation*scale)*inTranslation
+        for (int col = 0; col < 3; col++)
+        {
+            for (int row = 0; row < 3; row++)
+            {
+                bone[col*4 + row] = r[col*3 + row]*scale[col];
+                boneRotation[col*4 + row] = r[col*3 + row];
+            }
+
+            bone[col*4 + 3] = 0.0f;
+            boneRotation[col*4 + 3] = 0.0f;
+        }
+
+        bone[12] = outTranslation.x - (bone[0]*inTranslation.x + bone[4]*inTranslation.y + bone[8]*inTranslation.z);
+        bone[13] = outTranslation.y - (bone[1]*inTranslation.x + bone[5]*inTranslation.y + bone[9]*inTranslation.z);
+        bone[14] = outTranslation.z - (bone[2]*inTranslation.x + bone[6]*inTranslation.y + bone[10]*inTranslation.z);
+        bone[15] = 0.0f;
+    }
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+
+        if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Mesh %i has no connection to bones", m);
+            continue;
+        }
+
+        // Big meshes are split in multiple jobs, run in parallel if supported
+        int jobCount = (mesh.vertexCount + ANIMATION_SKINNING_JOB_VERTICES - 1)/ANIMATION_SKINNING_JOB_VERTICES;
+        bool updatedJobs[64] = { 0 };
+        bool *updated = (jobCount <= 64)? updatedJobs : (bool *)RL_CALLOC(jobCount, sizeof(bool));
+
+        SkinningJobData data = { mesh, boneMatrices, boneRotations, updated };
+
+        if (jobCount > 1) RunParallelJobs(SkinMeshVerticesJob, &data, jobCount);
+        else if (jobCount == 1) SkinMeshVerticesJob(&data, 0);
+
+        bool meshUpdated = false;           // Flag to check when anim vertex information is updated
+        for (int j = 0; j < jobCount; j++) meshUpdated |= updated[j];
+
+        if (updated != updatedJobs) RL_FREE(updated);
+
+        // Upload new vertex data to GPU for model drawing
+        // NOTE: Only update data when values changed
+        if (meshUpdated)
+        {
+            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+        }
+    }
+
+    RL_FREE(boneMatrices);
+    RL_FREE(boneRotations);
+}
+
+// Skin a range of mesh vertices (parallel job)
+// NOTE: Bone matrices are blended by vertex weights (up to 4 bones influence by vertex)
+// and the resulting matrix applied once, bone matrices columns are 4 floats wide,
+// one SSE2/NEON register each, columns are blended and applied with vector multiply-add
+static void SkinMeshVerticesJob(void *data, int jobIndex)
+{
+    SkinningJobData *job = (SkinningJobData *)data;
+    Mesh mesh = job->mesh;
+
+    int first = jobIndex*ANIMATION_SKINNING_JOB_VERTICES;
+    int last = first + ANIMATION_SKINNING_JOB_VERTICES;
+    if (last > mesh.vertexCount) last = mesh.vertexCount;
+
+    bool processNormals = (mesh.normals != NULL) && (mesh.animNormals != NULL);
+    bool updated = false;
+
+    for (int v = first; v < last; v++)
+    {
+        float position[4] = { 0 };
+        float normal[4] = { 0 };
+
+#if defined(RMODELS_SSE2) || defined(RMODELS_NEON)
+        SkinVector skin[4] = { SKIN_ZERO(), SKIN_ZERO(), SKIN_ZERO(), SKIN_ZERO() };
+        SkinVector rotation[3] = { SKIN_ZERO(), SKIN_ZERO(), SKIN_ZERO() };
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            float boneWeight = mesh.boneWeights[v*4 + j];
+
+            // Early stop when no transformation will be applied
+            if (boneWeight == 0.0f) continue;
+
+            int boneId = mesh.boneIds[v*4 + j];
+            const float *bone = &job->boneMatrices[boneId*16];
+            for (int k = 0; k < 4; k++) skin[k] = SKIN_MADD(skin[k], SKIN_LOAD(bone + k*4), boneWeight);
+
+            if (processNormals)
+            {
+                const float *boneRotation = &job->boneRotations[boneId*12];
+                for (int k = 0; k < 3; k++) rotation[k] = SKIN_MADD(rotation[k], SKIN_LOAD(boneRotation + k*4), boneWeight);
+            }
+
+            updated = true;
+        }
+
+        // Vertices processing
+        // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
+        const float *vertex = &mesh.vertices[v*3];
+        SKIN_STORE(position, SKIN_MADD(SKIN_MADD(SKIN_MADD(skin[3], skin[0], vertex[0]), skin[1], vertex[1]), skin[2], vertex[2]));
+
+        // Normals processing
+        // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
+        if (processNormals)
+        {
+            const float *vertexNormal = &mesh.normals[v*3];
+            SKIN_STORE(normal, SKIN_MADD(SKIN_MADD(SKIN_MUL(rotation[0], vertexNormal[0]), rotation[1], vertexNormal[1]), rotation[2], vertexNormal[2]));
+        }
+#else
+        float skin[16] = { 0 };
+        float rotation[12] = { 0 };
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            float boneWeight = mesh.boneWeights[v*4 + j];
+
+            // Early stop when no transformation will be applied
+            if (boneWeight == 0.0f) continue;
+
+            int boneId = mesh.boneIds[v*4 + j];
+            const float *bone = &job->boneMatrices[boneId*16];
+            for (int k = 0; k < 16; k++) skin[k] += bone[k]*boneWeight;
+
+            if (processNormals)
+            {
+                const float *boneRotation = &job->boneRotations[boneId*12];
+                for (int k = 0; k < 12; k++) rotation[k] += boneRotation[k]*boneWeight;
+            }
+
+            updated = true;
+        }
+
+        // Vertices processing
+        // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
+        const float *vertex = &mesh.vertices[v*3];
+        for (int k = 0; k < 3; k++) position[k] = skin[k]*vertex[0] + skin[4 + k]*vertex[1] + skin[8 + k]*vertex[2] + skin[12 + k];
+
+        // Normals processing
+        // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
+        if (processNormals)
+        {
+            const float *vertexNormal = &mesh.normals[v*3];
+            for (int k = 0; k < 3; k++) normal[k] = rotation[k]*vertexNormal[0] + rotation[4 + k]*vertexNormal[1] + rotation[8 + k]*vertexNormal[2];
+        }
+#endif
+        memcpy(&mesh.animVertices[v*3], position, 3*sizeof(float));
+
+        // NOTE: If mesh has no base normals, animated normals are cleared
+        if (mesh.animNormals != NULL) memcpy(&mesh.animNormals[v*3], normal, 3*sizeof(float));
+    }
+
+    job->updated[jobIndex] = updated;
+}
+
+// Upload mesh vertex data into a VAO (if supported) and VBO, compressed as required by flags
+// NOTE: Used by UploadMesh() and UploadMeshCompressed(), compression only applies to static meshes
+static void UploadMeshData(Mesh *mesh, bool dynamic, unsigned int compression)
+{
+    if (mesh->vaoId > 0)
+    {
+        // Check if mesh has already been loaded in GPU
+        TRACELOG(LOG_WARNING, "VAO: [ID %i] Trying to re-load an already loaded mesh", mesh->vaoId);
+        return;
+    }
+
+    mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+
+    mesh->vaoId = 0;        // Vertex Array Object
+    mesh->vboId[0] = 0;     // Vertex buffer: positions
+    mesh->vboId[1] = 0;     // Vertex buffer: texcoords
+    mesh->vboId[2] = 0;     // Vertex buffer: normals
+    mesh->vboId[3] = 0;     // Vertex buffer: colors
+    mesh->vboId[4] = 0;     // Vertex buffer: tangents
+    mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
+    mesh->vboId[6] = 0;     // Vertex buffer: indices
+
+    mesh->compression = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check required vertex data compression, compressed vertex data is static
+    // NOTE: Animated vertex data is updated on GPU with full precision values
+    if (!dynamic) mesh->compression = compression;
+    if ((mesh->vertices == NULL) || (mesh->animVertices != NULL) || (mesh->boneIds != NULL)) mesh->compression &= ~(MESH_COMPRESS_POSITIONS | MESH_COMPRESS_NORMALS);
+    if (mesh->normals == NULL) mesh->compression &= ~MESH_COMPRESS_NORMALS;
+    if (mesh->tangents == NULL) mesh->compression &= ~MESH_COMPRESS_TANGENTS;
+
+    if (mesh->compression & MESH_COMPRESS_TEXCOORDS)
+    {
+        // Texcoords out of [0..1] range (i.e. texture tiling) can not be normalized, kept as floats
+        bool normalized = (mesh->texcoords != NULL);
+        for (int i = 0; normalized && (i < mesh->vertexCount*2); i++) normalized = (mesh->texcoords[i] >= 0.0f) && (mesh->texcoords[i] <= 1.0f);
+
+        if (!normalized) mesh->compression &= ~MESH_COMPRESS_TEXCOORDS;
+    }
+
+    if (mesh->compression & MESH_COMPRESS_POSITIONS)
+    {
+        // Positions quantized to mesh bounds, same scale on all axis,
+        // so dequantization does not modify normals direction
+        Vector3 min = { 0 };
+        Vector3 max = { 0 };
+        Vector3MinMaxArray((Vector3 *)mesh->vertices, mesh->vertexCount, &min, &max);
+
+        float scale = fmaxf(fmaxf(max.x - min.x, max.y - min.y), max.z - min.z)/2.0f;
+        if (scale <= 0.0f) scale = 1.0f;
+
+        mesh->quantization = (Vector4){ (min.x + max.x)/2.0f, (min.y + max.y)/2.0f, (min.z + max.z)/2.0f, scale };
+    }
+
+    mesh->vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(mesh->vaoId);
+
+    // NOTE: Vertex attributes must be uploaded considering default locations points and available vertex data
+
+    // Enable vertex attributes: position (shader-location = 0)
+    float *vertices = (mesh->animVertices != NULL)? mesh->animVertices : mesh->vertices;
+    mesh->vboId[0] = LoadMeshVertexBuffer(mesh, 0, vertices, 3, dynamic);
+    SetMeshVertexAttribute(mesh->compression, 0, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+
+    // Enable vertex attributes: texcoords (shader-location = 1)
+    mesh->vboId[1] = LoadMeshVertexBuffer(mesh, 1, mesh->texcoords, 2, dynamic);
+    SetMeshVertexAttribute(mesh->compression, 1, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+
+    // WARNING: When setting default vertex attribute values, the values for each generic vertex attribute
+    // is part of current state, and it is maintained even if a different program object is used
+
+    if (mesh->normals != NULL)
+    {
+        // Enable vertex attributes: normals (shader-location = 2)
+        float *normals = (mesh->animNormals != NULL)? mesh->animNormals : mesh->normals;
+        mesh->vboId[2] = LoadMeshVertexBuffer(mesh, 2, normals, 3, dynamic);
+        SetMeshVertexAttribute(mesh->compression, 2, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    }
+    else
+    {
+        // Default vertex attribute: normal
+        // WARNING: Default value provided to shader if location available
+        float value[3] = { 1.0f, 1.0f, 1.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, value, SHADER_ATTRIB_VEC3, 3);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    }
+
+    if (mesh->colors != NULL)
+    {
+        // Enable vertex attribute: color (shader-location = 3)
+        mesh->vboId[3] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+    else
+    {
+        // Default vertex attribute: color
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+
+    if (mesh->tangents != NULL)
+    {
+        // Enable vertex attribute: tangent (shader-location = 4)
+        mesh->vboId[4] = LoadMeshVertexBuffer(mesh, 4, mesh->tangents, 4, dynamic);
+        SetMeshVertexAttribute(mesh->compression, 4, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+    }
+    else
+    {
+        // Default vertex attribute: tangent
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+    }
+
+    if (mesh->texcoords2 != NULL)
+    {
+        // Enable vertex attribute: texcoord2 (shader-location = 5)
+        mesh->vboId[5] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+    }
+    else
+    {
+        // Default vertex attribute: texcoord2
+        // WARNING: Default value provided to shader if location available
+        float value[2] = { 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, value, SHADER_ATTRIB_VEC2, 2);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+    }
+
+    if (mesh->indices != NULL)
+    {
+        mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
+    }
+
+    if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
+    else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
+
+    if (mesh->compression != 0) TRACELOG(LOG_DEBUG, "MESH: Vertex data uploaded compressed (flags: 0x%x)", mesh->compression);
+
+    rlDisableVertexArray();
+#endif
+}
+
+// Load mesh vertex buffer into GPU, vertex data compressed if required by mesh compression flags
+// NOTE: Compressed vertex attributes are padded to 4 bytes alignment, compressed buffers are static
+static unsigned int LoadMeshVertexBuffer(const Mesh *mesh, int buffer, const float *data, int components, bool dynamic)
+{
+    unsigned int vboId = 0;
+    int count = mesh->vertexCount;
+
+    if ((buffer == 0) && (mesh->compression & MESH_COMPRESS_POSITIONS))
+    {
+        // Positions as snorm16, relative to mesh bounds: position = offset + scale*value
+        short *values = (short *)RL_MALLOC(count*4*sizeof(short));
+        float iscale = 1.0f/mesh->quantization.w;
+
+        for (int i = 0; i < count; i++)
+        {
+            values[i*4] = (short)roundf(Clamp((data[i*3] - mesh->quantization.x)*iscale, -1.0f, 1.0f)*32767.0f);
+            values[i*4 + 1] = (short)roundf(Clamp((data[i*3 + 1] - mesh->quantization.y)*iscale, -1.0f, 1.0f)*32767.0f);
+            values[i*4 + 2] = (short)roundf(Clamp((data[i*3 + 2] - mesh->quantization.z)*iscale, -1.0f, 1.0f)*32767.0f);
+            values[i*4 + 3] = 32767;    // w = 1.0f
+        }
+
+        vboId = rlLoadVertexBuffer(values, count*4*sizeof(short), false);
+        RL_FREE(values);
+    }
+    else if ((buffer == 1) && (mesh->compression & MESH_COMPRESS_TEXCOORDS))
+    {
+        // Texcoords as unorm16, range checked on mesh upload
+        unsigned short *values = (unsigned short *)RL_MALLOC(count*2*sizeof(unsigned short));
+
+        for (int i = 0; i < count*2; i++) values[i] = (unsigned short)roundf(Clamp(data[i], 0.0f, 1.0f)*65535.0f);
+
+        vboId = rlLoadVertexBuffer(values, count*2*sizeof(unsigned short), false);
+        RL_FREE(values);
+    }
+    else if (((buffer == 2) && (mesh->compression & MESH_COMPRESS_NORMALS)) ||
+             ((buffer == 4) && (mesh->compression & MESH_COMPRESS_TANGENTS)))
+    {
+        // Normals and tangents as snorm8, normals padded to 4 components
+        signed char *values = (signed char *)RL_CALLOC(count*4, sizeof(signed char));
+
+        for (int i = 0; i < count; i++)
+        {
+            for (int c = 0; c < components; c++) values[i*4 + c] = (signed char)roundf(Clamp(data[i*components + c], -1.0f, 1.0f)*127.0f);
+        }
+
+        vboId = rlLoadVertexBuffer(values, count*4*sizeof(signed char), false);
+        RL_FREE(values);
+    }
+    else vboId = rlLoadVertexBuffer(data, count*components*sizeof(float), dynamic);
+
+    return vboId;
+}
+
+// Set mesh vertex buffer attribute format for a shader location, considering mesh compression flags
+static void SetMeshVertexAttribute(unsigned int compression, int buffer, int location)
+{
+    switch (buffer)
+    {
+        case 0:     // Positions
+        {
+            if (compression & MESH_COMPRESS_POSITIONS) rlSetVertexAttribute(location, 4, RL_SHORT, 1, 0, 0);
+            else rlSetVertexAttribute(location, 3, RL_FLOAT, 0, 0, 0);
+        } break;
+        case 1:     // Texcoords
+        {
+            if (compression & MESH_COMPRESS_TEXCOORDS) rlSetVertexAttribute(location, 2, RL_UNSIGNED_SHORT, 1, 0, 0);
+            else rlSetVertexAttribute(location, 2, RL_FLOAT, 0, 0, 0);
+        } break;
+        case 2:     // Normals
+        {
+            if (compression & MESH_COMPRESS_NORMALS) rlSetVertexAttribute(location, 4, RL_BYTE, 1, 0, 0);
+            else rlSetVertexAttribute(location, 3, RL_FLOAT, 0, 0, 0);
+        } break;
+        case 4:     // Tangents
+        {
+            if (compression & MESH_COMPRESS_TANGENTS) rlSetVertexAttribute(location, 4, RL_BYTE, 1, 0, 0);
+            else rlSetVertexAttribute(location, 4, RL_FLOAT, 0, 0, 0);
+        } break;
+        default: break;
+    }
+}
+
+// Get vertex score for triangles reordering, considering vertex cache position and remaining triangles
+// NOTE: Scoring based on Tom Forsyth linear-speed vertex cache optimization algorithm
+static float GetVertexCacheScore(int cachePosition, int valence)
+{
+    float score = -1.0f;
+
+    if (valence > 0)
+    {
+        score = 0.0f;
+
+        if (cachePosition >= 0)
+        {
+            // Vertices used by last triangle scored equally, triangle winding not prioritized
+            if (cachePosition < 3) score = 0.75f;
+            else score = powf(1.0f - (float)(cachePosition - 3)/(MESH_VERTEX_CACHE_SIZE - 3), 1.5f);
+        }
+
+        // Vertices with few remaining triangles boosted, so no isolated triangles are left behind
+        score += 2.0f/sqrtf((float)valence);
+    }
+
+    return score;
+}
+
+// Reorder triangles for post-transform vertex cache locality
+// NOTE: Greedy triangles selection, next triangle is the best scored one between triangles using cached vertices
+static void OptimizeMeshVertexCache(unsigned int *indices, int indexCount, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+
+    // Vertex-triangles adjacency, remaining triangles per vertex are kept at the start of every vertex list
+    int *valence = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *offsets = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+
+    for (int i = 0; i < indexCount; i++) valence[indices[i]]++;
+
+    offsets[0] = 0;
+    for (int v = 0; v < vertexCount; v++)
+    {
+        offsets[v + 1] = offsets[v] + valence[v];
+        valence[v] = 0;
+    }
+
+    for (int i = 0; i < indexCount; i++) adjacency[offsets[indices[i]] + valence[indices[i]]++] = i/3;
+
+    int *cachePositions = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScores = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    float *triangleScores = (float *)RL_MALLOC(triangleCount*sizeof(float));
+    bool *emitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    unsigned int *output = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePositions[v] = -1;
+        vertexScores[v] = GetVertexCacheScore(-1, valence[v]);
+    }
+
+    int bestTriangle = 0;
+    float bestScore = -1.0f;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+
+        if (triangleScores[t] > bestScore)
+        {
+            bestScore = triangleScores[t];
+            bestTriangle = t;
+        }
+    }
+
+    int cache[MESH_VERTEX_CACHE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+    int nextTriangle = 0;       // Next triangle not emitted, used when no cached vertex triangles available
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        if (bestTriangle < 0)
+        {
+            while (emitted[nextTriangle]) nextTriangle++;
+            bestTriangle = nextTriangle;
+        }
+
+        int triangle = bestTriangle;
+        emitted[triangle] = true;
+
+        // Emit triangle vertices to front of cache, removing triangle from vertices adjacency
+        int newCache[MESH_VERTEX_CACHE_SIZE + 3] = { 0 };
+        int newCacheCount = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            int v = indices[triangle*3 + k];
+            output[i*3 + k] = v;
+
+            int *list = adjacency + offsets[v];
+            for (int j = 0; j < valence[v]; j++)
+            {
+                if (list[j] == triangle)
+                {
+                    list[j] = list[valence[v] - 1];
+                    valence[v]--;
+                    break;
+                }
+            }
+
+            bool cached = false;
+            for (int j = 0; j < newCacheCount; j++) if (newCache[j] == v) cached = true;
+            if (!cached) newCache[newCacheCount++] = v;
+        }
+
+        int emittedCount = newCacheCount;
+        for (int j = 0; j < cacheCount; j++)
+        {
+            bool cached = false;
+            for (int k = 0; k < emittedCount; k++) if (newCache[k] == cache[j]) cached = true;
+            if (!cached) newCache[newCacheCount++] = cache[j];
+        }
+
+        // Update cached vertices scores, vertices pushed out of cache lose their position
+        for (int j = 0; j < newCacheCount; j++)
+        {
+            int v = newCache[j];
+            cachePositions[v] = (j < MESH_VERTEX_CACHE_SIZE)? j : -1;
+            vertexScores[v] = GetVertexCacheScore(cachePositions[v], valence[v]);
+        }
+
+        // Update remaining triangles scores for updated vertices, select best triangle
+        bestTriangle = -1;
+        bestScore = -1.0f;
+
+        for (int j = 0; j < newCacheCount; j++)
+        {
+            int v = newCache[j];
+            const int *list = adjacency + offsets[v];
+
+            for (int a = 0; a < valence[v]; a++)
+            {
+                int t = list[a];
+                triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+
+                if (triangleScores[t] > bestScore)
+                {
+                    bestScore = triangleScores[t];
+                    bestTriangle = t;
+                }
+            }
+        }
+
+        cacheCount = (newCacheCount < MESH_VERTEX_CACHE_SIZE)? newCacheCount : MESH_VERTEX_CACHE_SIZE;
+        for (int j = 0; j < cacheCount; j++) cache[j] = newCache[j];
+    }
+
+    memcpy(indices, output, indexCount*sizeof(unsigned int));
+
+    RL_FREE(valence);
+    RL_FREE(offsets);
+    RL_FREE(adjacency);
+    RL_FREE(cachePositions);
+    RL_FREE(vertexScores);
+    RL_FREE(triangleScores);
+    RL_FREE(emitted);
+    RL_FREE(output);
+}
+
 // Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
+// NOTE: Required for animations loading (required by IQM and GLTF) and animations blending
 static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
 {
     for (int i = 0; i < boneCount; i++)
@@ -4018,7 +5059,28 @@ static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform
         }
     }
 }
-#endif
+
+// Get local pose (relative to parent joints) from model space pose
+// NOTE: Inverse of BuildPoseFromParentJoints(), local transform = inverse(parent)*transform
+static void GetLocalPoseFromParentJoints(BoneInfo *bones, int boneCount, const Transform *transforms, Transform *localTransforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        localTransforms[i] = transforms[i];
+
+        if ((bones[i].parent >= 0) && (bones[i].parent < i))
+        {
+            Transform parent = transforms[bones[i].parent];
+            Quaternion invRotation = QuaternionInvert(parent.rotation);
+
+            localTransforms[i].rotation = QuaternionMultiply(invRotation, transforms[i].rotation);
+            localTransforms[i].translation = Vector3RotateByQuaternion(Vector3Subtract(transforms[i].translation, parent.translation), invRotation);
+            localTransforms[i].scale.x = (parent.scale.x != 0.0f)? transforms[i].scale.x/parent.scale.x : 0.0f;
+            localTransforms[i].scale.y = (parent.scale.y != 0.0f)? transforms[i].scale.y/parent.scale.y : 0.0f;
+            localTransforms[i].scale.z = (parent.scale.z != 0.0f)? transforms[i].scale.z/parent.scale.z : 0.0f;
+        }
+    }
+}
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
@@ -4621,7 +5683,11 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
         animations[a].boneCount = iqmHeader->num_poses;
         animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
         animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
-        // animations[a].framerate = anim.framerate;     // TODO: Use animation framerate data?
+        animations[a].frameTimes = RL_MALLOC(anim[a].num_frames*sizeof(float));
+
+        // Frames are evenly spaced by animation framerate, 60 fps by default
+        float frameDelay = (anim[a].framerate > 0.0f)? 1.0f/anim[a].framerate : 1.0f/60.0f;
+        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].frameTimes[j] = (float)j*frameDelay;
 
         for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
         {
@@ -5658,6 +6724,17 @@ static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_
 
 #define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
 
+#if defined(SUPPORT_GLTF_ANIMATION_KEYFRAMES)
+// Compare keyframes times (qsort callback)
+static int CompareKeyframeTimesGLTF(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+#endif
+
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
     // glTF file loading
@@ -5765,13 +6842,76 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
                 strncpy(animations[i].name, animData.name, sizeof(animations[i].name));
                 animations[i].name[sizeof(animations[i].name) - 1] = '\0';
 
-                animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY) + 1;
+                animations[i].frameCount = 0;
+                animations[i].frameTimes = NULL;
+
+#if defined(SUPPORT_GLTF_ANIMATION_KEYFRAMES)
+                // Only keep poses at channels keyframes times, instead of resampling animation at GLTF_ANIMDELAY,
+                // poses in-between keyframes are interpolated by UpdateModelAnimationEx()
+                // NOTE: Step and cubic spline channels can not be linearly interpolated between keyframes, they are resampled
+                int keyCount = 0;
+                bool linearChannels = true;
+
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    cgltf_animation_channel *channels[3] = { boneChannels[k].translate, boneChannels[k].rotate, boneChannels[k].scale };
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        if (channels[c] == NULL) continue;
+                        if (channels[c]->sampler->interpolation != cgltf_interpolation_type_linear) linearChannels = false;
+                        keyCount += (int)channels[c]->sampler->input->count;
+                    }
+                }
+
+                if (linearChannels && (keyCount > 0))
+                {
+                    animations[i].frameTimes = RL_MALLOC(keyCount*sizeof(float));
+
+                    for (int k = 0; k < animations[i].boneCount; k++)
+                    {
+                        cgltf_animation_channel *channels[3] = { boneChannels[k].translate, boneChannels[k].rotate, boneChannels[k].scale };
+
+                        for (int c = 0; c < 3; c++)
+                        {
+                            if (channels[c] == NULL) continue;
+
+                            for (unsigned int t = 0; t < channels[c]->sampler->input->count; t++)
+                            {
+                                float keyTime = 0.0f;
+                                cgltf_accessor_read_float(channels[c]->sampler->input, t, &keyTime, 1);
+                                animations[i].frameTimes[animations[i].frameCount++] = keyTime;
+                            }
+                        }
+                    }
+
+                    // Sort keyframes times and remove duplicates
+                    qsort(animations[i].frameTimes, animations[i].frameCount, sizeof(float), CompareKeyframeTimesGLTF);
+
+                    int uniqueCount = 1;
+                    for (int k = 1; k < animations[i].frameCount; k++)
+                    {
+                        if ((animations[i].frameTimes[k] - animations[i].frameTimes[uniqueCount - 1]) > EPSILON) animations[i].frameTimes[uniqueCount++] = animations[i].frameTimes[k];
+                    }
+
+                    animations[i].frameCount = uniqueCount;
+                }
+#endif
+                // Resample animation at evenly spaced frames
+                if (animations[i].frameTimes == NULL)
+                {
+                    animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY) + 1;
+                    animations[i].frameTimes = RL_MALLOC(animations[i].frameCount*sizeof(float));
+
+                    for (int j = 0; j < animations[i].frameCount; j++) animations[i].frameTimes[j] = ((float)j*GLTF_ANIMDELAY)/1000.0f;
+                }
+
                 animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(Transform *));
 
                 for (int j = 0; j < animations[i].frameCount; j++)
                 {
                     animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(Transform));
-                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
+                    float time = animations[i].frameTimes[j];
 
                     for (int k = 0; k < animations[i].boneCount; k++)
                     {
@@ -6323,6 +7463,7 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
             animations[a].boneCount = m3d->numbone + 1;
             animations[a].bones = RL_MALLOC((m3d->numbone + 1)*sizeof(BoneInfo));
             animations[a].framePoses = RL_MALLOC(animations[a].frameCount*sizeof(Transform *));
+            animations[a].frameTimes = RL_MALLOC(animations[a].frameCount*sizeof(float));
             strncpy(animations[a].name, m3d->action[a].name, sizeof(animations[a].name));
             animations[a].name[sizeof(animations[a].name) - 1] = '\0';
 
@@ -6343,6 +7484,7 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
             for (i = 0; i < animations[a].frameCount; i++)
             {
                 animations[a].framePoses[i] = RL_MALLOC((m3d->numbone + 1)*sizeof(Transform));
+                animations[a].frameTimes[i] = (float)(i*M3D_ANIMDELAY)/1000.0f;
 
                 m3db_t *pose = m3d_pose(m3d, a, i*M3D_ANIMDELAY);
 
@@ -725,22 +725,24 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
 
+    float left = shapeRect.x/texShapes.width;
+    float right = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float top = shapeRect.y/texShapes.height;
+    float bottom = (shapeRect.y + shapeRect.height)/texShapes.height;
+
+    rlQuad quad = {
+        .vertices = {
+            { topLeft.x, topLeft.y, left, top, color.r, color.g, color.b, color.a },
+            { bottomLeft.x, bottomLeft.y, left, bottom, color.r, color.g, color.b, color.a },
+            { bottomRight.x, bottomRight.y, right, bottom, color.r, color.g, color.b, color.a },
+            { topRight.x, topRight.y, right, top, color.r, color.g, color.b, color.a }
+        }
+    };
+
     rlBegin(RL_QUADS);
 
         rlNormal3f(0.0f, 0.0f, 1.0f);
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
+        rlPushQuads(&quad, 1);
 
     rlEnd();
 
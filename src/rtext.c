@@ -21,6 +21,10 @@
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 *           drawing text and shapes with a single draw call [SetShapesTexture()].
 *
+*       #define SUPPORT_FONT_GLYPH_CACHE
+*           Support dynamic fonts [LoadFontDynamic()], glyphs are rasterized on first use and packed
+*           into a growable atlas, least recently used glyphs are evicted under a memory budget.
+*
 *       #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *           TextSplit() function static buffer max size
 *
@@ -62,7 +66,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXT)
 
-#include "utils.h"          // Required for: LoadFile*()
+#include "utils.h"          // Required for: LoadFile*(), RunParallelJobs()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
 
 #include <stdlib.h>         // Required for: malloc(), free()
@@ -116,10 +120,73 @@
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
 
+// NOTE: Using some SDF generation default values,
+// trades off precision with ability to handle *smaller* sizes
+#ifndef FONT_SDF_CHAR_PADDING
+    #define FONT_SDF_CHAR_PADDING                  4        // SDF font generation char padding
+#endif
+#ifndef FONT_SDF_ON_EDGE_VALUE
+    #define FONT_SDF_ON_EDGE_VALUE               128        // SDF font generation on edge value
+#endif
+#ifndef FONT_SDF_PIXEL_DIST_SCALE
+    #define FONT_SDF_PIXEL_DIST_SCALE          64.0f        // SDF font generation pixel distance scale
+#endif
+#ifndef FONT_BITMAP_ALPHA_THRESHOLD
+    #define FONT_BITMAP_ALPHA_THRESHOLD           80        // Bitmap (B&W) font generation alpha threshold
+#endif
+#ifndef TEXT_LAYOUT_QUADS_CHUNK
+    #define TEXT_LAYOUT_QUADS_CHUNK               64        // Maximum number of glyphs quads pushed at once: DrawTextLayout()
+#endif
+
+// Glyph lookup table hashing (Fibonacci hashing), maps a codepoint to a table slot of 2^bits slots
+#define GLYPH_LOOKUP_HASH(codepoint, bits) (int)(((unsigned int)(codepoint)*2654435769u) >> (32 - (bits)))
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Glyphs rasterization job data, one job per codepoint
+typedef struct FontGlyphsJobData {
+    const stbtt_fontinfo *fontInfo; // Font info for glyphs rasterization
+    const int *codepoints;          // Codepoints to rasterize
+    GlyphInfo *glyphs;              // Output glyphs, same order as codepoints
+    int fontSize;                   // Font size
+    float scaleFactor;              // Font scale factor for required font size
+    int ascent;                     // Font ascent (baseline)
+    int type;                       // Font type (FONT_DEFAULT, FONT_BITMAP, FONT_SDF)
+} FontGlyphsJobData;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+// Dynamic glyphs cache, glyphs are rasterized on first use and packed into a growable atlas
+// NOTE: Font glyphs, recs and glyphLookup point to cache arrays, sized for cache capacity,
+// loaded glyphs are kept compacted in first glyphCount slots
+struct rGlyphCache {
+    unsigned char *fileData;        // Font file data, kept loaded for glyphs rasterization
+    stbtt_fontinfo fontInfo;        // Font info for glyphs rasterization
+    float scaleFactor;              // Font scale factor for required font size
+    int ascent;                     // Font ascent (baseline), scaled
+    int fontSize;                   // Font size used for glyphs rasterization
+    int padding;                    // Padding around glyphs in atlas
+
+    int capacity;                   // Number of glyph slots available
+    int glyphCount;                 // Number of glyphs loaded
+    GlyphInfo *glyphs;              // Glyphs info data (capacity)
+    Rectangle *recs;                // Glyphs rectangles in atlas (capacity)
+    int *lookup;                    // Glyphs lookup table by codepoint
+    unsigned long long *lastUsed;   // Glyphs last use counter (0 for free slots)
+    unsigned long long useCounter;  // Glyphs use counter, increased on every glyph access
+    unsigned long long pinnedUse;   // Glyphs used since this counter value are not evicted (0 if none pinned)
+
+    int memoryBudget;               // Atlas and glyphs images maximum size in bytes (GRAY_ALPHA)
+    int imageMemory;                // Glyphs images size in bytes, kept for atlas repacking
+    int atlasWidth;                 // Atlas required width
+    int atlasHeight;                // Atlas required height
+    Texture2D texture;              // Atlas texture
+    stbrp_context packer;           // Atlas rectangles packer
+    stbrp_node *nodes;              // Atlas rectangles packer nodes (atlasWidth)
+};
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -144,6 +211,22 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static int *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);  // Load glyphs lookup table by codepoint
+static int GetGlyphLookupIndex(const int *lookup, const GlyphInfo *glyphs, int codepoint); // Get glyph index from lookup table
+static void SetGlyphLookupIndex(int *lookup, const GlyphInfo *glyphs, int index); // Set glyph index into lookup table
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static GlyphInfo LoadGlyphTTF(const stbtt_fontinfo *fontInfo, int codepoint, int fontSize, float scaleFactor, int ascent, int type); // Load glyph data from TTF font
+static void LoadFontGlyphsJob(void *data, int jobIndex);            // Glyph rasterization job, used by LoadFontData()
+#endif
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+static int LoadGlyphCached(rGlyphCache *cache, int codepoint);      // Get glyph index from dynamic glyphs cache, loading glyph if required
+static int EvictGlyphCache(rGlyphCache *cache);                     // Evict least recently used glyphs from dynamic glyphs cache
+static void CompactGlyphCache(rGlyphCache *cache);                  // Compact dynamic glyphs cache, loaded glyphs moved to first slots
+static bool PackGlyphCache(rGlyphCache *cache);                     // Pack all glyphs in dynamic glyphs cache into atlas texture
+static void LoadGlyphLookupCached(rGlyphCache *cache);              // Load glyphs lookup table for dynamic glyphs cache
+static void UnloadGlyphCache(rGlyphCache *cache);                   // Unload dynamic glyphs cache
+static int CompareGlyphLastUsed(const void *a, const void *b);      // Compare glyphs last use counters
+#endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -300,6 +383,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -311,6 +395,7 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphLookup);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -520,6 +605,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -572,6 +658,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -582,6 +670,113 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font for dynamic glyphs rasterization, glyphs are rasterized and packed into atlas on first use
+// NOTE: Font file data is kept loaded, atlas texture and glyphs images grow up to memoryBudget bytes,
+// least recently used glyphs are evicted when atlas is full
+Font LoadFontDynamic(const char *fileName, int fontSize, int memoryBudget)
+{
+#ifndef FONT_GLYPH_CACHE_DEFAULT_BUDGET
+    #define FONT_GLYPH_CACHE_DEFAULT_BUDGET   4*1024*1024   // Dynamic font default atlas memory budget (2048x1024 GRAY_ALPHA)
+#endif
+#ifndef FONT_GLYPH_CACHE_ATLAS_SIZE
+    #define FONT_GLYPH_CACHE_ATLAS_SIZE              256    // Dynamic font starting atlas size (width and height)
+#endif
+
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (fontSize <= 0) fontSize = FONT_TTF_DEFAULT_SIZE;
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        rGlyphCache *cache = (rGlyphCache *)RL_CALLOC(1, sizeof(rGlyphCache));
+
+        if (stbtt_InitFont(&cache->fontInfo, fileData, 0))
+        {
+            int ascent, descent, lineGap;
+            stbtt_GetFontVMetrics(&cache->fontInfo, &ascent, &descent, &lineGap);
+
+            cache->fileData = fileData;
+            cache->fontSize = fontSize;
+            cache->scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+            cache->ascent = ascent;
+            cache->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            cache->memoryBudget = (memoryBudget > 0)? memoryBudget : FONT_GLYPH_CACHE_DEFAULT_BUDGET;
+
+            // Starting atlas size, reduced if memory budget is smaller
+            cache->atlasWidth = FONT_GLYPH_CACHE_ATLAS_SIZE;
+            cache->atlasHeight = FONT_GLYPH_CACHE_ATLAS_SIZE;
+            while ((cache->atlasWidth > 16) && ((cache->atlasWidth*cache->atlasHeight*2) > cache->memoryBudget))
+            {
+                cache->atlasWidth /= 2;
+                cache->atlasHeight /= 2;
+            }
+
+            // Glyph slots available, estimated from glyphs that would fit in the memory budget
+            cache->capacity = cache->memoryBudget/(fontSize*fontSize);
+            if (cache->capacity < 128) cache->capacity = 128;
+            if (cache->capacity > 65536) cache->capacity = 65536;
+
+            int bits = 1;
+            while ((1 << bits) < 2*cache->capacity) bits++;
+
+            cache->glyphs = (GlyphInfo *)RL_CALLOC(cache->capacity, sizeof(GlyphInfo));
+            cache->recs = (Rectangle *)RL_CALLOC(cache->capacity, sizeof(Rectangle));
+            cache->lastUsed = (unsigned long long *)RL_CALLOC(cache->capacity, sizeof(unsigned long long));
+            cache->lookup = (int *)RL_MALLOC(((1 << bits) + 2)*sizeof(int));
+            cache->lookup[0] = bits;
+            cache->lookup[1] = 0;
+            LoadGlyphLookupCached(cache);
+
+            PackGlyphCache(cache);      // Load empty atlas texture
+
+            // Load fallback glyph '?', never evicted from cache
+            cache->lookup[1] = LoadGlyphCached(cache, 63);
+
+            font.baseSize = fontSize;
+            font.glyphCount = cache->glyphCount;
+            font.glyphPadding = cache->padding;
+            font.texture = cache->texture;
+            font.recs = cache->recs;
+            font.glyphs = cache->glyphs;
+            font.glyphLookup = cache->lookup;
+            font.glyphCache = cache;
+
+            TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully (%i pixel size | %i bytes atlas budget)", fileName, fontSize, cache->memoryBudget);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: [%s] Failed to process TTF font data", fileName);
+            UnloadFileData(fileData);
+            RL_FREE(cache);
+        }
+    }
+#else
+    TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic font loading not supported", fileName);
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+
+// Update dynamic font atlas texture and glyph count
+// NOTE: Atlas texture could be recreated when glyphs are loaded (atlas growth),
+// font copies keep previous texture and glyph count until updated
+void UpdateFontDynamic(Font *font)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+    if ((font != NULL) && (font->glyphCache != NULL))
+    {
+        font->texture = font->glyphCache->texture;
+        font->glyphCount = font->glyphCache->glyphCount;
+    }
+#endif
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
@@ -599,21 +794,6 @@ bool IsFontReady(Font font)
 // NOTE: Requires TTF font memory data and can generate SDF data
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
-    // NOTE: Using some SDF generation default values,
-    // trades off precision with ability to handle *smaller* sizes
-#ifndef FONT_SDF_CHAR_PADDING
-    #define FONT_SDF_CHAR_PADDING            4      // SDF font generation char padding
-#endif
-#ifndef FONT_SDF_ON_EDGE_VALUE
-    #define FONT_SDF_ON_EDGE_VALUE         128      // SDF font generation on edge value
-#endif
-#ifndef FONT_SDF_PIXEL_DIST_SCALE
-    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
-#endif
-#ifndef FONT_BITMAP_ALPHA_THRESHOLD
-    #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
-#endif
-
     GlyphInfo *chars = NULL;
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
@@ -648,80 +828,10 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
-
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
-
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
-            }
+            // Rasterize glyphs in parallel jobs, every job writes only its own glyph
+            // NOTE: Output order is the same as codepoints order, independently of workers count
+            FontGlyphsJobData jobData = { &fontInfo, codepoints, chars, fontSize, scaleFactor, ascent, type };
+            RunParallelJobs(LoadFontGlyphsJob, &jobData, codepointCount);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -947,12 +1057,23 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 // Unload Font from GPU memory (VRAM)
 void UnloadFont(Font font)
 {
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL)
+    {
+        UnloadGlyphCache(font.glyphCache);
+
+        TRACELOGD("FONT: Unloaded dynamic font data from RAM and VRAM");
+        return;
+    }
+#endif
+
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphLookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1156,6 +1277,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    PROFILE_ZONE_BEGIN("DrawTextEx");
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -1182,6 +1305,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    PROFILE_ZONE_END();
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1219,7 +1344,12 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    // NOTE: Dynamic fonts atlas texture could be recreated on atlas growth
+    Texture2D texture = font.texture;
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL) texture = font.glyphCache->texture;
+#endif
+    DrawTexturePro(texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1253,6 +1383,182 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     }
 }
 
+// Load text layout, glyphs placement ready to be drawn with DrawTextLayout()
+// NOTE: Layout is computed once, same as DrawTextEx(), current text line spacing is used
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if (text == NULL) text = "";
+
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    layout.font = font;
+    layout.text = (char *)RL_CALLOC(size + 1, 1);
+    memcpy(layout.text, text, size);
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+    layout.size = MeasureTextEx(font, text, fontSize, spacing);
+
+    // NOTE: Arrays are allocated for the worst case, one glyph per byte
+    layout.codepoints = (int *)RL_MALLOC(size*sizeof(int));
+    layout.indices = (int *)RL_MALLOC(size*sizeof(int));
+    layout.positions = (Vector2 *)RL_MALLOC(size*sizeof(Vector2));
+
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Glyph quad position, considering glyph offsets and padding, same as DrawTextCodepoint()
+                layout.codepoints[layout.glyphCount] = codepoint;
+                layout.indices[layout.glyphCount] = index;
+                layout.positions[layout.glyphCount] = (Vector2){ textOffsetX + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                                                                 textOffsetY + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor };
+                layout.glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    return layout;
+}
+
+// Update text layout, only recomputed if any of the inputs changed, returns true if recomputed
+bool UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing)
+{
+    bool updated = false;
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if (text == NULL) text = "";
+
+    if ((layout->text == NULL) ||
+        (layout->font.glyphs != font.glyphs) ||
+        (layout->font.baseSize != font.baseSize) ||
+        (layout->fontSize != fontSize) ||
+        (layout->spacing != spacing) ||
+        (strcmp(layout->text, text) != 0))
+    {
+        UnloadTextLayout(*layout);
+        *layout = LoadTextLayout(font, text, fontSize, spacing);
+        updated = true;
+    }
+
+    return updated;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.text);
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.indices);
+    RL_FREE(layout.positions);
+}
+
+// Draw text layout, all glyphs quads are pushed in a single batch
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    Font font = layout.font;
+    Texture2D texture = font.texture;
+
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL)
+    {
+        // Dynamic fonts glyphs could have been evicted or moved in atlas, load them before drawing
+        // NOTE: Layout glyphs are pinned while loading, so a glyph load does not evict previous ones,
+        // glyphs indices are resolved once all glyphs are loaded (eviction moves cache slots)
+        rGlyphCache *cache = font.glyphCache;
+
+        cache->pinnedUse = cache->useCounter + 1;
+        for (int i = 0; i < layout.glyphCount; i++) LoadGlyphCached(cache, layout.codepoints[i]);
+        cache->pinnedUse = 0;
+
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            int index = GetGlyphLookupIndex(cache->lookup, cache->glyphs, layout.codepoints[i]);
+            layout.indices[i] = (index != -1)? index : cache->lookup[1];
+        }
+
+        // NOTE: Atlas texture could be recreated while loading glyphs
+        texture = cache->texture;
+    }
+#endif
+
+    if ((texture.id == 0) || (layout.glyphCount == 0)) return;
+
+    float scaleFactor = layout.fontSize/font.baseSize;  // Character quad scaling factor
+    float padding = 2.0f*font.glyphPadding;
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+
+    rlQuad quads[TEXT_LAYOUT_QUADS_CHUNK];
+    int quadCount = 0;
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            Rectangle rec = font.recs[layout.indices[i]];
+
+            // Character source rectangle from font texture atlas, considering chars padding
+            float srcX = rec.x - (float)font.glyphPadding;
+            float srcY = rec.y - (float)font.glyphPadding;
+            float srcWidth = rec.width + padding;
+            float srcHeight = rec.height + padding;
+
+            // Character destination rectangle on screen
+            float dstX = position.x + layout.positions[i].x;
+            float dstY = position.y + layout.positions[i].y;
+            float dstWidth = srcWidth*scaleFactor;
+            float dstHeight = srcHeight*scaleFactor;
+
+            rlQuadVertex *vertices = quads[quadCount].vertices;
+
+            // Quad vertex: top-left, bottom-left, bottom-right, top-right
+            vertices[0] = (rlQuadVertex){ dstX, dstY, srcX/width, srcY/height, tint.r, tint.g, tint.b, tint.a };
+            vertices[1] = (rlQuadVertex){ dstX, dstY + dstHeight, srcX/width, (srcY + srcHeight)/height, tint.r, tint.g, tint.b, tint.a };
+            vertices[2] = (rlQuadVertex){ dstX + dstWidth, dstY + dstHeight, (srcX + srcWidth)/width, (srcY + srcHeight)/height, tint.r, tint.g, tint.b, tint.a };
+            vertices[3] = (rlQuadVertex){ dstX + dstWidth, dstY, (srcX + srcWidth)/width, srcY/height, tint.r, tint.g, tint.b, tint.a };
+            quadCount++;
+
+            // Push glyphs quads by chunks, quads data is kept on stack
+            if ((quadCount == TEXT_LAYOUT_QUADS_CHUNK) || (i == (layout.glyphCount - 1)))
+            {
+                rlPushQuads(quads, quadCount);
+                quadCount = 0;
+            }
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Set vertical line spacing when drawing with line-breaks
 void SetTextLineSpacing(int spacing)
 {
@@ -1339,26 +1645,36 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
-#define SUPPORT_UNORDERED_CHARSET
-#if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+    if (font.glyphCache != NULL) index = LoadGlyphCached(font.glyphCache, codepoint);
+    else
+#endif
+    if (font.glyphLookup != NULL)
+    {
+        // Fonts loaded by raylib provide a hashed lookup table, fallback index is cached
+        index = GetGlyphLookupIndex(font.glyphLookup, font.glyphs, codepoint);
 
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
+        if (index == -1) index = font.glyphLookup[1];
+    }
+    else
     {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
+        // Look for character index in the unordered charset
+        // NOTE: Required for fonts not loaded by raylib (i.e. user-filled glyphs arrays)
+        int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
-        if (font.glyphs[i].value == codepoint)
+        for (int i = 0; i < font.glyphCount; i++)
         {
-            index = i;
-            break;
+            if (font.glyphs[i].value == 63) fallbackIndex = i;
+
+            if (font.glyphs[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
         }
-    }
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
-#else
-    index = codepoint - 32;
-#endif
+        if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+    }
 
     return index;
 }
@@ -2079,6 +2395,72 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Get glyph index for a codepoint from glyphs lookup table, returns -1 if not found
+static int GetGlyphLookupIndex(const int *lookup, const GlyphInfo *glyphs, int codepoint)
+{
+    int index = -1;
+    int bits = lookup[0];
+    const int *slots = lookup + 2;
+    int slot = GLYPH_LOOKUP_HASH(codepoint, bits);
+
+    // Linear probing until the codepoint or an empty slot is found
+    while (slots[slot] != -1)
+    {
+        if (glyphs[slots[slot]].value == codepoint)
+        {
+            index = slots[slot];
+            break;
+        }
+
+        slot = (slot + 1) & ((1 << bits) - 1);
+    }
+
+    return index;
+}
+
+// Set glyph index into glyphs lookup table, keyed by the glyph codepoint
+// NOTE: On duplicated codepoints the first glyph set is kept
+static void SetGlyphLookupIndex(int *lookup, const GlyphInfo *glyphs, int index)
+{
+    int bits = lookup[0];
+    int *slots = lookup + 2;
+    int slot = GLYPH_LOOKUP_HASH(glyphs[index].value, bits);
+
+    while ((slots[slot] != -1) && (glyphs[slots[slot]].value != glyphs[index].value)) slot = (slot + 1) & ((1 << bits) - 1);
+
+    if (slots[slot] == -1) slots[slot] = index;
+}
+
+// Load glyphs lookup table by codepoint, used by GetGlyphIndex()
+// NOTE: Open addressing hash table, kept under 50% load: [0] hash bits, [1] fallback glyph index ('?'), [2..] slots (-1 if empty)
+static int *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    int *lookup = NULL;
+
+    if ((glyphs != NULL) && (glyphCount > 0))
+    {
+        int bits = 1;
+        while ((1 << bits) < 2*glyphCount) bits++;
+
+        int slotCount = 1 << bits;
+        lookup = (int *)RL_MALLOC((slotCount + 2)*sizeof(int));
+        lookup[0] = bits;
+        lookup[1] = 0;
+
+        int *slots = lookup + 2;
+        for (int i = 0; i < slotCount; i++) slots[i] = -1;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            SetGlyphLookupIndex(lookup, glyphs, i);
+
+            if ((glyphs[i].value == 63) && (glyphs[lookup[1]].value != 63)) lookup[1] = i;  // Cache fallback glyph '?'
+        }
+    }
+
+    return lookup;
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2246,6 +2628,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -2510,4 +2894,370 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load glyph data (including pixel data) for a codepoint from TTF font
+// NOTE: Returned glyph image is GRAYSCALE, image.data is NULL if glyph is not available in the font
+static GlyphInfo LoadGlyphTTF(const stbtt_fontinfo *fontInfo, int codepoint, int fontSize, float scaleFactor, int ascent, int type)
+{
+    GlyphInfo glyph = { 0 };
+    int chw = 0, chh = 0;   // Character width and height (on generation)
+    int ch = codepoint;     // Character value to get info for
+    glyph.value = ch;
+
+    //  Render a unicode codepoint to a bitmap
+    //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+    //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+    //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+    // Check if a glyph is available in the font
+    // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+    int index = stbtt_FindGlyphIndex(fontInfo, ch);
+
+    if (index > 0)
+    {
+        switch (type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP: glyph.image.data = stbtt_GetCodepointBitmap(fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &glyph.offsetX, &glyph.offsetY); break;
+            case FONT_SDF: if (ch != 32) glyph.image.data = stbtt_GetCodepointSDF(fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph.offsetX, &glyph.offsetY); break;
+            default: break;
+        }
+
+        if (glyph.image.data != NULL)    // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(fontInfo, ch, &glyph.advanceX, NULL);
+            glyph.advanceX = (int)((float)glyph.advanceX*scaleFactor);
+
+            // Load characters images
+            glyph.image.width = chw;
+            glyph.image.height = chh;
+            glyph.image.mipmaps = 1;
+            glyph.image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+            glyph.offsetY += (int)((float)ascent*scaleFactor);
+        }
+
+        // NOTE: We create an empty image for space character,
+        // it could be further required for atlas packing
+        if (ch == 32)
+        {
+            stbtt_GetCodepointHMetrics(fontInfo, ch, &glyph.advanceX, NULL);
+            glyph.advanceX = (int)((float)glyph.advanceX*scaleFactor);
+
+            Image imSpace = {
+                .data = RL_CALLOC(glyph.advanceX*fontSize, 2),
+                .width = glyph.advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
+
+            glyph.image = imSpace;
+        }
+
+        if (type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)glyph.image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph.image.data)[p] = 0;
+                else ((unsigned char *)glyph.image.data)[p] = 255;
+            }
+        }
+    }
+    else
+    {
+        // TODO: Use some fallback glyph for codepoints not found in the font
+    }
+
+    return glyph;
+}
+
+// Glyph rasterization job, used by LoadFontData()
+// NOTE: stbtt_fontinfo is only read, glyphs rasterization is safe to run on multiple threads
+static void LoadFontGlyphsJob(void *data, int jobIndex)
+{
+    FontGlyphsJobData *jobData = (FontGlyphsJobData *)data;
+
+    jobData->glyphs[jobIndex] = LoadGlyphTTF(jobData->fontInfo, jobData->codepoints[jobIndex], jobData->fontSize, jobData->scaleFactor, jobData->ascent, jobData->type);
+}
+#endif      // SUPPORT_FILEFORMAT_TTF
+
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_GLYPH_CACHE)
+// Get glyph index for a codepoint from dynamic glyphs cache, glyph is rasterized and packed on first use
+// NOTE: Atlas texture is updated only for the new glyph rectangle, unless atlas has to be grown or
+// compacted, in that case least recently used glyphs are evicted and atlas is fully repacked and uploaded
+static int LoadGlyphCached(rGlyphCache *cache, int codepoint)
+{
+    int index = GetGlyphLookupIndex(cache->lookup, cache->glyphs, codepoint);
+
+    if (index != -1)
+    {
+        cache->lastUsed[index] = ++cache->useCounter;
+        return index;
+    }
+
+    index = cache->lookup[1];   // Fallback glyph, in case codepoint can not be loaded
+
+    if (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0) return index;
+
+    // Get a free glyph slot, evicting least recently used glyphs if required
+    // NOTE: Loaded glyphs are compacted, first free slot is glyphCount
+    if ((cache->glyphCount == cache->capacity) && (EvictGlyphCache(cache) > 0)) PackGlyphCache(cache);
+
+    if (cache->glyphCount == cache->capacity) return index;
+
+    GlyphInfo glyph = LoadGlyphTTF(&cache->fontInfo, codepoint, cache->fontSize, cache->scaleFactor, cache->ascent, FONT_DEFAULT);
+
+    // Convert glyph image from GRAYSCALE to GRAY_ALPHA, same as font atlas texture
+    if (glyph.image.data != NULL)
+    {
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(glyph.image.width*glyph.image.height*2);
+
+        for (int i = 0, k = 0; i < glyph.image.width*glyph.image.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)glyph.image.data)[i];
+        }
+
+        RL_FREE(glyph.image.data);
+        glyph.image.data = dataGrayAlpha;
+        glyph.image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
+
+    // Glyphs images are kept for atlas repacking, counted in memory budget with atlas
+    int imageSize = (glyph.image.data != NULL)? glyph.image.width*glyph.image.height*2 : 0;
+    bool evicted = false;
+
+    while (((cache->atlasWidth*cache->atlasHeight*2 + cache->imageMemory + imageSize) > cache->memoryBudget) && (EvictGlyphCache(cache) > 0)) evicted = true;
+
+    if (evicted) PackGlyphCache(cache);
+
+    int slot = cache->glyphCount;
+    cache->glyphs[slot] = glyph;
+    cache->lastUsed[slot] = ++cache->useCounter;
+    cache->glyphCount++;
+    cache->imageMemory += imageSize;
+    SetGlyphLookupIndex(cache->lookup, cache->glyphs, slot);
+
+    // Try to pack the new glyph in the current atlas
+    stbrp_rect rect = { .id = slot, .w = glyph.image.width + 2*cache->padding, .h = glyph.image.height + 2*cache->padding };
+    stbrp_pack_rects(&cache->packer, &rect, 1);
+
+    if (rect.was_packed)
+    {
+        cache->recs[slot] = (Rectangle){ (float)(rect.x + cache->padding), (float)(rect.y + cache->padding), (float)glyph.image.width, (float)glyph.image.height };
+
+        if ((glyph.image.data != NULL) && (glyph.image.width > 0) && (glyph.image.height > 0)) UpdateTextureRec(cache->texture, cache->recs[slot], glyph.image.data);
+    }
+    else
+    {
+        // Atlas is full: grow it while under memory budget, evict least recently used glyphs otherwise
+        while (!PackGlyphCache(cache))
+        {
+            if ((2*cache->atlasWidth*cache->atlasHeight*2 + cache->imageMemory) <= cache->memoryBudget)
+            {
+                if (cache->atlasWidth <= cache->atlasHeight) cache->atlasWidth *= 2;
+                else cache->atlasHeight *= 2;
+            }
+            else if (EvictGlyphCache(cache) == 0)
+            {
+                // NOTE: Glyphs eviction compacts cache slots, new glyph slot could have changed
+                slot = GetGlyphLookupIndex(cache->lookup, cache->glyphs, codepoint);
+                if (slot == -1) break;  // Security check, only fallback glyph remaining
+
+                // New glyph does not fit even in an empty atlas, discard it
+                UnloadImage(cache->glyphs[slot].image);
+                cache->lastUsed[slot] = 0;
+                cache->imageMemory -= imageSize;
+                CompactGlyphCache(cache);
+
+                TRACELOG(LOG_WARNING, "FONT: Glyph for codepoint 0x%x does not fit in atlas memory budget", codepoint);
+            }
+        }
+    }
+
+    slot = GetGlyphLookupIndex(cache->lookup, cache->glyphs, codepoint);
+    if (slot != -1) index = slot;
+
+    return index;
+}
+
+// Evict least recently used glyphs from dynamic glyphs cache, returns number of glyphs evicted
+// NOTE: Oldest half of the glyphs is evicted, fallback glyph, last used glyph and pinned glyphs are always kept
+static int EvictGlyphCache(rGlyphCache *cache)
+{
+    int evictCount = 0;
+    int candidateCount = 0;
+    unsigned long long *candidates = (unsigned long long *)RL_MALLOC(cache->capacity*sizeof(unsigned long long));
+
+    for (int i = 0; i < cache->capacity; i++)
+    {
+        if ((cache->lastUsed[i] != 0) && (cache->lastUsed[i] != cache->useCounter) && (i != cache->lookup[1]) &&
+            ((cache->pinnedUse == 0) || (cache->lastUsed[i] < cache->pinnedUse))) candidates[candidateCount++] = cache->lastUsed[i];
+    }
+
+    if (candidateCount > 0)
+    {
+        // Quads already batched could reference glyphs about to be evicted
+        rlDrawRenderBatchActive();
+
+        qsort(candidates, candidateCount, sizeof(unsigned long long), CompareGlyphLastUsed);
+        unsigned long long threshold = candidates[(candidateCount - 1)/2];
+
+        for (int i = 0; i < cache->capacity; i++)
+        {
+            if ((cache->lastUsed[i] != 0) && (cache->lastUsed[i] <= threshold) && (i != cache->lookup[1]))
+            {
+                if (cache->glyphs[i].image.data != NULL) cache->imageMemory -= cache->glyphs[i].image.width*cache->glyphs[i].image.height*2;
+                UnloadImage(cache->glyphs[i].image);
+                cache->lastUsed[i] = 0;
+                evictCount++;
+            }
+        }
+
+        CompactGlyphCache(cache);
+    }
+
+    RL_FREE(candidates);
+
+    return evictCount;
+}
+
+// Compact dynamic glyphs cache, loaded glyphs are moved to first slots and lookup table reloaded
+// NOTE: Glyphs indices change, glyphs atlas rectangles are kept
+static void CompactGlyphCache(rGlyphCache *cache)
+{
+    int glyphCount = 0;
+
+    for (int i = 0; i < cache->capacity; i++)
+    {
+        if (cache->lastUsed[i] == 0) continue;
+
+        if (i != glyphCount)
+        {
+            cache->glyphs[glyphCount] = cache->glyphs[i];
+            cache->recs[glyphCount] = cache->recs[i];
+            cache->lastUsed[glyphCount] = cache->lastUsed[i];
+            if (cache->lookup[1] == i) cache->lookup[1] = glyphCount;
+
+            cache->lastUsed[i] = 0;
+        }
+
+        glyphCount++;
+    }
+
+    // Free slots are cleared
+    for (int i = glyphCount; i < cache->capacity; i++)
+    {
+        cache->glyphs[i] = (GlyphInfo){ 0 };
+        cache->recs[i] = (Rectangle){ 0 };
+    }
+
+    cache->glyphCount = glyphCount;
+    LoadGlyphLookupCached(cache);
+}
+
+// Pack all glyphs in dynamic glyphs cache into atlas, atlas texture is fully uploaded (or recreated if size changed)
+// NOTE: Returns false if glyphs do not fit in current atlas size
+static bool PackGlyphCache(rGlyphCache *cache)
+{
+    bool success = false;
+
+    // Quads already batched reference current atlas layout
+    rlDrawRenderBatchActive();
+
+    cache->nodes = (stbrp_node *)RL_REALLOC(cache->nodes, cache->atlasWidth*sizeof(stbrp_node));
+    stbrp_init_target(&cache->packer, cache->atlasWidth, cache->atlasHeight, cache->nodes, cache->atlasWidth);
+
+    int rectCount = 0;
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(cache->capacity*sizeof(stbrp_rect));
+
+    for (int i = 0; i < cache->capacity; i++)
+    {
+        if (cache->lastUsed[i] != 0)
+        {
+            rects[rectCount] = (stbrp_rect){ .id = i, .w = cache->glyphs[i].image.width + 2*cache->padding, .h = cache->glyphs[i].image.height + 2*cache->padding };
+            rectCount++;
+        }
+    }
+
+    if (stbrp_pack_rects(&cache->packer, rects, rectCount) == 1)
+    {
+        Image atlas = {
+            .data = RL_CALLOC(cache->atlasWidth*cache->atlasHeight, 2),
+            .width = cache->atlasWidth,
+            .height = cache->atlasHeight,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+        };
+
+        for (int i = 0; i < rectCount; i++)
+        {
+            const GlyphInfo *glyph = &cache->glyphs[rects[i].id];
+            Rectangle rec = { (float)(rects[i].x + cache->padding), (float)(rects[i].y + cache->padding), (float)glyph->image.width, (float)glyph->image.height };
+            cache->recs[rects[i].id] = rec;
+
+            if (glyph->image.data != NULL)
+            {
+                for (int y = 0; y < glyph->image.height; y++)
+                {
+                    memcpy((unsigned char *)atlas.data + (((int)rec.y + y)*atlas.width + (int)rec.x)*2,
+                        (unsigned char *)glyph->image.data + y*glyph->image.width*2, glyph->image.width*2);
+                }
+            }
+        }
+
+        if ((cache->texture.width == atlas.width) && (cache->texture.height == atlas.height)) UpdateTexture(cache->texture, atlas.data);
+        else
+        {
+            UnloadTexture(cache->texture);
+            cache->texture = LoadTextureFromImage(atlas);
+        }
+
+        UnloadImage(atlas);
+        success = true;
+    }
+
+    RL_FREE(rects);
+
+    return success;
+}
+
+// Load glyphs lookup table for dynamic glyphs cache, only for glyphs loaded into the cache
+static void LoadGlyphLookupCached(rGlyphCache *cache)
+{
+    int slotCount = 1 << cache->lookup[0];
+    for (int i = 0; i < slotCount; i++) cache->lookup[2 + i] = -1;
+
+    for (int i = 0; i < cache->capacity; i++) if (cache->lastUsed[i] != 0) SetGlyphLookupIndex(cache->lookup, cache->glyphs, i);
+}
+
+// Unload dynamic glyphs cache, including atlas texture and font file data
+static void UnloadGlyphCache(rGlyphCache *cache)
+{
+    for (int i = 0; i < cache->capacity; i++) UnloadImage(cache->glyphs[i].image);
+
+    UnloadTexture(cache->texture);
+    UnloadFileData(cache->fileData);
+
+    RL_FREE(cache->glyphs);
+    RL_FREE(cache->recs);
+    RL_FREE(cache->lookup);
+    RL_FREE(cache->lastUsed);
+    RL_FREE(cache->nodes);
+    RL_FREE(cache);
+}
+
+// Compare glyphs last use counters, used to sort glyphs for eviction
+static int CompareGlyphLastUsed(const void *a, const void *b)
+{
+    unsigned long long lastUsedA = *(const unsigned long long *)a;
+    unsigned long long lastUsedB = *(const unsigned long long *)b;
+
+    return (lastUsedA > lastUsedB) - (lastUsedA < lastUsedB);
+}
+#endif      // SUPPORT_FILEFORMAT_TTF && SUPPORT_FONT_GLYPH_CACHE
+
 #endif      // SUPPORT_MODULE_RTEXT
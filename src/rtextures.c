@@ -70,12 +70,12 @@
 
 #if defined(SUPPORT_MODULE_RTEXTURES)
 
-#include "utils.h"              // Required for: TRACELOG()
+#include "utils.h"              // Required for: TRACELOG(), RunParallelJobs()
 #include "rlgl.h"               // OpenGL abstraction layer to multiple versions
 
 #include <stdlib.h>             // Required for: malloc(), calloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
-#include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
+#include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()], fminf() [Used in ImageBlurGaussian()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
 // Support only desired texture formats on stb_image
@@ -233,6 +233,14 @@
     #include "external/nanosvgrast.h"
 #endif
 
+// SSE2 intrinsics used by some image processing functions, always available on x86-64
+// NOTE: Scalar code is used on other architectures or if RTEXTURES_NO_SIMD is defined
+#if !defined(RTEXTURES_NO_SIMD) && !defined(__TINYC__) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #define RTEXTURES_SSE2
+    #include <emmintrin.h>                  // Required for: SSE2 intrinsics [Used in ImageBlurGaussian(), ImageFlipHorizontal(), ImageRotateCW()/ImageRotateCCW()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -243,11 +251,28 @@
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
+#ifndef IMAGE_BLUR_JOB_LINES
+    #define IMAGE_BLUR_JOB_LINES     64    // Number of rows (or columns) processed by every box blur parallel job
+#endif
+#ifndef IMAGE_BLOCK_SIZE
+    #define IMAGE_BLOCK_SIZE         32    // Pixels block size (width and height) processed at once by image rotations
+#endif
+#ifndef SPRITE_INSTANCES_QUADS_CHUNK
+    #define SPRITE_INSTANCES_QUADS_CHUNK 64 // Maximum number of sprites quads pushed at once on render batch fallback: DrawTextureInstanced()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Box blur jobs data, pixels are RGBA 8-bit (premultiplied alpha)
+typedef struct ImageBlurJobData {
+    unsigned char *src;                 // Source pixels, horizontal pass input and vertical pass output
+    unsigned char *dst;                 // Intermediate pixels, horizontal pass output and vertical pass input
+    int width;                          // Image width
+    int height;                         // Image height
+    int radius;                         // Box blur radius (blurSize)
+    const float *scales;                // Window averaging scales by window size (1.0f/size)
+} ImageBlurJobData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -265,6 +290,15 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static Color *LoadImageColorsInPlace(Image image);          // Load pixel data from image as Color array, RGBA 8-bit image data is used directly
+static void UpdateImageColorsInPlace(Image *image, Color *pixels); // Update image from Color array loaded with LoadImageColorsInPlace()
+static void ImageColorLookup(Image *image, unsigned char lookup[4][256], bool grayLookup); // Apply lookup tables to image color channels
+static void ImageBlurRowsJob(void *data, int jobIndex);     // Box blur job, horizontal pass over a block of rows
+static void ImageBlurColumnsJob(void *data, int jobIndex);  // Box blur job, vertical pass over a block of columns
+static void FlipImageRow(unsigned char *row, int width, int bytesPerPixel);    // Reverse row pixels order in place
+static void RotateImageData(const unsigned char *src, unsigned char *dst, int width, int height, int bytesPerPixel, bool clockwise); // Rotate image data 90 degrees
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1351,6 +1385,8 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
+            PROFILE_ZONE_BEGIN("ImageFormat");
+
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
             RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
@@ -1544,6 +1580,8 @@ void ImageFormat(Image *image, int newFormat)
                 if (image->data != NULL) ImageMipmaps(image);
             #endif
             }
+
+            PROFILE_ZONE_END();
         }
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
@@ -2016,144 +2054,55 @@ void ImageAlphaPremultiply(Image *image)
 void ImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    ImageAlphaPremultiply(image);
-
-    Color *pixels = LoadImageColors(*image);
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize < 1)) return;
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    Color *pixels = LoadImageColorsInPlace(*image);
+    Color *pixelsCopy = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
 
-    for (int i = 0; i < (image->height*image->width); i++)
+    // Premultiply alpha, avoids transparent pixels color bleeding into the blur
+    for (int i = 0; i < image->width*image->height; i++)
     {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
+        pixels[i].r = (unsigned char)((pixels[i].r*pixels[i].a + 127)/255);
+        pixels[i].g = (unsigned char)((pixels[i].g*pixels[i].a + 127)/255);
+        pixels[i].b = (unsigned char)((pixels[i].b*pixels[i].a + 127)/255);
     }
 
+    // Window averaging scales, window size is reduced on image borders
+    int windowSize = 2*blurSize + 1;
+    float *scales = (float *)RL_MALLOC((windowSize + 1)*sizeof(float));
+    scales[0] = 0.0f;
+    for (int i = 1; i <= windowSize; i++) scales[i] = 1.0f/(float)i;
+
+    ImageBlurJobData jobData = { (unsigned char *)pixels, (unsigned char *)pixelsCopy, image->width, image->height, blurSize, scales };
+    int rowJobs = (image->height + IMAGE_BLUR_JOB_LINES - 1)/IMAGE_BLUR_JOB_LINES;
+    int columnJobs = (image->width + IMAGE_BLUR_JOB_LINES - 1)/IMAGE_BLUR_JOB_LINES;
+
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    // NOTE: Separable box blur, sliding window sums make the cost per pixel independent of blurSize
     for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
     {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        RunParallelJobs(ImageBlurRowsJob, &jobData, rowJobs);           // Horizontal box blur: pixels -> pixelsCopy
+        RunParallelJobs(ImageBlurColumnsJob, &jobData, columnJobs);     // Vertical box blur: pixelsCopy -> pixels
     }
 
     // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    for (int i = 0; i < image->width*image->height; i++)
     {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
+        if (pixels[i].a == 0) pixels[i] = (Color){ 0, 0, 0, 0 };
+        else if (pixels[i].a < 255)
         {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
+            float alpha = 255.0f/pixels[i].a;
+
+            pixels[i].r = (unsigned char)fminf(pixels[i].r*alpha + 0.5f, 255.0f);
+            pixels[i].g = (unsigned char)fminf(pixels[i].g*alpha + 0.5f, 255.0f);
+            pixels[i].b = (unsigned char)fminf(pixels[i].b*alpha + 0.5f, 255.0f);
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    RL_FREE(pixelsCopy);
+    RL_FREE(scales);
 
-    ImageFormat(image, format);
+    UpdateImageColorsInPlace(image, pixels);
 }
 
 // The kernel matrix is assumed to be square. Only supply the width of the kernel
@@ -2477,17 +2426,21 @@ void ImageFlipVertical(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        // Swap rows in place, only one row of temporary memory is required
+        int rowSize = image->width*GetPixelDataSize(1, 1, image->format);
+        unsigned char *row = (unsigned char *)RL_MALLOC(rowSize);
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        for (int y = 0; y < image->height/2; y++)
         {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
+            unsigned char *top = (unsigned char *)image->data + y*rowSize;
+            unsigned char *bottom = (unsigned char *)image->data + (image->height - 1 - y)*rowSize;
+
+            memcpy(row, top, rowSize);
+            memcpy(top, bottom, rowSize);
+            memcpy(bottom, row, rowSize);
         }
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+        RL_FREE(row);
     }
 }
 
@@ -2501,38 +2454,13 @@ void ImageFlipHorizontal(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
+        // Reverse every row pixels in place
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
         for (int y = 0; y < image->height; y++)
         {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
-
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
+            FlipImageRow((unsigned char *)image->data + y*image->width*bytesPerPixel, image->width, bytesPerPixel);
         }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
-
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
     }
 }
 
@@ -2556,33 +2484,43 @@ void ImageRotate(Image *image, int degrees)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
 
-        for (int y = 0; y < height; y++)
+        // Destination is processed by square blocks, source pixels read by a block stay close in memory
+        for (int blockY = 0; blockY < height; blockY += IMAGE_BLOCK_SIZE)
         {
-            for (int x = 0; x < width; x++)
+            for (int blockX = 0; blockX < width; blockX += IMAGE_BLOCK_SIZE)
             {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
+                int endY = (blockY + IMAGE_BLOCK_SIZE < height)? (blockY + IMAGE_BLOCK_SIZE) : height;
+                int endX = (blockX + IMAGE_BLOCK_SIZE < width)? (blockX + IMAGE_BLOCK_SIZE) : width;
 
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
+                for (int y = blockY; y < endY; y++)
                 {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
+                    for (int x = blockX; x < endX; x++)
+                    {
+                        float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
+                        float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
 
-                    float px = oldX - x1;
-                    float py = oldY - y1;
+                        if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
+                        {
+                            int x1 = (int)floorf(oldX);
+                            int y1 = (int)floorf(oldY);
+                            int x2 = (x1 + 1 < image->width)? (x1 + 1) : (image->width - 1);
+                            int y2 = (y1 + 1 < image->height)? (y1 + 1) : (image->height - 1);
 
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+                            float px = oldX - x1;
+                            float py = oldY - y1;
+
+                            for (int i = 0; i < bytesPerPixel; i++)
+                            {
+                                float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
+                                float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
+                                float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
+                                float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
 
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+                                float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                                rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                            }
+                        }
                     }
                 }
             }
@@ -2608,14 +2546,7 @@ void ImageRotateCW(Image *image)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
+        RotateImageData((unsigned char *)image->data, rotatedData, image->width, image->height, bytesPerPixel, true);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2640,14 +2571,7 @@ void ImageRotateCCW(Image *image)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
+        RotateImageData((unsigned char *)image->data, rotatedData, image->width, image->height, bytesPerPixel, false);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2665,33 +2589,23 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
     float cR = (float)color.r/255;
     float cG = (float)color.g/255;
     float cB = (float)color.b/255;
     float cA = (float)color.a/255;
 
-    for (int i = 0; i < image->width*image->height; i++)
+    unsigned char lookup[4][256] = { 0 };
+
+    for (int i = 0; i < 256; i++)
     {
-        unsigned char r = (unsigned char)(((float)pixels[i].r/255*cR)*255.0f);
-        unsigned char g = (unsigned char)(((float)pixels[i].g/255*cG)*255.0f);
-        unsigned char b = (unsigned char)(((float)pixels[i].b/255*cB)*255.0f);
-        unsigned char a = (unsigned char)(((float)pixels[i].a/255*cA)*255.0f);
-
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
+        lookup[0][i] = (unsigned char)(((float)i/255*cR)*255.0f);
+        lookup[1][i] = (unsigned char)(((float)i/255*cG)*255.0f);
+        lookup[2][i] = (unsigned char)(((float)i/255*cB)*255.0f);
+        lookup[3][i] = (unsigned char)(((float)i/255*cA)*255.0f);
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    // NOTE: Grayscale images get the luminance of the tinted color, they are converted
+    ImageColorLookup(image, lookup, false);
 }
 
 // Modify image color: invert
@@ -2700,28 +2614,48 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char lookup[4][256] = { 0 };
 
-    for (int i = 0; i < image->width*image->height; i++)
+    for (int i = 0; i < 256; i++)
     {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
+        lookup[0][i] = lookup[1][i] = lookup[2][i] = (unsigned char)(255 - i);
+        lookup[3][i] = (unsigned char)i;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageColorLookup(image, lookup, true);
 }
 
 // Modify image color: grayscale
 void ImageColorGrayscale(Image *image)
 {
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        // Convert pixels in place, every grayscale pixel is written after reading its color pixel
+        // NOTE: Same luminance computation as ImageFormat()
+        unsigned char *data = (unsigned char *)image->data;
+        int bytesPerPixel = (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 4;
+
+        for (int i = 0, k = 0; i < image->width*image->height; i++, k += bytesPerPixel)
+        {
+            data[i] = (unsigned char)(((float)data[k]/255.0f*0.299f + (float)data[k + 1]/255.0f*0.587f + (float)data[k + 2]/255.0f*0.114f)*255.0f);
+        }
+
+        void *temp = RL_REALLOC(image->data, image->width*image->height*sizeof(unsigned char));
+        if (temp != NULL) image->data = temp;
+
+        image->format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        // In case original image had mipmaps, generate mipmaps for grayscale image
+        if (image->mipmaps > 1)
+        {
+            image->mipmaps = 1;
+            ImageMipmaps(image);
+        }
+    }
+    else ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
 }
 
 // Modify image color: contrast
@@ -2737,46 +2671,23 @@ void ImageColorContrast(Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char lookup[4][256] = { 0 };
 
-    for (int i = 0; i < image->width*image->height; i++)
+    for (int i = 0; i < 256; i++)
     {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
+        float value = (float)i/255.0f;
+        value -= 0.5f;
+        value *= contrast;
+        value += 0.5f;
+        value *= 255;
+        if (value < 0) value = 0;
+        if (value > 255) value = 255;
+
+        lookup[0][i] = lookup[1][i] = lookup[2][i] = (unsigned char)value;
+        lookup[3][i] = (unsigned char)i;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageColorLookup(image, lookup, true);
 }
 
 // Modify image color: brightness
@@ -2789,35 +2700,20 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char lookup[4][256] = { 0 };
 
-    for (int i = 0; i < image->width*image->height; i++)
+    for (int i = 0; i < 256; i++)
     {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
+        int value = i + brightness;
 
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+        if (value < 0) value = 1;
+        if (value > 255) value = 255;
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
+        lookup[0][i] = lookup[1][i] = lookup[2][i] = (unsigned char)value;
+        lookup[3][i] = (unsigned char)i;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageColorLookup(image, lookup, true);
 }
 
 // Modify image color: replace color
@@ -2826,7 +2722,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    Color *pixels = LoadImageColorsInPlace(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2842,13 +2738,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    UpdateImageColorsInPlace(image, pixels);
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -3781,6 +3671,8 @@ void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position,
 // Load texture from file into GPU memory (VRAM)
 Texture2D LoadTexture(const char *fileName)
 {
+    PROFILE_ZONE_BEGIN("LoadTexture");
+
     Texture2D texture = { 0 };
 
     Image image = LoadImage(fileName);
@@ -3791,6 +3683,8 @@ Texture2D LoadTexture(const char *fileName)
         UnloadImage(image);
     }
 
+    PROFILE_ZONE_END();
+
     return texture;
 }
 
@@ -4216,31 +4110,28 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+        // Texture coordinates, horizontally swapped if source is flipped
+        float left = source.x/width;
+        float right = (source.x + source.width)/width;
+        float top = source.y/height;
+        float bottom = (source.y + source.height)/height;
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+        if (flipX) { float temp = left; left = right; right = temp; }
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
-
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+        rlQuad quad = {
+            .vertices = {
+                { topLeft.x, topLeft.y, left, top, tint.r, tint.g, tint.b, tint.a },                // Top-left corner for texture and quad
+                { bottomLeft.x, bottomLeft.y, left, bottom, tint.r, tint.g, tint.b, tint.a },       // Bottom-left corner for texture and quad
+                { bottomRight.x, bottomRight.y, right, bottom, tint.r, tint.g, tint.b, tint.a },    // Bottom-right corner for texture and quad
+                { topRight.x, topRight.y, right, top, tint.r, tint.g, tint.b, tint.a }              // Top-right corner for texture and quad
+            }
+        };
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            rlPushQuads(&quad, 1);
 
         rlEnd();
         rlSetTexture(0);
@@ -4287,6 +4178,89 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
     }
 }
 
+// Draw sprites instances from texture frames (source rectangles)
+// NOTE: Sprites are drawn centered at instance position, frame size scaled by instance scale,
+// instances data is uploaded as is and sprites are expanded on GPU if instancing is supported,
+// otherwise (i.e. OpenGL ES 2.0 without instancing extensions, OpenGL 1.1) or if a custom shader
+// is active (BeginShaderMode()) render batch is used with it, instances with frame index
+// not lower than frameCount are skipped on both paths
+void DrawTextureInstanced(Texture2D texture, const Rectangle *frames, int frameCount, const SpriteInstance *instances, int instanceCount)
+{
+    if ((texture.id == 0) || (frames == NULL) || (frameCount <= 0) || (instances == NULL) || (instanceCount <= 0)) return;
+
+    // NOTE: SpriteInstance and rlSpriteInstance share memory layout, Rectangle is 4 floats
+    if (rlDrawSpriteInstances(texture.id, texture.width, texture.height, (const float *)frames, frameCount, (const rlSpriteInstance *)instances, instanceCount)) return;
+
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+
+    rlQuad quads[SPRITE_INSTANCES_QUADS_CHUNK];
+    int quadCount = 0;
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < instanceCount; i++)
+        {
+            const SpriteInstance *sprite = &instances[i];
+
+            if (sprite->frame < frameCount)
+            {
+                Rectangle source = frames[sprite->frame];
+
+                // Texture coordinates, swapped if source is flipped (negative width or height)
+                float left = source.x/width;
+                float right = (source.x + source.width)/width;
+                float top = source.y/height;
+                float bottom = (source.y + source.height)/height;
+
+                if (source.width < 0) { left = (source.x - source.width)/width; right = source.x/width; }
+                if (source.height < 0) { top = (source.y - source.height)/height; bottom = source.y/height; }
+
+                // Sprite corners offsets from center, rotated (if required)
+                float halfWidth = fabsf(source.width)*sprite->scale*0.5f;
+                float halfHeight = fabsf(source.height)*sprite->scale*0.5f;
+                float cosRotation = 1.0f;
+                float sinRotation = 0.0f;
+
+                if (sprite->rotation != 0.0f)
+                {
+                    cosRotation = cosf(sprite->rotation*DEG2RAD);
+                    sinRotation = sinf(sprite->rotation*DEG2RAD);
+                }
+
+                float ax = halfWidth*cosRotation;
+                float ay = halfWidth*sinRotation;
+                float bx = -halfHeight*sinRotation;
+                float by = halfHeight*cosRotation;
+                float x = sprite->position.x;
+                float y = sprite->position.y;
+                Color tint = sprite->tint;
+
+                rlQuadVertex *vertices = quads[quadCount].vertices;
+
+                // Quad vertex: top-left, bottom-left, bottom-right, top-right
+                vertices[0] = (rlQuadVertex){ x - ax - bx, y - ay - by, left, top, tint.r, tint.g, tint.b, tint.a };
+                vertices[1] = (rlQuadVertex){ x - ax + bx, y - ay + by, left, bottom, tint.r, tint.g, tint.b, tint.a };
+                vertices[2] = (rlQuadVertex){ x + ax + bx, y + ay + by, right, bottom, tint.r, tint.g, tint.b, tint.a };
+                vertices[3] = (rlQuadVertex){ x + ax - bx, y + ay - by, right, top, tint.r, tint.g, tint.b, tint.a };
+                quadCount++;
+            }
+
+            // Push sprites quads by chunks, quads data is kept on stack
+            if ((quadCount == SPRITE_INSTANCES_QUADS_CHUNK) || ((i == (instanceCount - 1)) && (quadCount > 0)))
+            {
+                rlPushQuads(quads, quadCount);
+                quadCount = 0;
+            }
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
 void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
 {
@@ -5204,4 +5178,415 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Load pixel data from image as Color array
+// NOTE: RGBA 8-bit image data is returned directly (no copy) to be processed in place,
+// other formats are converted into a new Color array, use UpdateImageColorsInPlace() once processed
+static Color *LoadImageColorsInPlace(Image image)
+{
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return (Color *)image.data;
+
+    return LoadImageColors(image);
+}
+
+// Update image from Color array loaded with LoadImageColorsInPlace()
+// NOTE: Converted pixels replace image data and they are converted back to original image format
+static void UpdateImageColorsInPlace(Image *image, Color *pixels)
+{
+    if (pixels == image->data)
+    {
+        // In case image had mipmaps, generate mipmaps for processed image
+        if (image->mipmaps > 1)
+        {
+            image->mipmaps = 1;
+            ImageMipmaps(image);
+        }
+    }
+    else
+    {
+        int format = image->format;
+        RL_FREE(image->data);
+
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        ImageFormat(image, format);
+    }
+}
+
+// Apply lookup tables to image color channels, one table per RGBA channel
+// NOTE: 8-bit per channel formats are processed in place, grayscale formats only if
+// the same lookup table applies to RGB channels (grayLookup), other formats are converted
+static void ImageColorLookup(Image *image, unsigned char lookup[4][256], bool grayLookup)
+{
+    const unsigned char *tables[4] = { lookup[0], lookup[1], lookup[2], lookup[3] };
+    int channels = 0;
+
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: if (grayLookup) channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: if (grayLookup) { channels = 2; tables[1] = lookup[3]; } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        default: break;
+    }
+
+    if (channels > 0)
+    {
+        unsigned char *data = (unsigned char *)image->data;
+
+        for (int i = 0; i < image->width*image->height*channels; i += channels)
+        {
+            for (int c = 0; c < channels; c++) data[i + c] = tables[c][data[i + c]];
+        }
+
+        UpdateImageColorsInPlace(image, (Color *)image->data);
+    }
+    else
+    {
+        Color *pixels = LoadImageColors(*image);
+
+        for (int i = 0; i < image->width*image->height; i++)
+        {
+            pixels[i].r = lookup[0][pixels[i].r];
+            pixels[i].g = lookup[1][pixels[i].g];
+            pixels[i].b = lookup[2][pixels[i].b];
+            pixels[i].a = lookup[3][pixels[i].a];
+        }
+
+        UpdateImageColorsInPlace(image, pixels);
+    }
+}
+
+#if defined(RTEXTURES_SSE2)
+// Load one RGBA 8-bit pixel as 4 x 32-bit integers
+static inline __m128i LoadPixelSSE2(const unsigned char *pixel)
+{
+    int value = 0;
+    memcpy(&value, pixel, 4);
+
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(value), zero), zero);
+}
+
+// Load four RGBA 8-bit pixels as 4 x (4 x 32-bit integers)
+static inline void LoadPixels4SSE2(const unsigned char *pixels, __m128i *result)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i bytes = _mm_loadu_si128((const __m128i *)pixels);
+    __m128i low = _mm_unpacklo_epi8(bytes, zero);
+    __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+    result[0] = _mm_unpacklo_epi16(low, zero);
+    result[1] = _mm_unpackhi_epi16(low, zero);
+    result[2] = _mm_unpacklo_epi16(high, zero);
+    result[3] = _mm_unpackhi_epi16(high, zero);
+}
+
+// Scale window sums of one pixel, rounded and packed to 8-bit
+static inline __m128i ScalePixelSSE2(__m128i sum, __m128 scale)
+{
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), scale), _mm_set1_ps(0.5f)));
+}
+
+// Store one pixel window sums as RGBA 8-bit pixel
+static inline void StorePixelSSE2(unsigned char *pixel, __m128i sum, __m128 scale)
+{
+    __m128i result = ScalePixelSSE2(sum, scale);
+    result = _mm_packs_epi32(result, result);
+    int value = _mm_cvtsi128_si32(_mm_packus_epi16(result, result));
+    memcpy(pixel, &value, 4);
+}
+
+// Store four pixels window sums as RGBA 8-bit pixels
+static inline void StorePixels4SSE2(unsigned char *pixels, const __m128i *sum, __m128 scale)
+{
+    __m128i low = _mm_packs_epi32(ScalePixelSSE2(sum[0], scale), ScalePixelSSE2(sum[1], scale));
+    __m128i high = _mm_packs_epi32(ScalePixelSSE2(sum[2], scale), ScalePixelSSE2(sum[3], scale));
+    _mm_storeu_si128((__m128i *)pixels, _mm_packus_epi16(low, high));
+}
+#endif
+
+// Box blur job, horizontal pass over a block of rows: src -> dst
+// NOTE: Window sums slide along the row, cost per pixel does not depend on blur radius
+static void ImageBlurRowsJob(void *data, int jobIndex)
+{
+    ImageBlurJobData *jobData = (ImageBlurJobData *)data;
+    int width = jobData->width;
+    int radius = jobData->radius;
+
+    int startRow = jobIndex*IMAGE_BLUR_JOB_LINES;
+    int endRow = (startRow + IMAGE_BLUR_JOB_LINES < jobData->height)? (startRow + IMAGE_BLUR_JOB_LINES) : jobData->height;
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        const unsigned char *src = jobData->src + y*width*4;
+        unsigned char *dst = jobData->dst + y*width*4;
+        int count = 0;
+
+#if defined(RTEXTURES_SSE2)
+        // Initial window: [0, radius]
+        __m128i sum = _mm_setzero_si128();
+        for (int x = 0; (x <= radius) && (x < width); x++, count++) sum = _mm_add_epi32(sum, LoadPixelSSE2(src + x*4));
+
+        for (int x = 0; x < width; x++)
+        {
+            StorePixelSSE2(dst + x*4, sum, _mm_set1_ps(jobData->scales[count]));
+
+            // Slide window: [x - radius, x + radius] -> [x + 1 - radius, x + 1 + radius]
+            if ((x + radius + 1) < width) { sum = _mm_add_epi32(sum, LoadPixelSSE2(src + (x + radius + 1)*4)); count++; }
+            if ((x - radius) >= 0) { sum = _mm_sub_epi32(sum, LoadPixelSSE2(src + (x - radius)*4)); count--; }
+        }
+#else
+        // Initial window: [0, radius]
+        unsigned int sum[4] = { 0 };
+        for (int x = 0; (x <= radius) && (x < width); x++, count++)
+        {
+            for (int c = 0; c < 4; c++) sum[c] += src[x*4 + c];
+        }
+
+        for (int x = 0; x < width; x++)
+        {
+            float scale = jobData->scales[count];
+            for (int c = 0; c < 4; c++) dst[x*4 + c] = (unsigned char)((float)sum[c]*scale + 0.5f);
+
+            // Slide window: [x - radius, x + radius] -> [x + 1 - radius, x + 1 + radius]
+            if ((x + radius + 1) < width)
+            {
+                for (int c = 0; c < 4; c++) sum[c] += src[(x + radius + 1)*4 + c];
+                count++;
+            }
+
+            if ((x - radius) >= 0)
+            {
+                for (int c = 0; c < 4; c++) sum[c] -= src[(x - radius)*4 + c];
+                count--;
+            }
+        }
+#endif
+    }
+}
+
+// Box blur job, vertical pass over a block of columns: dst -> src
+// NOTE: Columns block is processed row by row (contiguous memory), keeping window sums per column
+static void ImageBlurColumnsJob(void *data, int jobIndex)
+{
+    ImageBlurJobData *jobData = (ImageBlurJobData *)data;
+    int width = jobData->width;
+    int height = jobData->height;
+    int radius = jobData->radius;
+
+    int startColumn = jobIndex*IMAGE_BLUR_JOB_LINES;
+    int columnCount = (startColumn + IMAGE_BLUR_JOB_LINES < width)? IMAGE_BLUR_JOB_LINES : (width - startColumn);
+
+    const unsigned char *src = jobData->dst + startColumn*4;
+    unsigned char *dst = jobData->src + startColumn*4;
+    int stride = width*4;
+    int count = 0;
+
+#if defined(RTEXTURES_SSE2)
+    // Window sums are processed in groups of 4 columns (16 bytes), remaining columns one by one
+    __m128i sum[IMAGE_BLUR_JOB_LINES];
+    __m128i pixels[4];
+    int groupedCount = columnCount - columnCount%4;
+
+    for (int i = 0; i < columnCount; i++) sum[i] = _mm_setzero_si128();
+
+    // Initial window: [0, radius]
+    for (int y = 0; (y <= radius) && (y < height); y++, count++)
+    {
+        for (int i = 0; i < columnCount; i++) sum[i] = _mm_add_epi32(sum[i], LoadPixelSSE2(src + y*stride + i*4));
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        __m128 scale = _mm_set1_ps(jobData->scales[count]);
+
+        for (int i = 0; i < groupedCount; i += 4) StorePixels4SSE2(dst + y*stride + i*4, sum + i, scale);
+        for (int i = groupedCount; i < columnCount; i++) StorePixelSSE2(dst + y*stride + i*4, sum[i], scale);
+
+        // Slide window: [y - radius, y + radius] -> [y + 1 - radius, y + 1 + radius]
+        if ((y + radius + 1) < height)
+        {
+            const unsigned char *row = src + (y + radius + 1)*stride;
+
+            for (int i = 0; i < groupedCount; i += 4)
+            {
+                LoadPixels4SSE2(row + i*4, pixels);
+                for (int k = 0; k < 4; k++) sum[i + k] = _mm_add_epi32(sum[i + k], pixels[k]);
+            }
+
+            for (int i = groupedCount; i < columnCount; i++) sum[i] = _mm_add_epi32(sum[i], LoadPixelSSE2(row + i*4));
+            count++;
+        }
+
+        if ((y - radius) >= 0)
+        {
+            const unsigned char *row = src + (y - radius)*stride;
+
+            for (int i = 0; i < groupedCount; i += 4)
+            {
+                LoadPixels4SSE2(row + i*4, pixels);
+                for (int k = 0; k < 4; k++) sum[i + k] = _mm_sub_epi32(sum[i + k], pixels[k]);
+            }
+
+            for (int i = groupedCount; i < columnCount; i++) sum[i] = _mm_sub_epi32(sum[i], LoadPixelSSE2(row + i*4));
+            count--;
+        }
+    }
+#else
+    unsigned int sum[IMAGE_BLUR_JOB_LINES*4] = { 0 };
+    int blockSize = columnCount*4;
+
+    // Initial window: [0, radius]
+    for (int y = 0; (y <= radius) && (y < height); y++, count++)
+    {
+        for (int i = 0; i < blockSize; i++) sum[i] += src[y*stride + i];
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        float scale = jobData->scales[count];
+        for (int i = 0; i < blockSize; i++) dst[y*stride + i] = (unsigned char)((float)sum[i]*scale + 0.5f);
+
+        // Slide window: [y - radius, y + radius] -> [y + 1 - radius, y + 1 + radius]
+        if ((y + radius + 1) < height)
+        {
+            for (int i = 0; i < blockSize; i++) sum[i] += src[(y + radius + 1)*stride + i];
+            count++;
+        }
+
+        if ((y - radius) >= 0)
+        {
+            for (int i = 0; i < blockSize; i++) sum[i] -= src[(y - radius)*stride + i];
+            count--;
+        }
+    }
+#endif
+}
+
+// Copy one pixel, specialized for common pixel sizes
+// NOTE: memcpy() with constant size is compiled as a single move
+static inline void CopyPixel(unsigned char *dst, const unsigned char *src, int bytesPerPixel)
+{
+    switch (bytesPerPixel)
+    {
+        case 1: dst[0] = src[0]; break;
+        case 2: memcpy(dst, src, 2); break;
+        case 3: memcpy(dst, src, 3); break;
+        case 4: memcpy(dst, src, 4); break;
+        case 8: memcpy(dst, src, 8); break;
+        default: memcpy(dst, src, bytesPerPixel); break;
+    }
+}
+
+// Reverse row pixels order in place
+static void FlipImageRow(unsigned char *row, int width, int bytesPerPixel)
+{
+    int left = 0;
+    int right = width - 1;
+
+#if defined(RTEXTURES_SSE2)
+    if (bytesPerPixel == 4)
+    {
+        // Swap 4 pixels from every side, reversing them with a single shuffle
+        for (; (right - left) >= 7; left += 4, right -= 4)
+        {
+            __m128i leftPixels = _mm_loadu_si128((__m128i *)(row + left*4));
+            __m128i rightPixels = _mm_loadu_si128((__m128i *)(row + (right - 3)*4));
+
+            _mm_storeu_si128((__m128i *)(row + left*4), _mm_shuffle_epi32(rightPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+            _mm_storeu_si128((__m128i *)(row + (right - 3)*4), _mm_shuffle_epi32(leftPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+    }
+#endif
+
+    unsigned char pixel[16] = { 0 };    // Biggest pixel size: PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+
+    for (; left < right; left++, right--)
+    {
+        CopyPixel(pixel, row + left*bytesPerPixel, bytesPerPixel);
+        CopyPixel(row + left*bytesPerPixel, row + right*bytesPerPixel, bytesPerPixel);
+        CopyPixel(row + right*bytesPerPixel, pixel, bytesPerPixel);
+    }
+}
+
+#if defined(RTEXTURES_SSE2)
+// Transpose 4x4 block of 32-bit pixels, rows to columns
+static inline void TransposePixels4x4SSE2(__m128i *rows)
+{
+    __m128i t0 = _mm_unpacklo_epi32(rows[0], rows[1]);
+    __m128i t1 = _mm_unpacklo_epi32(rows[2], rows[3]);
+    __m128i t2 = _mm_unpackhi_epi32(rows[0], rows[1]);
+    __m128i t3 = _mm_unpackhi_epi32(rows[2], rows[3]);
+
+    rows[0] = _mm_unpacklo_epi64(t0, t1);
+    rows[1] = _mm_unpackhi_epi64(t0, t1);
+    rows[2] = _mm_unpacklo_epi64(t2, t3);
+    rows[3] = _mm_unpackhi_epi64(t2, t3);
+}
+#endif
+
+// Rotate image data 90 degrees, clockwise or counter-clockwise
+// NOTE: Source is processed by square blocks, source rows and destination rows of a block stay in cache,
+// 32-bit pixels are transposed by 4x4 blocks with SSE2 shuffles
+static void RotateImageData(const unsigned char *src, unsigned char *dst, int width, int height, int bytesPerPixel, bool clockwise)
+{
+    for (int blockY = 0; blockY < height; blockY += IMAGE_BLOCK_SIZE)
+    {
+        for (int blockX = 0; blockX < width; blockX += IMAGE_BLOCK_SIZE)
+        {
+            int endY = (blockY + IMAGE_BLOCK_SIZE < height)? (blockY + IMAGE_BLOCK_SIZE) : height;
+            int endX = (blockX + IMAGE_BLOCK_SIZE < width)? (blockX + IMAGE_BLOCK_SIZE) : width;
+            int x = blockX;
+
+#if defined(RTEXTURES_SSE2)
+            if (bytesPerPixel == 4)
+            {
+                int endY4 = endY - (endY - blockY)%4;
+                __m128i pixels[4];
+
+                for (; (x + 4) <= endX; x += 4)
+                {
+                    for (int y = blockY; y < endY4; y += 4)
+                    {
+                        // Clockwise: source rows order is reversed, source row y goes to destination column (height - 1 - y)
+                        for (int i = 0; i < 4; i++) pixels[i] = _mm_loadu_si128((const __m128i *)(src + ((clockwise? (y + 3 - i) : (y + i))*width + x)*4));
+
+                        TransposePixels4x4SSE2(pixels);
+
+                        for (int i = 0; i < 4; i++)
+                        {
+                            if (clockwise) _mm_storeu_si128((__m128i *)(dst + ((x + i)*height + (height - 4 - y))*4), pixels[i]);
+                            else _mm_storeu_si128((__m128i *)(dst + ((width - 1 - x - i)*height + y)*4), pixels[i]);
+                        }
+                    }
+
+                    // Remaining block rows, pixel by pixel
+                    for (int i = 0; i < 4; i++)
+                    {
+                        for (int y = endY4; y < endY; y++)
+                        {
+                            if (clockwise) CopyPixel(dst + ((x + i)*height + (height - 1 - y))*4, src + (y*width + x + i)*4, 4);
+                            else CopyPixel(dst + ((width - 1 - x - i)*height + y)*4, src + (y*width + x + i)*4, 4);
+                        }
+                    }
+                }
+            }
+#endif
+            // Every source column is written as a destination row
+            for (; x < endX; x++)
+            {
+                for (int y = blockY; y < endY; y++)
+                {
+                    if (clockwise) CopyPixel(dst + (x*height + (height - 1 - y))*bytesPerPixel, src + (y*width + x)*bytesPerPixel, bytesPerPixel);
+                    else CopyPixel(dst + ((width - 1 - x)*height + y)*bytesPerPixel, src + (y*width + x)*bytesPerPixel, bytesPerPixel);
+                }
+            }
+        }
+    }
+}
+
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -7,6 +7,15 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_THREADED_JOBS
+*           Run internal parallel jobs (RunParallelJobs()) on worker threads,
+*           if not defined (or not supported by platform), jobs are run sequentially
+*
+*       #define SUPPORT_PROFILING_ZONES
+*           Record CPU profiling zones in hot-path functions (PROFILE_ZONE_BEGIN()/PROFILE_ZONE_END()),
+*           zones are stored in ring buffers per thread and exported as Chrome trace JSON on CloseWindow(),
+*           trace can be opened with chrome://tracing or https://ui.perfetto.dev
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,17 +58,174 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+// Threads are not available on web platform, unless compiled with pthreads support
+#if defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #undef SUPPORT_THREADED_JOBS
+#endif
+
+#if defined(SUPPORT_THREADED_JOBS)
+    #if defined(_WIN32)
+        #include <process.h>            // Required for: _beginthreadex()
+
+        // NOTE: We declare required functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) void *__stdcall CreateSemaphoreA(void *lpSemaphoreAttributes, long lInitialCount, long lMaximumCount, const char *lpName);
+        __declspec(dllimport) int __stdcall ReleaseSemaphore(void *hSemaphore, long lReleaseCount, long *lpPreviousCount);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+    #endif
+
+    #if defined(_MSC_VER)
+        long _InterlockedExchange(long volatile *target, long value);
+        #pragma intrinsic(_InterlockedExchange)
+        #define JOB_ATOMIC_EXCHANGE(ptr, value) _InterlockedExchange(ptr, value)
+    #else
+        #define JOB_ATOMIC_EXCHANGE(ptr, value) __sync_lock_test_and_set(ptr, value)
+    #endif
+#endif
+
+// Memory-mapped files are not available on web, on Android files are read through assets manager
+#if defined(PLATFORM_WEB) || defined(PLATFORM_ANDROID) || !defined(SUPPORT_STANDARD_FILEIO)
+    #undef SUPPORT_FILE_MAPPING
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING)
+    #if defined(_WIN32)
+        // NOTE: We declare required functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes,
+                                                          unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *hFile, long long *lpFileSize);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect,
+                                                                 unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess,
+                                                            unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+    #else
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+    #endif
+#endif
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    #if defined(_WIN32)
+        // NOTE: We declare required functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) int __stdcall QueryPerformanceCounter(unsigned long long *lpPerformanceCount);
+        __declspec(dllimport) int __stdcall QueryPerformanceFrequency(unsigned long long *lpFrequency);
+    #else
+        #include <time.h>               // Required for: clock_gettime()
+    #endif
+
+    #if defined(_MSC_VER)
+        long _InterlockedExchange(long volatile *target, long value);
+        #pragma intrinsic(_InterlockedExchange)
+        #define PROFILE_THREAD_LOCAL __declspec(thread)
+        #define PROFILE_ATOMIC_EXCHANGE(ptr, value) _InterlockedExchange(ptr, value)
+    #else
+        #define PROFILE_THREAD_LOCAL __thread
+        #define PROFILE_ATOMIC_EXCHANGE(ptr, value) __sync_lock_test_and_set(ptr, value)
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_JOB_WORKER_THREADS
+    #define MAX_JOB_WORKER_THREADS        4         // Max worker threads used to run parallel jobs (including caller thread)
+#endif
+#ifndef MAX_PROFILE_ZONE_EVENTS
+    #define MAX_PROFILE_ZONE_EVENTS    4096         // Max zone events stored per thread ring buffer, oldest events are overwritten
+#endif
+#ifndef MAX_PROFILE_ZONE_BUFFERS
+    #define MAX_PROFILE_ZONE_BUFFERS     16         // Max zone ring buffers, threads recording zones at the same time
+#endif
+#ifndef MAX_PROFILE_ZONE_DEPTH
+    #define MAX_PROFILE_ZONE_DEPTH       32         // Max nested zones recorded per thread
+#endif
+
+#define MAX_PROFILE_ZONE_EVENT_LENGTH   192         // Max length of one zone event in exported trace text
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Parallel jobs worker, runs a fixed subset of the job indices
+typedef struct ParallelJobWorker {
+    ParallelJobCallback job;        // Job callback
+    void *data;                     // Job user data
+    int jobCount;                   // Total number of jobs
+    int workerIndex;                // Worker index, first job index processed
+    int workerCount;                // Number of workers, job indices stride
+} ParallelJobWorker;
+
+#if defined(SUPPORT_THREADED_JOBS)
+// Parallel jobs worker threads pool, threads are started on first use and reused
+// NOTE: Worker 0 is always run by calling thread, worker i is run by thread i
+typedef struct ParallelJobPool {
+    ParallelJobWorker workers[MAX_JOB_WORKER_THREADS];  // Workers assigned jobs
+    int threadCount;                // Number of worker threads started (first thread slot is not used)
+    volatile long busy;             // Pool is running jobs, nested or concurrent calls run jobs on calling thread
+    bool stop;                      // Worker threads requested to exit
+#if defined(_WIN32)
+    void *threads[MAX_JOB_WORKER_THREADS];              // Worker threads handles
+    void *start[MAX_JOB_WORKER_THREADS];                // Worker threads start semaphores
+    void *done;                     // Workers done semaphore, released once by every worker
+#else
+    pthread_t threads[MAX_JOB_WORKER_THREADS];          // Worker threads
+    bool start[MAX_JOB_WORKER_THREADS];                 // Worker jobs ready to run
+    int pending;                    // Workers jobs still running
+    pthread_mutex_t lock;           // Pool state lock
+    pthread_cond_t startCond;       // Workers jobs ready condition
+    pthread_cond_t doneCond;        // Workers jobs done condition
+#endif
+} ParallelJobPool;
+#endif
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Profiling zone event, a completed zone
+typedef struct ProfileZoneEvent {
+    const char *name;               // Zone name (static string)
+    unsigned long long start;       // Zone start time (nanoseconds)
+    unsigned int duration;          // Zone duration (nanoseconds)
+    unsigned int depth;             // Zone nesting depth
+} ProfileZoneEvent;
+
+// Profiling zones ring buffer, owned by one thread at a time
+// NOTE: Buffer index is used as trace thread id, parallel job worker threads keep
+// their buffer while running and release it on exit (CloseParallelJobs())
+typedef struct ProfileZoneBuffer {
+    ProfileZoneEvent events[MAX_PROFILE_ZONE_EVENTS];   // Zone events ring buffer
+    int head;                       // Next event position in ring buffer
+    int count;                      // Number of events stored
+    volatile long owned;            // Buffer owned by a thread
+} ProfileZoneBuffer;
+
+// Profiling zones thread state, nested zones currently open
+typedef struct ProfileZoneThread {
+    ProfileZoneBuffer *buffer;      // Ring buffer owned by thread (NULL if not acquired yet)
+    int depth;                      // Current zones nesting depth
+    const char *names[MAX_PROFILE_ZONE_DEPTH];          // Open zones names
+    unsigned long long starts[MAX_PROFILE_ZONE_DEPTH];  // Open zones start times
+} ProfileZoneThread;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static int logTypeLevel = LOG_INFO;                 // Minimum log type level
+static int jobWorkerCount = MAX_JOB_WORKER_THREADS; // Number of workers used to run parallel jobs
+#if defined(SUPPORT_THREADED_JOBS)
+#if defined(_WIN32)
+static ParallelJobPool jobPool = { 0 };             // Parallel jobs worker threads pool
+#else
+static ParallelJobPool jobPool = { .lock = PTHREAD_MUTEX_INITIALIZER, .startCond = PTHREAD_COND_INITIALIZER, .doneCond = PTHREAD_COND_INITIALIZER };
+#endif
+#endif
 
 static TraceLogCallback traceLog = NULL;            // TraceLog callback function pointer
 static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback function pointer
@@ -67,6 +233,11 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(SUPPORT_PROFILING_ZONES)
+static ProfileZoneBuffer profileBuffers[MAX_PROFILE_ZONE_BUFFERS] = { 0 };  // Profiling zones ring buffers
+static PROFILE_THREAD_LOCAL ProfileZoneThread profileThread = { 0 };        // Profiling zones state for current thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -95,6 +266,20 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+static void RunParallelJobWorker(ParallelJobWorker *worker);    // Run all jobs assigned to a worker
+#if defined(SUPPORT_THREADED_JOBS)
+static int StartParallelJobThreads(int count);                  // Start pool worker threads, returns number of workers available
+    #if defined(_WIN32)
+static unsigned int __stdcall ParallelJobThread(void *arg);     // Worker thread entry point
+    #else
+static void *ParallelJobThread(void *arg);                      // Worker thread entry point
+    #endif
+#endif
+#if defined(SUPPORT_PROFILING_ZONES)
+static unsigned long long GetProfileTime(void);                 // Get monotonic time for profiling zones (nanoseconds)
+static void ReleaseProfileZones(void);                          // Release profiling zones ring buffer owned by current thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -158,6 +343,233 @@ void TraceLog(int logType, const char *text, ...)
 #endif  // SUPPORT_TRACELOG
 }
 
+// Run jobs on worker threads (if supported), blocks until all jobs are done
+// NOTE: Jobs are assigned to workers in a fixed way (interleaved indices) and calling thread
+// is used as first worker, job callback must only write data owned by its job index
+// NOTE: Worker threads are started on first call and reused by next calls, if pool is
+// already running jobs (nested or concurrent calls), jobs are run on calling thread
+void RunParallelJobs(ParallelJobCallback job, void *data, int jobCount)
+{
+    if ((job == NULL) || (jobCount <= 0)) return;
+
+#if defined(SUPPORT_THREADED_JOBS)
+    int workerCount = GetParallelJobWorkers();
+    if (workerCount > jobCount) workerCount = jobCount;
+
+    if ((workerCount > 1) && (JOB_ATOMIC_EXCHANGE(&jobPool.busy, 1) == 0))
+    {
+        workerCount = StartParallelJobThreads(workerCount);
+
+        for (int i = 0; i < workerCount; i++)
+        {
+            jobPool.workers[i].job = job;
+            jobPool.workers[i].data = data;
+            jobPool.workers[i].jobCount = jobCount;
+            jobPool.workers[i].workerIndex = i;
+            jobPool.workers[i].workerCount = workerCount;
+        }
+
+    #if defined(_WIN32)
+        for (int i = 1; i < workerCount; i++) ReleaseSemaphore(jobPool.start[i], 1, NULL);
+
+        RunParallelJobWorker(&jobPool.workers[0]);
+
+        for (int i = 1; i < workerCount; i++) WaitForSingleObject(jobPool.done, 0xFFFFFFFF);    // INFINITE
+    #else
+        pthread_mutex_lock(&jobPool.lock);
+        for (int i = 1; i < workerCount; i++) jobPool.start[i] = true;
+        jobPool.pending = workerCount - 1;
+        pthread_cond_broadcast(&jobPool.startCond);
+        pthread_mutex_unlock(&jobPool.lock);
+
+        RunParallelJobWorker(&jobPool.workers[0]);
+
+        pthread_mutex_lock(&jobPool.lock);
+        while (jobPool.pending > 0) pthread_cond_wait(&jobPool.doneCond, &jobPool.lock);
+        pthread_mutex_unlock(&jobPool.lock);
+    #endif
+
+        JOB_ATOMIC_EXCHANGE(&jobPool.busy, 0);
+        return;
+    }
+#endif
+
+    ParallelJobWorker worker = { job, data, jobCount, 0, 1 };
+    RunParallelJobWorker(&worker);
+}
+
+// Close parallel jobs worker threads pool, worker threads are stopped
+// NOTE: Pool is started again on next RunParallelJobs() call
+void CloseParallelJobs(void)
+{
+#if defined(SUPPORT_THREADED_JOBS)
+    // Wait for jobs running on other threads
+    while (JOB_ATOMIC_EXCHANGE(&jobPool.busy, 1) != 0) { }
+
+    if (jobPool.threadCount > 1)
+    {
+    #if defined(_WIN32)
+        jobPool.stop = true;
+        for (int i = 1; i < jobPool.threadCount; i++) ReleaseSemaphore(jobPool.start[i], 1, NULL);
+
+        for (int i = 1; i < jobPool.threadCount; i++)
+        {
+            WaitForSingleObject(jobPool.threads[i], 0xFFFFFFFF);    // INFINITE
+            CloseHandle(jobPool.threads[i]);
+            CloseHandle(jobPool.start[i]);
+        }
+
+        CloseHandle(jobPool.done);
+        jobPool.done = NULL;
+    #else
+        pthread_mutex_lock(&jobPool.lock);
+        jobPool.stop = true;
+        pthread_cond_broadcast(&jobPool.startCond);
+        pthread_mutex_unlock(&jobPool.lock);
+
+        for (int i = 1; i < jobPool.threadCount; i++) pthread_join(jobPool.threads[i], NULL);
+    #endif
+
+        TRACELOG(LOG_INFO, "THREADS: Parallel jobs worker threads stopped successfully");
+    }
+
+    jobPool.threadCount = 0;
+    jobPool.stop = false;
+
+    JOB_ATOMIC_EXCHANGE(&jobPool.busy, 0);
+#endif
+}
+
+// Set number of workers used to run parallel jobs, clamped to [1..MAX_JOB_WORKER_THREADS]
+// NOTE: Using 1 worker, jobs are run sequentially on calling thread
+void SetParallelJobWorkers(int count)
+{
+    if (count < 1) count = 1;
+    if (count > MAX_JOB_WORKER_THREADS) count = MAX_JOB_WORKER_THREADS;
+
+    jobWorkerCount = count;
+}
+
+// Get number of workers used to run parallel jobs
+int GetParallelJobWorkers(void)
+{
+#if defined(SUPPORT_THREADED_JOBS)
+    return (jobWorkerCount > 1)? jobWorkerCount : 1;
+#else
+    return 1;
+#endif
+}
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Begin profiling zone on current thread, zones can be nested
+// NOTE: Zone name is not copied, it must be a static string
+void BeginProfileZone(const char *name)
+{
+    // Acquire a free ring buffer on first zone
+    if ((profileThread.buffer == NULL) && (profileThread.depth == 0))
+    {
+        for (int i = 0; i < MAX_PROFILE_ZONE_BUFFERS; i++)
+        {
+            if (PROFILE_ATOMIC_EXCHANGE(&profileBuffers[i].owned, 1) == 0)
+            {
+                profileThread.buffer = &profileBuffers[i];
+                break;
+            }
+        }
+    }
+
+    // NOTE: Depth is always tracked to keep zones balanced, even if they can not be recorded
+    if (profileThread.depth < MAX_PROFILE_ZONE_DEPTH)
+    {
+        profileThread.names[profileThread.depth] = name;
+        profileThread.starts[profileThread.depth] = GetProfileTime();
+    }
+
+    profileThread.depth++;
+}
+
+// End last profiling zone begun on current thread, zone is stored in thread ring buffer
+void EndProfileZone(void)
+{
+    if (profileThread.depth == 0) return;     // Unbalanced zone end
+
+    profileThread.depth--;
+
+    if ((profileThread.buffer != NULL) && (profileThread.depth < MAX_PROFILE_ZONE_DEPTH))
+    {
+        ProfileZoneBuffer *buffer = profileThread.buffer;
+        unsigned long long elapsed = GetProfileTime() - profileThread.starts[profileThread.depth];
+
+        ProfileZoneEvent *event = &buffer->events[buffer->head];
+        event->name = profileThread.names[profileThread.depth];
+        event->start = profileThread.starts[profileThread.depth];
+        event->duration = (elapsed > 0xffffffffULL)? 0xffffffff : (unsigned int)elapsed;
+        event->depth = profileThread.depth;
+
+        buffer->head = (buffer->head + 1)%MAX_PROFILE_ZONE_EVENTS;
+        if (buffer->count < MAX_PROFILE_ZONE_EVENTS) buffer->count++;
+    }
+}
+
+// Export recorded profiling zones as Chrome trace JSON (chrome://tracing, https://ui.perfetto.dev)
+// NOTE: Recorded zones are cleared, zones must not be recorded by other threads while exporting
+bool ExportProfileZones(const char *fileName)
+{
+    bool success = false;
+    int eventCount = 0;
+    unsigned long long startTime = 0xffffffffffffffffULL;
+
+    for (int i = 0; i < MAX_PROFILE_ZONE_BUFFERS; i++)
+    {
+        for (int k = 0; k < profileBuffers[i].count; k++)
+        {
+            if (profileBuffers[i].events[k].start < startTime) startTime = profileBuffers[i].events[k].start;
+        }
+
+        eventCount += profileBuffers[i].count;
+    }
+
+    if (eventCount == 0) return success;
+
+    // NOTE: Text size is estimated per event, zone names are expected to be function names
+    int textSize = 64 + eventCount*(MAX_PROFILE_ZONE_EVENT_LENGTH);
+    char *text = (char *)RL_CALLOC(textSize, sizeof(char));
+    int offset = snprintf(text, textSize, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+    for (int i = 0, first = 1; i < MAX_PROFILE_ZONE_BUFFERS; i++)
+    {
+        ProfileZoneBuffer *buffer = &profileBuffers[i];
+
+        // Oldest event is at head position when ring buffer is full
+        int oldest = (buffer->count == MAX_PROFILE_ZONE_EVENTS)? buffer->head : 0;
+
+        for (int k = 0; (k < buffer->count) && (offset < textSize); k++, first = 0)
+        {
+            ProfileZoneEvent *event = &buffer->events[(oldest + k)%MAX_PROFILE_ZONE_EVENTS];
+
+            offset += snprintf(text + offset, textSize - offset, "%s{\"name\":\"%.64s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%i}",
+                first? "" : ",\n", event->name, (double)(event->start - startTime)/1000.0, (double)event->duration/1000.0, i);
+        }
+
+        buffer->head = 0;
+        buffer->count = 0;
+    }
+
+    if (offset < textSize) offset += snprintf(text + offset, textSize - offset, "\n]}\n");
+
+    if (offset < textSize)
+    {
+        success = SaveFileText(fileName, text);
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Profiling zones exported successfully (%i zones)", fileName, eventCount);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export profiling zones, text buffer too small", fileName);
+
+    RL_FREE(text);
+
+    return success;
+}
+#endif
+
 // Internal memory allocator
 // NOTE: Initializes to zero by default
 void *MemAlloc(unsigned int size)
@@ -251,6 +663,95 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file data mapped to memory (read-only)
+// NOTE: File data is not copied, pages are read from disk on first access and can be discarded by the system under
+// memory pressure, if file mapping is not supported or a custom file data loader is set, file data is loaded with LoadFileData()
+MappedFile LoadMappedFile(const char *fileName)
+{
+    MappedFile file = { 0 };
+
+#if defined(SUPPORT_FILE_MAPPING)
+    if ((fileName != NULL) && (loadFileData == NULL))
+    {
+        void *data = NULL;
+        long long size = 0;
+
+    #if defined(_WIN32)
+        void *handle = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);   // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+        if (handle != (void *)-1)   // INVALID_HANDLE_VALUE
+        {
+            if (GetFileSizeEx(handle, &size) && (size > 0) && (size <= 2147483647))
+            {
+                void *mapping = CreateFileMappingA(handle, NULL, 0x02, 0, 0, NULL);   // PAGE_READONLY
+
+                if (mapping != NULL)
+                {
+                    data = MapViewOfFile(mapping, 0x0004, 0, 0, 0);     // FILE_MAP_READ
+
+                    // NOTE: Mapped view keeps a reference to mapping object, it is released on UnmapViewOfFile()
+                    CloseHandle(mapping);
+                }
+            }
+
+            CloseHandle(handle);
+        }
+    #else
+        int handle = open(fileName, O_RDONLY);
+
+        if (handle != -1)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(handle, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+            {
+                size = info.st_size;
+                data = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, handle, 0);
+                if (data == MAP_FAILED) data = NULL;
+            }
+
+            // NOTE: Mapping keeps a reference to file, it is released on munmap()
+            close(handle);
+        }
+    #endif
+
+        if (data != NULL)
+        {
+            file.data = (const unsigned char *)data;
+            file.dataSize = (int)size;
+            file.mapped = true;
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+        }
+    }
+#endif
+
+    // File could not be mapped, loading file data
+    if (!file.mapped) file.data = LoadFileData(fileName, &file.dataSize);
+
+    return file;
+}
+
+// Unload file data mapped by LoadMappedFile()
+void UnloadMappedFile(MappedFile file)
+{
+    if (file.data == NULL) return;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    if (file.mapped)
+    {
+    #if defined(_WIN32)
+        UnmapViewOfFile(file.data);
+    #else
+        munmap((void *)file.data, (size_t)file.dataSize);
+    #endif
+        return;
+    }
+#endif
+
+    UnloadFileData((unsigned char *)file.data);
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -509,3 +1010,135 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+// Run all jobs assigned to a worker
+static void RunParallelJobWorker(ParallelJobWorker *worker)
+{
+    for (int i = worker->workerIndex; i < worker->jobCount; i += worker->workerCount) worker->job(worker->data, i);
+}
+
+#if defined(SUPPORT_THREADED_JOBS)
+// Start pool worker threads, returns number of workers available (including calling thread)
+// NOTE: Only called by the thread owning the pool (busy flag set)
+static int StartParallelJobThreads(int count)
+{
+    if (jobPool.threadCount == 0) jobPool.threadCount = 1;      // First worker is calling thread
+
+#if defined(_WIN32)
+    if (jobPool.done == NULL) jobPool.done = CreateSemaphoreA(NULL, 0, MAX_JOB_WORKER_THREADS, NULL);
+    if (jobPool.done == NULL) return 1;
+#endif
+
+    while (jobPool.threadCount < count)
+    {
+        int index = jobPool.threadCount;
+        bool started = false;
+
+    #if defined(_WIN32)
+        jobPool.start[index] = CreateSemaphoreA(NULL, 0, 1, NULL);
+        if (jobPool.start[index] != NULL)
+        {
+            jobPool.threads[index] = (void *)_beginthreadex(NULL, 0, ParallelJobThread, &jobPool.workers[index], 0, NULL);
+            started = (jobPool.threads[index] != NULL);
+            if (!started) CloseHandle(jobPool.start[index]);
+        }
+    #else
+        jobPool.start[index] = false;
+        started = (pthread_create(&jobPool.threads[index], NULL, ParallelJobThread, &jobPool.workers[index]) == 0);
+    #endif
+
+        // If thread could not be started, jobs are run on the threads already started
+        if (!started)
+        {
+            TRACELOG(LOG_WARNING, "THREADS: Failed to start parallel jobs worker thread");
+            break;
+        }
+
+        jobPool.threadCount++;
+    }
+
+    return (jobPool.threadCount < count)? jobPool.threadCount : count;
+}
+
+// Worker thread entry point, runs worker jobs every time pool is started
+#if defined(_WIN32)
+static unsigned int __stdcall ParallelJobThread(void *arg)
+{
+    int index = (int)((ParallelJobWorker *)arg - jobPool.workers);
+
+    while (true)
+    {
+        WaitForSingleObject(jobPool.start[index], 0xFFFFFFFF);      // INFINITE
+        if (jobPool.stop) break;
+
+        RunParallelJobWorker(&jobPool.workers[index]);
+        ReleaseSemaphore(jobPool.done, 1, NULL);
+    }
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    ReleaseProfileZones();
+#endif
+    return 0;
+}
+#else
+static void *ParallelJobThread(void *arg)
+{
+    int index = (int)((ParallelJobWorker *)arg - jobPool.workers);
+
+    pthread_mutex_lock(&jobPool.lock);
+
+    while (true)
+    {
+        while (!jobPool.start[index] && !jobPool.stop) pthread_cond_wait(&jobPool.startCond, &jobPool.lock);
+        if (jobPool.stop) break;
+
+        jobPool.start[index] = false;
+        pthread_mutex_unlock(&jobPool.lock);
+
+        RunParallelJobWorker(&jobPool.workers[index]);
+
+        pthread_mutex_lock(&jobPool.lock);
+        jobPool.pending--;
+        if (jobPool.pending == 0) pthread_cond_signal(&jobPool.doneCond);
+    }
+
+    pthread_mutex_unlock(&jobPool.lock);
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    ReleaseProfileZones();
+#endif
+    return NULL;
+}
+#endif
+#endif  // SUPPORT_THREADED_JOBS
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Get monotonic time for profiling zones (nanoseconds)
+static unsigned long long GetProfileTime(void)
+{
+#if defined(_WIN32)
+    static unsigned long long frequency = 0;
+    unsigned long long counter = 0;
+
+    if (frequency == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (counter/frequency)*1000000000ULL + ((counter%frequency)*1000000000ULL)/frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec*1000000000ULL + (unsigned long long)now.tv_nsec;
+#endif
+}
+
+// Release profiling zones ring buffer owned by current thread
+// NOTE: Recorded events are kept, buffer can be acquired by another thread
+static void ReleaseProfileZones(void)
+{
+    if (profileThread.buffer != NULL) PROFILE_ATOMIC_EXCHANGE(&profileThread.buffer->owned, 0);
+
+    profileThread.buffer = NULL;
+    profileThread.depth = 0;
+}
+#endif  // SUPPORT_PROFILING_ZONES
@@ -45,6 +45,18 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+#if defined(SUPPORT_PROFILING_ZONES)
+    #define PROFILE_ZONE_BEGIN(name) BeginProfileZone(name)
+    #define PROFILE_ZONE_END() EndProfileZone()
+
+    #ifndef PROFILE_ZONES_FILE_NAME
+        #define PROFILE_ZONES_FILE_NAME "raylib_trace.json"
+    #endif
+#else
+    #define PROFILE_ZONE_BEGIN(name) (void)0
+    #define PROFILE_ZONE_END() (void)0
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -55,7 +67,16 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Parallel job callback, called once for every job index
+typedef void (*ParallelJobCallback)(void *data, int jobIndex);
+
+// Mapped file, read-only file data mapped to memory
+// NOTE: If file can not be mapped, file data is loaded to memory with LoadFileData()
+typedef struct MappedFile {
+    const unsigned char *data;      // File data (read-only)
+    int dataSize;                   // File data size in bytes
+    bool mapped;                    // File data is mapped to memory, not loaded
+} MappedFile;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +95,18 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+void RunParallelJobs(ParallelJobCallback job, void *data, int jobCount); // Run jobs on worker threads (if supported), blocks until all jobs are done
+void CloseParallelJobs(void);                   // Close parallel jobs worker threads pool
+
+MappedFile LoadMappedFile(const char *fileName);    // Load file data mapped to memory (read-only), file data is loaded if mapping is not supported
+void UnloadMappedFile(MappedFile file);             // Unload file data mapped by LoadMappedFile()
+
+#if defined(SUPPORT_PROFILING_ZONES)
+void BeginProfileZone(const char *name);        // Begin profiling zone on current thread, zones can be nested
+void EndProfileZone(void);                      // End last profiling zone begun on current thread
+bool ExportProfileZones(const char *fileName);  // Export recorded profiling zones as Chrome trace JSON
+#endif
+
 #if defined(__cplusplus)
 }
 #endif